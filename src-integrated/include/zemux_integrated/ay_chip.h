@@ -108,6 +108,15 @@ public:
         return panType;
     }
 
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint8_t getSelectedReg() const {
+        return selectedReg;
+    }
+
+    // Value written to the register (unlike read(), ports are not read through the callback).
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint8_t getRegValue(uint8_t reg) const {
+        return regs[reg & 0x0F];
+    }
+
     void setChipType(ChipType type);
     void setVolumeType(VolumeType type);
     void setPanType(PanType type);
@@ -27,10 +27,20 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <array>
+#include <ostream>
+#include <vector>
 #include <zemux_core/config.h>
 #include <zemux_core/non_copyable.h>
 #include <zemux_core/force_inline.h>
 
+#ifdef ZEMUX_Z80_CODE_CACHE
+    #include <cstring>
+    #include <iterator>
+    #include <memory>
+    #include <unordered_map>
+#endif
+
 namespace zemux {
 
 struct Z80ChipRegs {
@@ -181,29 +191,236 @@ struct Z80ChipRegs {
     int IM = 0;
 };
 
+// Registers together with the hidden state, which is needed to continue execution exactly from the same point
+// (e.g. to save and restore snapshots). It is complete only between step() / run() / doInt() / doNmi() calls.
+struct Z80ChipState {
+    Z80ChipRegs regs;
+    uint8_t prefix;
+    bool isHalted;
+    bool shouldResetPv;
+    bool shouldSkipNextInterrupt;
+};
+
+// Direct host pointers for memory pages. When page pointer is set, CPU accesses memory directly,
+// without calling MreqRd / MreqWr callbacks. Only plain memory (without side effects, traps and contention)
+// should be published here, everything else must be left as nullptr to go through the callbacks.
+struct Z80ChipMemoryPages {
+    static constexpr int PAGE_BITS = 8;
+    static constexpr int PAGE_SIZE = 1 << PAGE_BITS;
+    static constexpr int PAGE_MASK = PAGE_SIZE - 1;
+    static constexpr int PAGES = 0x10000 >> PAGE_BITS;
+
+    uint8_t* mreqRd[PAGES] = {};
+    uint8_t* mreqM1[PAGES] = {};
+    uint8_t* mreqWr[PAGES] = {};
+};
+
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "UnusedStructInspection"
+template<typename BusT>
 class Z80ChipCore;
 #pragma clang diagnostic pop
 
-class Z80Chip final : private NonCopyable {
+template<typename BusT>
+class BasicZ80Chip;
+
+struct Z80ChipTraceEntry {
+    uint64_t tstate; // T-states passed in traced step() / run() / doInt() / doNmi() before this instruction
+    Z80ChipRegs regs; // before execution, only if registers are traced
+    uint16_t pc;
+    uint8_t prefix; // active prefix (0x00, 0xCB, 0xDD, 0xED or 0xFD)
+    uint8_t opcode; // opcode fetched by this step (for DD CB and FD CB it is CB)
+};
+
+// Ring buffer of last executed instructions, filled by step() and run() when attached with setTrace().
+// All memory is allocated in the constructor.
+class Z80ChipTrace final : private NonCopyable {
 public:
 
-    using Opcode = void (*)(Z80Chip*);
+    using TriggerCallback = void (*)(void* data, const Z80ChipTrace& trace);
 
-    using MreqRdCallback = uint8_t (*)(void* data, uint16_t address, bool isM1);
-    using MreqWrCallback = void (*)(void* data, uint16_t address, uint8_t value);
-    using IorqRdCallback = uint8_t (*)(void* data, uint16_t port);
-    using IorqWrCallback = void (*)(void* data, uint16_t port, uint8_t value);
+    // Capacity is rounded up to the power of two.
+    explicit Z80ChipTrace(unsigned int capacity, bool isRegsTraced = false);
 
-    // From "Z80 CPU User Manual":
-    //
-    // IORQ is also generated concurrently with M1 during an interrupt acknowledge cycle to indicate
-    // that an interrupt response vector can be placed on the data bus.
-    using IorqM1Callback = uint8_t (*)(void* data);
+    void clear();
 
-    // To handle contended memory with original ULA.
-    using PutAddressCallback = void (*)(void* data, uint16_t address, uint_fast32_t cycles);
+    // Callback is called after the instruction at the given address is executed and added to the trace.
+    // Null callback removes the trigger.
+    void setTrigger(uint16_t address, TriggerCallback callback, void* data = nullptr);
+    void removeTrigger();
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE unsigned int getCapacity() const {
+        return static_cast<unsigned int>(entries.size());
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE unsigned int getSize() const {
+        return static_cast<unsigned int>(std::min(count, static_cast<uint64_t>(entries.size())));
+    }
+
+    // Index 0 is the oldest entry.
+    [[nodiscard]] ZEMUX_FORCE_INLINE const Z80ChipTraceEntry& getEntry(unsigned int index) const {
+        return entries[(count - getSize() + index) & mask];
+    }
+
+    // Writes last maxEntries entries, oldest first.
+    void dump(std::ostream& os, unsigned int maxEntries) const;
+
+private:
+
+    std::vector<Z80ChipTraceEntry> entries;
+    uint64_t mask;
+    uint64_t count = 0;
+    uint64_t tstate = 0;
+    bool isRegsTraced;
+    int triggerAddress = -1;
+    TriggerCallback triggerCallback = nullptr;
+    void* triggerData = nullptr;
+
+    ZEMUX_FORCE_INLINE Z80ChipTraceEntry& beginEntry(const Z80ChipRegs& regs, uint8_t prefix) {
+        Z80ChipTraceEntry& entry = entries[count & mask];
+        ++count;
+
+        entry.tstate = tstate;
+        entry.pc = regs.PC;
+        entry.prefix = prefix;
+
+        if (isRegsTraced) {
+            entry.regs = regs;
+        }
+
+        return entry;
+    }
+
+    ZEMUX_FORCE_INLINE void endEntry(const Z80ChipTraceEntry& entry, uint_fast32_t passedTstates) {
+        tstate += passedTstates;
+
+        if (entry.pc == triggerAddress) {
+            triggerCallback(triggerData, *this);
+        }
+    }
+
+    template<typename BusT>
+    friend class BasicZ80Chip;
+};
+
+#ifdef ZEMUX_Z80_PROFILER
+
+// Execution counters, filled by executeOpcode(). Prefixes are counted as separate opcodes (just like in step()),
+// except for DD CB and FD CB, which are counted in their own tables together with displacement and opcode fetch.
+// T-states include contention added by callbacks. Callbacks are counted only when the access goes through the bus,
+// not through the memory pages.
+struct Z80ChipProfile {
+    enum Table {
+        Table00,
+        TableCB,
+        TableDD,
+        TableED,
+        TableFD,
+        TableDD_CB,
+        TableFD_CB,
+        TABLES
+    };
+
+    enum Callback {
+        CallbackMreqM1,
+        CallbackMreqRd,
+        CallbackMreqWr,
+        CallbackIorqRd,
+        CallbackIorqWr,
+        CallbackIorqM1,
+        CallbackPutAddress,
+        CALLBACKS
+    };
+
+    uint64_t opcodeExecutions[TABLES][0x100] = {};
+    uint64_t opcodeTstates[TABLES][0x100] = {};
+    uint64_t callbackCalls[CALLBACKS] = {};
+
+    void reset();
+
+    // Opcodes sorted by T-states, most expensive first, then callbacks.
+    void writeReport(std::ostream& os, int maxOpcodes = 0x100) const;
+
+    // Opcodes with the same sort order, then callbacks, one per line ("name,executions,tstates").
+    void writeCsv(std::ostream& os) const;
+
+    ZEMUX_FORCE_INLINE static Table tableForPrefix(uint8_t prefix) {
+        switch (prefix) {
+            case 0xCB:
+                return TableCB;
+
+            case 0xDD:
+                return TableDD;
+
+            case 0xED:
+                return TableED;
+
+            case 0xFD:
+                return TableFD;
+
+            default:
+                return Table00;
+        }
+    }
+};
+
+#endif
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+
+// Opcode handlers of the straight-line code (actually, trace of the executed code, so it may include taken jumps),
+// recorded by run() inside one memory page. Only opcodes are cached, operands are always read from the memory.
+template<typename BusT>
+struct Z80ChipCodeBlock {
+    static constexpr int MAX_ENTRIES = 32;
+
+    int size = 0;
+    uint8_t offsets[MAX_ENTRIES];
+    void (* handlers[MAX_ENTRIES])(BasicZ80Chip<BusT>*);
+};
+
+// Cached code of the host memory page (the same host page may be mapped at different addresses).
+template<typename BusT>
+struct Z80ChipCodePage {
+    static constexpr int MASK_BITS = 64;
+
+    uint64_t opcodeMask[Z80ChipMemoryPages::PAGE_SIZE / MASK_BITS];
+    int16_t blockIndices[Z80ChipMemoryPages::PAGE_SIZE];
+    std::vector<Z80ChipCodeBlock<BusT>> blocks;
+
+    Z80ChipCodePage() {
+        clear();
+    }
+
+    ZEMUX_FORCE_INLINE bool hasOpcodeAt(uint8_t offset) const {
+        return (opcodeMask[offset / MASK_BITS] >> (offset % MASK_BITS)) & 1;
+    }
+
+    void clear() {
+        memset(opcodeMask, 0, sizeof(opcodeMask));
+        std::fill(std::begin(blockIndices), std::end(blockIndices), -1);
+        blocks.clear();
+    }
+};
+
+#endif
+
+// BusT is called directly (not through function pointers), so its methods can be inlined into opcode handlers:
+//
+// uint8_t onCpuMreqRd(uint16_t address, bool isM1);
+// void onCpuMreqWr(uint16_t address, uint8_t value);
+// uint8_t onCpuIorqRd(uint16_t port);
+// void onCpuIorqWr(uint16_t port, uint8_t value);
+// uint8_t onCpuIorqM1();
+// void onCpuPutAddress(uint16_t address, uint_fast32_t cycles);
+//
+// Member functions are defined in z80_chip_impl.h, it should be included into the one translation unit,
+// which explicitly instantiates BasicZ80Chip for the given BusT (see z80_chip.cpp).
+template<typename BusT>
+class BasicZ80Chip : private NonCopyable {
+public:
+
+    using Opcode = void (*)(BasicZ80Chip*);
 
     enum ChipType {
         TypeNmos,
@@ -219,17 +436,14 @@ public:
     static constexpr unsigned int FLAG_Z = 0x40; // zero
     static constexpr unsigned int FLAG_S = 0x80; // sign
 
-    explicit Z80Chip(void* callbackData,
-            MreqRdCallback onMreqRd,
-            MreqWrCallback onMreqWr,
-            IorqRdCallback onIorqRd,
-            IorqWrCallback onIorqWr,
-            IorqM1Callback onIorqM1,
-            PutAddressCallback onPutAddress,
-            ChipType chipType = TypeNmos);
+    explicit BasicZ80Chip(BusT* bus, ChipType chipType = TypeNmos);
 
     Z80ChipRegs regs;
 
+#ifdef ZEMUX_Z80_PROFILER
+    Z80ChipProfile profile; // not cleared by reset()
+#endif
+
     [[nodiscard]] ZEMUX_FORCE_INLINE ChipType getChipType() const {
         return chipType;
     };
@@ -257,12 +471,53 @@ public:
         tstate += cycles;
     }
 
+    // May be called at any time, including from the callbacks (e.g. when memory is remapped).
+    void setMemoryPages(const Z80ChipMemoryPages& pages);
+
+    // Same as above, but only count pages starting from firstPage are taken from the given pages.
+    void setMemoryPages(const Z80ChipMemoryPages& pages, int firstPage, int count);
+
+    // Same as above, but only for the one page of writes (e.g. when writes to the page are not trapped anymore).
+    void setMemoryWrPage(int page, uint8_t* hostPage);
+
+    // Trace is filled by step() and run() (run() executes instructions one by one, like step(), while trace
+    // is attached, so it is much slower). Pass nullptr to detach.
+    ZEMUX_FORCE_INLINE void setTrace(Z80ChipTrace* newTrace) {
+        trace = newTrace;
+    }
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    // Writes made by CPU invalidate cached code automatically,
+    // this should be called when memory is modified by someone else (e.g. on snapshot loading).
+    void flushCodeCache();
+
+    // Cached code is looked up by the address of the host memory, so it should be called before the memory
+    // is released (otherwise cached code may be found for another memory, allocated at the same address).
+    void forgetCodeCache(const uint8_t* hostMemory, size_t size);
+
+    // Should be called when the memory is written not by the CPU directly (e.g. by the write callback),
+    // hostPage is the same pointer, that is (or may be) published for this memory.
+    void invalidateCodeCache(uint8_t* hostPage, uint8_t offset);
+#endif
+
+    [[nodiscard]] Z80ChipState getState() const;
+    void setState(const Z80ChipState& state);
+
     void setChipType(ChipType type);
     void reset();
     uint_fast32_t step();
     uint_fast32_t doInt();
     uint_fast32_t doNmi();
 
+    // Executes instructions (prefixes are counted as separate instructions, just like in step())
+    // until at least tstateBudget T-states are passed. Result is the same as calling step() in a loop,
+    // but without per-instruction call overhead. Returns number of passed T-states.
+    uint_fast32_t run(uint_fast32_t tstateBudget);
+
+    // Same as above, but INT line is active for the first intLineTstates T-states,
+    // so interrupt is checked before every instruction while the line is active.
+    uint_fast32_t run(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
 private:
 
     static constexpr unsigned int FLAG_C_M16 = 0x10000;
@@ -281,18 +536,25 @@ private:
     static constexpr unsigned int FLAG_N_TO_5 = 4;
     static constexpr unsigned int FLAG_S_TO_N = 6;
 
-    static uint8_t parityLookup[0x100];
+    // Immutable, so chips can be used from different threads without synchronization.
+    static const std::array<uint8_t, 0x100> parityLookup;
 
-    static void initSharedData();
+    static constexpr std::array<uint8_t, 0x100> makeParityLookup() {
+        std::array<uint8_t, 0x100> result {};
 
-    void* callbackData;
-    MreqRdCallback onMreqRd;
-    MreqWrCallback onMreqWr;
-    IorqRdCallback onIorqRd;
-    IorqWrCallback onIorqWr;
-    IorqM1Callback onIorqM1;
-    PutAddressCallback onPutAddress;
+        for (int i = 0; i < 0x100; ++i) {
+            int p = i ^ (i >> 4);
+            p ^= p >> 2;
+            p ^= p >> 1;
 
+            result[i] = (p & 1) ? 0 : FLAG_PV;
+        }
+
+        return result;
+    }
+
+    BusT* bus;
+    Z80ChipTrace* trace = nullptr;
     ChipType chipType;
     Opcode* optable;
     bool isHalted;
@@ -303,18 +565,137 @@ private:
     uint8_t prefix;
     int8_t cbOffset = 0;
     uint_fast32_t tstate = 0;
+    uint_fast32_t runTstateBudget = 0; // only inside run()
+    uint_fast32_t runIntLineTstates = 0; // only inside run()
+
+#ifdef ZEMUX_Z80_PROFILER
+    Z80ChipProfile::Table profileTable = Z80ChipProfile::Table00; // may be changed by DD CB / FD CB handler
+    uint8_t profileOpcode = 0;
+#endif
+    Z80ChipMemoryPages memoryPages;
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    // Twice as much as pages of the largest RAM, all cached code is dropped when there are more pages.
+    static constexpr size_t MAX_CODE_CACHE_PAGES = 8192;
+
+    std::unordered_map<uint8_t*, std::unique_ptr<Z80ChipCodePage<BusT>>> codeCachePages;
+    Z80ChipCodePage<BusT>* codePagesM1[Z80ChipMemoryPages::PAGES] = {};
+    Z80ChipCodePage<BusT>* codePagesWr[Z80ChipMemoryPages::PAGES] = {};
+    uint_fast32_t codeCacheGeneration = 0; // changed every time when some cached block may become invalid
+#endif
+
+    void executeInt();
+    void executeNmi();
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    Z80ChipCodePage<BusT>* getCodePage(uint8_t* hostPage);
+
+    // Code pages of the published memory pages.
+    void updateCodePages(int firstPage, int count);
+
+    template<bool hasIntLine>
+    void runCached(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
+    template<bool hasIntLine>
+    void recordCodeBlock(Z80ChipCodePage<BusT>* codePage, uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
+    template<bool hasIntLine>
+    void executeCodeBlock(const Z80ChipCodeBlock<BusT>& block, uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
+    ZEMUX_FORCE_INLINE void invalidateCodePage(Z80ChipCodePage<BusT>* codePage, uint8_t offset) {
+        if (codePage != nullptr && codePage->hasOpcodeAt(offset)) {
+            codePage->clear();
+            ++codeCacheGeneration;
+        }
+    }
+#endif
+
+    // Same loop as run() in z80_chip_impl.h, but every instruction is traced (when trace is still attached).
+    template<bool hasIntLine>
+    void runTraced(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
+#ifdef ZEMUX_Z80_THREADED
+    template<bool hasIntLine>
+    void runThreaded(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+#endif
+
+    template<bool isTraced = false>
+    ZEMUX_FORCE_INLINE void executeOpcode() {
+        shouldResetPv = false;
+        shouldSkipNextInterrupt = false;
+
+        isProcessingInstruction = true;
+
+#ifdef ZEMUX_Z80_PROFILER
+        uint_fast32_t prevTstate = tstate;
+        profileTable = Z80ChipProfile::tableForPrefix(prefix);
+#endif
+
+        Z80ChipTraceEntry* traceEntry = nullptr;
+        uint_fast32_t traceTstate = 0;
+
+        if constexpr (isTraced) {
+            traceEntry = &trace->beginEntry(regs, prefix);
+            traceTstate = tstate;
+        }
+
+        uint8_t opcode = fetchOpcode();
+
+        if constexpr (isTraced) {
+            traceEntry->opcode = opcode;
+        }
+
+#ifdef ZEMUX_Z80_PROFILER
+        profileOpcode = opcode;
+        optable[opcode](this);
+        ++profile.opcodeExecutions[profileTable][profileOpcode];
+        profile.opcodeTstates[profileTable][profileOpcode] += tstate - prevTstate;
+#else
+        optable[opcode](this);
+#endif
+
+        isProcessingInstruction = false;
+
+        if constexpr (isTraced) {
+            trace->endEntry(*traceEntry, tstate - traceTstate);
+        }
+    }
+
+    // True if run() would execute next opcode immediately (there is T-state budget and interrupt can't be accepted).
+    // Always false outside of run().
+    ZEMUX_FORCE_INLINE bool canContinueRun() {
+        return tstate < runTstateBudget && !(regs.IFF1 && tstate < runIntLineTstates);
+    }
 
     ZEMUX_FORCE_INLINE void incR() {
         regs.R = (regs.R & 0x80) | ((regs.R + 1) & 0x7Fu);
     }
 
     ZEMUX_FORCE_INLINE void putAddressOnBus(uint16_t address, uint_fast32_t cycles) {
-        onPutAddress(callbackData, address, cycles);
+#ifdef ZEMUX_Z80_PROFILER
+        ++profile.callbackCalls[Z80ChipProfile::CallbackPutAddress];
+#endif
+
+        bus->onCpuPutAddress(address, cycles);
         tstate += cycles;
     }
 
     ZEMUX_FORCE_INLINE uint8_t fetchOpcode() {
-        uint8_t result = onMreqRd(callbackData, regs.PC++, true);
+        uint8_t* page = memoryPages.mreqM1[regs.PC >> Z80ChipMemoryPages::PAGE_BITS];
+
+        uint8_t result;
+
+        if (page) {
+            result = page[regs.PC & Z80ChipMemoryPages::PAGE_MASK];
+        } else {
+#ifdef ZEMUX_Z80_PROFILER
+            ++profile.callbackCalls[Z80ChipProfile::CallbackMreqM1];
+#endif
+
+            result = bus->onCpuMreqRd(regs.PC, true);
+        }
+
+        ++regs.PC;
         incR();
         tstate += 4;
 
@@ -327,7 +708,11 @@ private:
         // Two wait states are automatically added to this cycle.
         // These states are added so that a ripple priority interrupt scheme can be easily implemented.
 
-        uint8_t result = onIorqM1(callbackData);
+#ifdef ZEMUX_Z80_PROFILER
+        ++profile.callbackCalls[Z80ChipProfile::CallbackIorqM1];
+#endif
+
+        uint8_t result = bus->onCpuIorqM1();
         incR();
         tstate += 6;
 
@@ -335,7 +720,7 @@ private:
     }
 
     ZEMUX_FORCE_INLINE uint8_t fetchByte() {
-        uint8_t result = onMreqRd(callbackData, regs.PC, false);
+        uint8_t result = memoryPeek(regs.PC);
         regs.PC += pcIncrement;
         tstate += 3;
         return result;
@@ -352,14 +737,45 @@ private:
         return value | static_cast<uint16_t>(static_cast<uint16_t>(fetchByte()) << 8);
     }
 
+    ZEMUX_FORCE_INLINE uint8_t memoryPeek(uint16_t address) {
+        uint8_t* page = memoryPages.mreqRd[address >> Z80ChipMemoryPages::PAGE_BITS];
+
+        if (page) {
+            return page[address & Z80ChipMemoryPages::PAGE_MASK];
+        }
+
+#ifdef ZEMUX_Z80_PROFILER
+        ++profile.callbackCalls[Z80ChipProfile::CallbackMreqRd];
+#endif
+
+        return bus->onCpuMreqRd(address, false);
+    }
+
     ZEMUX_FORCE_INLINE uint8_t memoryRead(uint16_t address) {
-        uint8_t value = onMreqRd(callbackData, address, false);
+        uint8_t value = memoryPeek(address);
         tstate += 3;
         return value;
     }
 
     ZEMUX_FORCE_INLINE void memoryWrite(uint16_t address, uint8_t value) {
-        onMreqWr(callbackData, address, value);
+        uint8_t* page = memoryPages.mreqWr[address >> Z80ChipMemoryPages::PAGE_BITS];
+
+        if (page) {
+            page[address & Z80ChipMemoryPages::PAGE_MASK] = value;
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+            invalidateCodePage(codePagesWr[address >> Z80ChipMemoryPages::PAGE_BITS],
+                    address & Z80ChipMemoryPages::PAGE_MASK);
+#endif
+        } else {
+#ifdef ZEMUX_Z80_PROFILER
+            ++profile.callbackCalls[Z80ChipProfile::CallbackMreqWr];
+#endif
+
+            // Callback reports written memory with invalidateCodeCache().
+            bus->onCpuMreqWr(address, value);
+        }
+
         tstate += 3;
     }
 
@@ -368,7 +784,12 @@ private:
         // During I/O operations, a single wait state is automatically inserted.
 
         putAddressOnBus(port, 1);
-        uint8_t value = onIorqRd(callbackData, port);
+
+#ifdef ZEMUX_Z80_PROFILER
+        ++profile.callbackCalls[Z80ChipProfile::CallbackIorqRd];
+#endif
+
+        uint8_t value = bus->onCpuIorqRd(port);
         tstate += 3;
         return value;
     }
@@ -378,16 +799,94 @@ private:
         // During I/O operations, a single wait state is automatically inserted.
 
         putAddressOnBus(port, 1);
-        onIorqWr(callbackData, port, value);
+
+#ifdef ZEMUX_Z80_PROFILER
+        ++profile.callbackCalls[Z80ChipProfile::CallbackIorqWr];
+#endif
+
+        bus->onCpuIorqWr(port, value);
         tstate += 3;
     }
 
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "UnusedStructInspection"
-    friend class Z80ChipCore;
+    friend class Z80ChipCore<BusT>;
 #pragma clang diagnostic pop
 };
 
+// Bus, that forwards every access to the callbacks, which are set at runtime.
+struct Z80ChipCallbackBus {
+    using MreqRdCallback = uint8_t (*)(void* data, uint16_t address, bool isM1);
+    using MreqWrCallback = void (*)(void* data, uint16_t address, uint8_t value);
+    using IorqRdCallback = uint8_t (*)(void* data, uint16_t port);
+    using IorqWrCallback = void (*)(void* data, uint16_t port, uint8_t value);
+
+    // From "Z80 CPU User Manual":
+    //
+    // IORQ is also generated concurrently with M1 during an interrupt acknowledge cycle to indicate
+    // that an interrupt response vector can be placed on the data bus.
+    using IorqM1Callback = uint8_t (*)(void* data);
+
+    // To handle contended memory with original ULA.
+    using PutAddressCallback = void (*)(void* data, uint16_t address, uint_fast32_t cycles);
+
+    void* callbackData;
+    MreqRdCallback onMreqRd;
+    MreqWrCallback onMreqWr;
+    IorqRdCallback onIorqRd;
+    IorqWrCallback onIorqWr;
+    IorqM1Callback onIorqM1;
+    PutAddressCallback onPutAddress;
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuMreqRd(uint16_t address, bool isM1) {
+        return onMreqRd(callbackData, address, isM1);
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuMreqWr(uint16_t address, uint8_t value) {
+        onMreqWr(callbackData, address, value);
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqRd(uint16_t port) {
+        return onIorqRd(callbackData, port);
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuIorqWr(uint16_t port, uint8_t value) {
+        onIorqWr(callbackData, port, value);
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqM1() {
+        return onIorqM1(callbackData);
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuPutAddress(uint16_t address, uint_fast32_t cycles) {
+        onPutAddress(callbackData, address, cycles);
+    }
+};
+
+extern template class BasicZ80Chip<Z80ChipCallbackBus>;
+
+// Chip with callbacks, that are set at runtime. Convenient, but memory access can't be inlined,
+// so when the bus is known at compile time, BasicZ80Chip should be instantiated directly.
+class Z80Chip final : private Z80ChipCallbackBus, public BasicZ80Chip<Z80ChipCallbackBus> {
+public:
+
+    using Z80ChipCallbackBus::MreqRdCallback;
+    using Z80ChipCallbackBus::MreqWrCallback;
+    using Z80ChipCallbackBus::IorqRdCallback;
+    using Z80ChipCallbackBus::IorqWrCallback;
+    using Z80ChipCallbackBus::IorqM1Callback;
+    using Z80ChipCallbackBus::PutAddressCallback;
+
+    explicit Z80Chip(void* callbackData,
+            MreqRdCallback onMreqRd,
+            MreqWrCallback onMreqWr,
+            IorqRdCallback onIorqRd,
+            IorqWrCallback onIorqWr,
+            IorqM1Callback onIorqM1,
+            PutAddressCallback onPutAddress,
+            ChipType chipType = TypeNmos);
+};
+
 }
 
 #endif
@@ -0,0 +1,183 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_CODE_CACHE
+#define ZEMUX_INTEGRATED__Z80_CHIP_CODE_CACHE
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+
+namespace zemux {
+
+// Same as run() in z80_chip_impl.h, but opcodes of the straight-line code are taken from the cache.
+// To keep T-state and R-register accounting exact, cached block is left at every point where
+// run() may behave differently (end of budget, possible interrupt, another PC or invalidated cache).
+
+template<typename BusT>
+template<bool hasIntLine>
+void BasicZ80Chip<BusT>::runCached(uint_fast32_t tstateBudget, [[maybe_unused]] uint_fast32_t intLineTstates) {
+    while (tstate < tstateBudget) {
+        if (hasIntLine && tstate < intLineTstates) {
+            uint_fast32_t prevTstate = tstate;
+            executeInt();
+
+            // Accepted interrupt always takes some time.
+            if (tstate != prevTstate) {
+                continue;
+            }
+        }
+
+        Z80ChipCodePage<BusT>* codePage = codePagesM1[regs.PC >> Z80ChipMemoryPages::PAGE_BITS];
+
+        if (prefix || codePage == nullptr) {
+            executeOpcode();
+            continue;
+        }
+
+        int blockIndex = codePage->blockIndices[regs.PC & Z80ChipMemoryPages::PAGE_MASK];
+
+        if (blockIndex < 0) {
+            recordCodeBlock<hasIntLine>(codePage, tstateBudget, intLineTstates);
+        } else {
+            executeCodeBlock<hasIntLine>(codePage->blocks[blockIndex], tstateBudget, intLineTstates);
+        }
+    }
+}
+
+template<typename BusT>
+template<bool hasIntLine>
+void BasicZ80Chip<BusT>::recordCodeBlock(Z80ChipCodePage<BusT>* codePage,
+        uint_fast32_t tstateBudget,
+        [[maybe_unused]] uint_fast32_t intLineTstates) {
+
+    uint8_t* hostPage = memoryPages.mreqM1[regs.PC >> Z80ChipMemoryPages::PAGE_BITS];
+    uint16_t base = regs.PC & ~Z80ChipMemoryPages::PAGE_MASK;
+    uint8_t startOffset = regs.PC & Z80ChipMemoryPages::PAGE_MASK;
+    uint_fast32_t generation = codeCacheGeneration;
+    Z80ChipCodeBlock<BusT> block;
+
+    for (;;) {
+        uint8_t offset = regs.PC & Z80ChipMemoryPages::PAGE_MASK;
+
+        block.offsets[block.size] = offset;
+        block.handlers[block.size] = optable[hostPage[offset]];
+        ++block.size;
+
+        executeOpcode();
+
+        // Memory was modified or remapped during recording.
+        if (generation != codeCacheGeneration) {
+            return;
+        }
+
+        // Block, that was stopped by the budget or by the interrupt, would be too short, so it is not stored.
+        if (tstate >= tstateBudget || (hasIntLine && tstate < intLineTstates)) {
+            return;
+        }
+
+        if (block.size == Z80ChipCodeBlock<BusT>::MAX_ENTRIES
+                || (regs.PC & ~Z80ChipMemoryPages::PAGE_MASK) != base) {
+
+            break;
+        }
+    }
+
+    for (int i = 0; i < block.size; ++i) {
+        uint8_t offset = block.offsets[i];
+        codePage->opcodeMask[offset / Z80ChipCodePage<BusT>::MASK_BITS]
+                |= 1ULL << (offset % Z80ChipCodePage<BusT>::MASK_BITS);
+    }
+
+    codePage->blockIndices[startOffset] = static_cast<int16_t>(codePage->blocks.size());
+    codePage->blocks.push_back(block);
+}
+
+template<typename BusT>
+template<bool hasIntLine>
+void BasicZ80Chip<BusT>::executeCodeBlock(const Z80ChipCodeBlock<BusT>& block,
+        uint_fast32_t tstateBudget,
+        [[maybe_unused]] uint_fast32_t intLineTstates) {
+
+    uint16_t base = regs.PC & ~Z80ChipMemoryPages::PAGE_MASK;
+    uint_fast32_t generation = codeCacheGeneration;
+
+    for (int i = 0;;) {
+        // Same as executeOpcode(), but without memory read and optable lookup.
+        shouldResetPv = false;
+        shouldSkipNextInterrupt = false;
+        isProcessingInstruction = true;
+
+        ++regs.PC;
+        incR();
+        tstate += 4;
+
+        block.handlers[i](this);
+        isProcessingInstruction = false;
+
+        // Block may be already destroyed, so generation must be checked first.
+        if (generation != codeCacheGeneration
+                || ++i == block.size
+                || regs.PC != (base | block.offsets[i])
+                || tstate >= tstateBudget
+                || (hasIntLine && tstate < intLineTstates)) {
+
+            return;
+        }
+    }
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<false>(tstateBudget, 0);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+    runCached<false>(tstateBudget, 0);
+    runTstateBudget = 0;
+    return tstate;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<true>(tstateBudget, intLineTstates);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+    runIntLineTstates = intLineTstates;
+    runCached<true>(tstateBudget, intLineTstates);
+    runTstateBudget = 0;
+    runIntLineTstates = 0;
+    return tstate;
+}
+
+}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_FLAG_TABLES
+#define ZEMUX_INTEGRATED__Z80_CHIP_FLAG_TABLES
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <array>
+#include <zemux_core/force_inline.h>
+#include "z80_chip.h"
+
+namespace zemux {
+
+// Precomputed values of register F for 8-bit ALU operations.
+// ADD / SUB tables are indexed by (carry << 16) | (x << 8) | y, INC / DEC tables are indexed by the source value
+// (carry flag is not included in INC / DEC tables, it must be preserved by the caller).
+class Z80ChipFlagTables final {
+public:
+
+    static constexpr int SIZE_8 = 0x100;
+    static constexpr int SIZE_ALU_8 = 0x20000;
+
+    static constexpr uint8_t sz(int value) {
+        return static_cast<uint8_t>((value & (Z80Chip::FLAG_S | Z80Chip::FLAG_5 | Z80Chip::FLAG_3))
+                | ((value & 0xFF) ? 0 : Z80Chip::FLAG_Z));
+    }
+
+    static constexpr uint8_t szp(int value) {
+        int p = value ^ (value >> 4);
+        p ^= p >> 2;
+        p ^= p >> 1;
+
+        return static_cast<uint8_t>(sz(value) | ((p & 1) ? 0 : Z80Chip::FLAG_PV));
+    }
+
+    static constexpr uint8_t add(int x, int y, int carry) {
+        int result = x + y + carry;
+        int halfResult = (x & 0x0F) + (y & 0x0F) + carry;
+        int signedResult = static_cast<int8_t>(x) + static_cast<int8_t>(y) + carry;
+
+        return static_cast<uint8_t>(((result & 0x100) ? Z80Chip::FLAG_C : 0)
+                | (halfResult & Z80Chip::FLAG_H)
+                | ((signedResult < -128 || signedResult > 127) ? Z80Chip::FLAG_PV : 0)
+                | sz(result));
+    }
+
+    static constexpr uint8_t sub(int x, int y, int carry) {
+        int result = x - y - carry;
+        int halfResult = (x & 0x0F) - (y & 0x0F) - carry;
+        int signedResult = static_cast<int8_t>(x) - static_cast<int8_t>(y) - carry;
+
+        return static_cast<uint8_t>(((result & 0x100) ? Z80Chip::FLAG_C : 0)
+                | Z80Chip::FLAG_N
+                | (halfResult & Z80Chip::FLAG_H)
+                | ((signedResult < -128 || signedResult > 127) ? Z80Chip::FLAG_PV : 0)
+                | sz(result));
+    }
+
+    template<uint8_t (* F)(int)>
+    static constexpr std::array<uint8_t, SIZE_8> make8() {
+        std::array<uint8_t, SIZE_8> result {};
+
+        for (int i = 0; i < SIZE_8; ++i) {
+            result[i] = F(i);
+        }
+
+        return result;
+    }
+
+    template<uint8_t (* F)(int, int, int)>
+    static constexpr std::array<uint8_t, SIZE_ALU_8> makeAlu8() {
+        std::array<uint8_t, SIZE_ALU_8> result {};
+
+        for (int i = 0; i < SIZE_ALU_8; ++i) {
+            result[i] = F((i >> 8) & 0xFF, i & 0xFF, i >> 16);
+        }
+
+        return result;
+    }
+
+    static constexpr uint8_t inc(int x) {
+        return static_cast<uint8_t>(add(x, 1, 0) & ~Z80Chip::FLAG_C);
+    }
+
+    static constexpr uint8_t dec(int x) {
+        return static_cast<uint8_t>(sub(x, 1, 0) & ~Z80Chip::FLAG_C);
+    }
+
+    static const std::array<uint8_t, SIZE_8> SZ;
+    static const std::array<uint8_t, SIZE_8> SZP;
+    static const std::array<uint8_t, SIZE_8> INC;
+    static const std::array<uint8_t, SIZE_8> DEC;
+    static const std::array<uint8_t, SIZE_ALU_8> ADD;
+    static const std::array<uint8_t, SIZE_ALU_8> SUB;
+
+    static ZEMUX_FORCE_INLINE int index(uint8_t x, uint8_t y) {
+        return (static_cast<int>(x) << 8) | y;
+    }
+
+    static ZEMUX_FORCE_INLINE int index(uint8_t x, uint8_t y, uint8_t f) {
+        return (static_cast<int>(f & Z80Chip::FLAG_C) << 16) | (static_cast<int>(x) << 8) | y;
+    }
+};
+
+// Tables can be generated only when the class is complete.
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_8> Z80ChipFlagTables::SZ = make8<sz>();
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_8> Z80ChipFlagTables::SZP = make8<szp>();
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_8> Z80ChipFlagTables::INC = make8<inc>();
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_8> Z80ChipFlagTables::DEC = make8<dec>();
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_ALU_8> Z80ChipFlagTables::ADD = makeAlu8<add>();
+inline constexpr std::array<uint8_t, Z80ChipFlagTables::SIZE_ALU_8> Z80ChipFlagTables::SUB = makeAlu8<sub>();
+
+}
+
+#endif
@@ -0,0 +1,489 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_IMPL
+#define ZEMUX_INTEGRATED__Z80_CHIP_IMPL
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+#include "z80_chip_optable_00.h"
+#include "z80_chip_optable_CB.h"
+#include "z80_chip_optable_DD.h"
+#include "z80_chip_optable_ED.h"
+#include "z80_chip_optable_FD.h"
+#include "z80_chip_optable_DD_CB.h"
+#include "z80_chip_optable_FD_CB.h"
+
+#ifdef ZEMUX_Z80_THREADED
+    #include "z80_chip_threaded.h"
+#endif
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    #include "z80_chip_code_cache.h"
+#endif
+
+namespace zemux {
+
+// Table can be generated only when the class is complete.
+template<typename BusT>
+constexpr std::array<uint8_t, 0x100> BasicZ80Chip<BusT>::parityLookup = makeParityLookup();
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "cppcoreguidelines-pro-type-member-init"
+
+template<typename BusT>
+BasicZ80Chip<BusT>::BasicZ80Chip(BusT* bus, ChipType chipType) : bus { bus }, chipType { chipType } {
+
+    regs.BC = 0xFFFF;
+    regs.DE = 0xFFFF;
+    regs.HL = 0xFFFF;
+    regs.AF = 0xFFFF;
+    regs.IX = 0xFFFF;
+    regs.IY = 0xFFFF;
+    regs.SP = 0xFFFF;
+    regs.BC_ = 0xFFFF;
+    regs.DE_ = 0xFFFF;
+    regs.HL_ = 0xFFFF;
+    regs.AF_ = 0xFFFF;
+
+    reset();
+}
+
+#pragma clang diagnostic pop
+
+template<typename BusT>
+Z80ChipState BasicZ80Chip<BusT>::getState() const {
+    return Z80ChipState {
+            .regs = regs,
+            .prefix = prefix,
+            .isHalted = isHalted,
+            .shouldResetPv = shouldResetPv,
+            .shouldSkipNextInterrupt = shouldSkipNextInterrupt };
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::setState(const Z80ChipState& state) {
+    regs = state.regs;
+    prefix = state.prefix;
+    isHalted = state.isHalted;
+    shouldResetPv = state.shouldResetPv;
+    shouldSkipNextInterrupt = state.shouldSkipNextInterrupt;
+    isProcessingInstruction = false;
+
+    // Prefixes are executed as separate instructions, so optable is defined by the prefix alone.
+    switch (prefix) {
+        case 0xCB:
+            optable = Z80ChipOptables<BusT>::tableCB;
+            break;
+
+        case 0xDD:
+            optable = Z80ChipOptables<BusT>::tableDD;
+            break;
+
+        case 0xED:
+            optable = Z80ChipOptables<BusT>::tableED;
+            break;
+
+        case 0xFD:
+            optable = Z80ChipOptables<BusT>::tableFD;
+            break;
+
+        default:
+            optable = Z80ChipOptables<BusT>::table00;
+            break;
+    }
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::setChipType(ChipType type) {
+    chipType = type;
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::reset() {
+    // From "Z80 CPU User Manual":
+    //
+    // Reset (input, active Low). RESET initializes the CPU as follows: it resets the
+    // interrupt enable flip-flop, clears the Program Counter and registers I and R, and sets the
+    // interrupt status to Mode 0.
+    //
+    // So all other registers may have any value.
+
+    regs.PC = 0x0000;
+    regs.MP = 0x0000;
+    regs.IR = 0x0000;
+    regs.IFF1 = false;
+    regs.IFF2 = false;
+    regs.IM = 0;
+
+    optable = Z80ChipOptables<BusT>::table00;
+    isHalted = false;
+    shouldResetPv = false;
+    isProcessingInstruction = false;
+    shouldSkipNextInterrupt = false;
+    pcIncrement = 1;
+    prefix = 0;
+    tstate = 0;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::step() {
+    tstate = 0;
+
+    if (trace) {
+        executeOpcode<true>();
+    } else {
+        executeOpcode();
+    }
+
+    return tstate;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::doInt() {
+    tstate = 0;
+    executeInt();
+
+    if (trace) {
+        trace->tstate += tstate;
+    }
+
+    return tstate;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::doNmi() {
+    tstate = 0;
+    executeNmi();
+
+    if (trace) {
+        trace->tstate += tstate;
+    }
+
+    return tstate;
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::setMemoryPages(const Z80ChipMemoryPages& pages) {
+    setMemoryPages(pages, 0, Z80ChipMemoryPages::PAGES);
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::setMemoryPages(const Z80ChipMemoryPages& pages, int firstPage, int count) {
+    std::copy_n(pages.mreqRd + firstPage, count, memoryPages.mreqRd + firstPage);
+    std::copy_n(pages.mreqM1 + firstPage, count, memoryPages.mreqM1 + firstPage);
+    std::copy_n(pages.mreqWr + firstPage, count, memoryPages.mreqWr + firstPage);
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    // Code of the pages, which are not published anymore, may be still there.
+    if (codeCachePages.size() >= MAX_CODE_CACHE_PAGES) {
+        codeCachePages.clear();
+        updateCodePages(0, Z80ChipMemoryPages::PAGES);
+    } else {
+        updateCodePages(firstPage, count);
+    }
+#endif
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::setMemoryWrPage(int page, uint8_t* hostPage) {
+    memoryPages.mreqWr[page] = hostPage;
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    if (codeCachePages.size() >= MAX_CODE_CACHE_PAGES) {
+        codeCachePages.clear();
+        updateCodePages(0, Z80ChipMemoryPages::PAGES);
+    } else {
+        // Cached blocks depend on M1 pages only, so generation is left as is.
+        codePagesWr[page] = getCodePage(hostPage);
+    }
+#endif
+}
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::flushCodeCache() {
+    for (auto& entry : codeCachePages) {
+        entry.second->clear();
+    }
+
+    ++codeCacheGeneration;
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::forgetCodeCache(const uint8_t* hostMemory, size_t size) {
+    auto isForgotten = [hostMemory, size](const uint8_t* hostPage) {
+        return hostPage >= hostMemory && hostPage < hostMemory + size;
+    };
+
+    for (auto it = codeCachePages.begin(); it != codeCachePages.end();) {
+        it = isForgotten(it->first) ? codeCachePages.erase(it) : std::next(it);
+    }
+
+    // Memory may be still published until the next setMemoryPages(), it is not cached meanwhile.
+    for (int page = 0; page < Z80ChipMemoryPages::PAGES; ++page) {
+        if (isForgotten(memoryPages.mreqM1[page])) {
+            codePagesM1[page] = nullptr;
+        }
+
+        if (isForgotten(memoryPages.mreqWr[page])) {
+            codePagesWr[page] = nullptr;
+        }
+    }
+
+    ++codeCacheGeneration;
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::invalidateCodeCache(uint8_t* hostPage, uint8_t offset) {
+    auto it = codeCachePages.find(hostPage);
+
+    if (it != codeCachePages.end()) {
+        invalidateCodePage(it->second.get(), offset);
+    }
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::updateCodePages(int firstPage, int count) {
+    for (int page = firstPage; page < firstPage + count; ++page) {
+        codePagesM1[page] = getCodePage(memoryPages.mreqM1[page]);
+        codePagesWr[page] = getCodePage(memoryPages.mreqWr[page]);
+    }
+
+    ++codeCacheGeneration;
+}
+
+template<typename BusT>
+Z80ChipCodePage<BusT>* BasicZ80Chip<BusT>::getCodePage(uint8_t* hostPage) {
+    if (hostPage == nullptr) {
+        return nullptr;
+    }
+
+    auto& codePage = codeCachePages[hostPage];
+
+    if (!codePage) {
+        codePage = std::make_unique<Z80ChipCodePage<BusT>>();
+    }
+
+    return codePage.get();
+}
+
+#endif
+
+// Budget is not published to runTstateBudget, so bulk execution of HALT and repeating instructions is disabled,
+// and every instruction gets its own entry, just like with step().
+template<typename BusT>
+template<bool hasIntLine>
+void BasicZ80Chip<BusT>::runTraced(uint_fast32_t tstateBudget, [[maybe_unused]] uint_fast32_t intLineTstates) {
+    while (tstate < tstateBudget) {
+        if (hasIntLine && tstate < intLineTstates) {
+            uint_fast32_t prevTstate = tstate;
+            executeInt();
+
+            if (tstate != prevTstate) {
+                if (trace) {
+                    trace->tstate += tstate - prevTstate;
+                }
+
+                continue;
+            }
+        }
+
+        // Trigger callback may detach the trace.
+        if (trace) {
+            executeOpcode<true>();
+        } else {
+            executeOpcode();
+        }
+    }
+}
+
+#if !defined(ZEMUX_Z80_THREADED) && !defined(ZEMUX_Z80_CODE_CACHE)
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<false>(tstateBudget, 0);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+
+    while (tstate < tstateBudget) {
+        executeOpcode();
+    }
+
+    runTstateBudget = 0;
+    return tstate;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<true>(tstateBudget, intLineTstates);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+    runIntLineTstates = intLineTstates;
+
+    while (tstate < tstateBudget) {
+        if (tstate < intLineTstates) {
+            uint_fast32_t prevTstate = tstate;
+            executeInt();
+
+            // Accepted interrupt always takes some time.
+            if (tstate != prevTstate) {
+                continue;
+            }
+        }
+
+        executeOpcode();
+    }
+
+    runTstateBudget = 0;
+    runIntLineTstates = 0;
+    return tstate;
+}
+
+#endif
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::executeInt() {
+    if (!regs.IFF1 || shouldSkipNextInterrupt) {
+        return;
+    }
+
+    if (isProcessingInstruction || prefix) {
+        if (chipType == TypeNmos) {
+            shouldResetPv = true;
+        }
+
+        return;
+    }
+
+    if (isHalted) {
+        ++regs.PC;
+        isHalted = false;
+    }
+
+    regs.IFF1 = false;
+    regs.IFF2 = false;
+
+    if (shouldResetPv) {
+        regs.F &= ~FLAG_PV;
+        shouldResetPv = false;
+    }
+
+    isProcessingInstruction = true;
+    uint8_t intVec = fetchIntVec();
+
+    switch (regs.IM) {
+        case 0: {
+            // From "The Z80 Family Program Interrupt Structure":
+            //
+            // The first byte of a multi-byte instruction is read during the interrupt acknowledge cycle.
+            // Subsequent bytes are read in by a normal memory read sequence (the PC, however, remains
+            // at its pre-interrupt state and the user must insure that memory will not respond
+            // to these read sequences).
+
+            pcIncrement = 0;
+            optable[intVec](this);
+            pcIncrement = 1;
+
+            break;
+        }
+
+        case 1: {
+            // From "The Z80 Family Program Interrupt Structure":
+            //
+            // Note that when doing programmed I/O the CPU will ignore any data put onto
+            // the data bus during the interrupt acknowledge cycle.
+
+            Z80ChipOptables<BusT>::table00[0xFF](this); // RST #38
+            break;
+        }
+
+            // IM 2
+        default: {
+            uint16_t address = intVec | (static_cast<uint16_t>(regs.I) << 8);
+
+            memoryWrite(--regs.SP, regs.PCH);
+            memoryWrite(--regs.SP, regs.PCL);
+
+            regs.PCL = memoryRead(address);
+            regs.PCH = memoryRead(address + 1);
+
+            regs.MP = regs.PC;
+            ++tstate;
+
+            break;
+        }
+    }
+
+    isProcessingInstruction = false;
+}
+
+template<typename BusT>
+void BasicZ80Chip<BusT>::executeNmi() {
+    if (isProcessingInstruction || prefix || shouldSkipNextInterrupt) {
+        return;
+    }
+
+    if (isHalted) {
+        ++regs.PC;
+        isHalted = false;
+    }
+
+    isProcessingInstruction = true;
+    ++tstate; // Additional T-state
+
+    // From "Z80 CPU User Manual":
+    //
+    // The CPU response to a nonmaskable interrupt is similar to a normal memory read operation.
+    // The only difference is that the contents of the data bus are ignored while the processor
+    // automatically stores the Program Counter in the external stack and jumps to address 0066h.
+    [[maybe_unused]] auto unused = fetchOpcode();
+
+    // NOTICE: if you thinking about submitting bug-report about IFF1 not copied to IFF2, you are not right :)
+    // actually IFF1 *not* copied to IFF2. this is tested on real hardware.
+    regs.IFF1 = false;
+
+    memoryWrite(--regs.SP, regs.PCH);
+    memoryWrite(--regs.SP, regs.PCL);
+
+    regs.PC = 0x0066;
+    regs.MP = regs.PC;
+
+    isProcessingInstruction = false;
+}
+
+}
+
+#endif
@@ -0,0 +1,1670 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_00
+#define ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_00
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+
+namespace zemux {
+
+//
+// 0x0n
+//
+
+// NOP
+template<typename BusT>
+static void op_00_00(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_NOP(cpu);
+}
+
+// LD BC,NN
+template<typename BusT>
+static void op_00_01(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.BC));
+}
+
+// LD (BC),A
+template<typename BusT>
+static void op_00_02(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.BC);
+}
+
+// INC BC
+template<typename BusT>
+static void op_00_03(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.BC));
+}
+
+// INC B
+template<typename BusT>
+static void op_00_04(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.B));
+}
+
+// DEC B
+template<typename BusT>
+static void op_00_05(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.B));
+}
+
+// LD B,N
+template<typename BusT>
+static void op_00_06(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.B));
+}
+
+// RLCA
+template<typename BusT>
+static void op_00_07(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLCA(cpu);
+}
+
+// EX AF,AF'
+template<typename BusT>
+static void op_00_08(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_AF_AF_(cpu);
+}
+
+// ADD HL,BC
+template<typename BusT>
+static void op_00_09(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.HL), cpu->regs.BC);
+}
+
+// LD A,(BC)
+template<typename BusT>
+static void op_00_0A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.BC);
+}
+
+// DEC BC
+template<typename BusT>
+static void op_00_0B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.BC));
+}
+
+// INC C
+template<typename BusT>
+static void op_00_0C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.C));
+}
+
+// DEC C
+template<typename BusT>
+static void op_00_0D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.C));
+}
+
+// LD C,N
+template<typename BusT>
+static void op_00_0E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.C));
+}
+
+// RRCA
+template<typename BusT>
+static void op_00_0F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRCA(cpu);
+}
+
+//
+// 0x1n
+//
+
+// DJNZ O
+template<typename BusT>
+static void op_00_10(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DJNZ(cpu);
+}
+
+// LD DE,NN
+template<typename BusT>
+static void op_00_11(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.DE));
+}
+
+// LD (DE),A
+template<typename BusT>
+static void op_00_12(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.DE);
+}
+
+// INC DE
+template<typename BusT>
+static void op_00_13(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.DE));
+}
+
+// INC D
+template<typename BusT>
+static void op_00_14(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.D));
+}
+
+// DEC D
+template<typename BusT>
+static void op_00_15(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.D));
+}
+
+// LD D,N
+template<typename BusT>
+static void op_00_16(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.D));
+}
+
+// RLA
+template<typename BusT>
+static void op_00_17(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLA(cpu);
+}
+
+// JR O
+template<typename BusT>
+static void op_00_18(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR(cpu);
+}
+
+// ADD HL,DE
+template<typename BusT>
+static void op_00_19(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.HL), cpu->regs.DE);
+}
+
+// LD A,(DE)
+template<typename BusT>
+static void op_00_1A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.DE);
+}
+
+// DEC DE
+template<typename BusT>
+static void op_00_1B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.DE));
+}
+
+// INC E
+template<typename BusT>
+static void op_00_1C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.E));
+}
+
+// DEC E
+template<typename BusT>
+static void op_00_1D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.E));
+}
+
+// LD E,N
+template<typename BusT>
+static void op_00_1E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.E));
+}
+
+// RRA
+template<typename BusT>
+static void op_00_1F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRA(cpu);
+}
+
+//
+// 0x2n
+//
+
+// JR NZ,O
+template<typename BusT>
+static void op_00_20(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+}
+
+// LD HL,NN
+template<typename BusT>
+static void op_00_21(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.HL));
+}
+
+// LD (NN),HL
+template<typename BusT>
+static void op_00_22(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_RP(cpu, cpu->regs.HL);
+}
+
+// INC HL
+template<typename BusT>
+static void op_00_23(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.HL));
+}
+
+// INC H
+template<typename BusT>
+static void op_00_24(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.H));
+}
+
+// DEC H
+template<typename BusT>
+static void op_00_25(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.H));
+}
+
+// LD H,N
+template<typename BusT>
+static void op_00_26(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.H));
+}
+
+// DAA
+template<typename BusT>
+static void op_00_27(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DAA(cpu);
+}
+
+// JR Z,O
+template<typename BusT>
+static void op_00_28(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+}
+
+// ADD HL,HL
+template<typename BusT>
+static void op_00_29(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.HL), cpu->regs.HL);
+}
+
+// LD HL,(NN)
+template<typename BusT>
+static void op_00_2A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_MNN(cpu, &(cpu->regs.HL));
+}
+
+// DEC HL
+template<typename BusT>
+static void op_00_2B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.HL));
+}
+
+// INC L
+template<typename BusT>
+static void op_00_2C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.L));
+}
+
+// DEC L
+template<typename BusT>
+static void op_00_2D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.L));
+}
+
+// LD L,N
+template<typename BusT>
+static void op_00_2E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.L));
+}
+
+// CPL
+template<typename BusT>
+static void op_00_2F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CPL(cpu);
+}
+
+//
+// 0x3n
+//
+
+// JR NC,O
+template<typename BusT>
+static void op_00_30(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+}
+
+// LD SP,NN
+template<typename BusT>
+static void op_00_31(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.SP));
+}
+
+// LD (NN),A
+template<typename BusT>
+static void op_00_32(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_A(cpu);
+}
+
+// INC SP
+template<typename BusT>
+static void op_00_33(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.SP));
+}
+
+// INC (HL)
+template<typename BusT>
+static void op_00_34(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_INC_8);
+}
+
+// DEC (HL)
+template<typename BusT>
+static void op_00_35(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_DEC_8);
+}
+
+// LD (HL),N
+template<typename BusT>
+static void op_00_36(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MHL_N(cpu);
+}
+
+// SCF
+template<typename BusT>
+static void op_00_37(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SCF(cpu);
+}
+
+// JR C,O
+template<typename BusT>
+static void op_00_38(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_C);
+}
+
+// ADD HL,SP
+template<typename BusT>
+static void op_00_39(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.HL), cpu->regs.SP);
+}
+
+// LD A,(NN)
+template<typename BusT>
+static void op_00_3A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MNN(cpu);
+}
+
+// DEC SP
+template<typename BusT>
+static void op_00_3B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.SP));
+}
+
+// INC A
+template<typename BusT>
+static void op_00_3C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.A));
+}
+
+// DEC A
+template<typename BusT>
+static void op_00_3D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.A));
+}
+
+// LD A,N
+template<typename BusT>
+static void op_00_3E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.A));
+}
+
+// CCF
+template<typename BusT>
+static void op_00_3F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CCF(cpu);
+}
+
+//
+// 0x4n
+//
+
+// LD B,B
+template<typename BusT>
+static void op_00_40(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.B);
+}
+
+// LD B,C
+template<typename BusT>
+static void op_00_41(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.C);
+}
+
+// LD B,D
+template<typename BusT>
+static void op_00_42(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.D);
+}
+
+// LD B,E
+template<typename BusT>
+static void op_00_43(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.E);
+}
+
+// LD B,H
+template<typename BusT>
+static void op_00_44(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.H);
+}
+
+// LD B,L
+template<typename BusT>
+static void op_00_45(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.L);
+}
+
+// LD B,(HL)
+template<typename BusT>
+static void op_00_46(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.B), cpu->regs.HL);
+}
+
+// LD B,A
+template<typename BusT>
+static void op_00_47(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.A);
+}
+
+// LD C,B
+template<typename BusT>
+static void op_00_48(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.B);
+}
+
+// LD C,C
+template<typename BusT>
+static void op_00_49(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.C);
+}
+
+// LD C,D
+template<typename BusT>
+static void op_00_4A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.D);
+}
+
+// LD C,E
+template<typename BusT>
+static void op_00_4B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.E);
+}
+
+// LD C,H
+template<typename BusT>
+static void op_00_4C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.H);
+}
+
+// LD C,L
+template<typename BusT>
+static void op_00_4D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.L);
+}
+
+// LD C,(HL)
+template<typename BusT>
+static void op_00_4E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.C), cpu->regs.HL);
+}
+
+// LD C,A
+template<typename BusT>
+static void op_00_4F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.A);
+}
+
+//
+// 0x5n
+//
+
+// LD D,B
+template<typename BusT>
+static void op_00_50(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.B);
+}
+
+// LD D,C
+template<typename BusT>
+static void op_00_51(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.C);
+}
+
+// LD D,D
+template<typename BusT>
+static void op_00_52(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.D);
+}
+
+// LD D,E
+template<typename BusT>
+static void op_00_53(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.E);
+}
+
+// LD D,H
+template<typename BusT>
+static void op_00_54(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.H);
+}
+
+// LD D,L
+template<typename BusT>
+static void op_00_55(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.L);
+}
+
+// LD D,(HL)
+template<typename BusT>
+static void op_00_56(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.D), cpu->regs.HL);
+}
+
+// LD D,A
+template<typename BusT>
+static void op_00_57(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.A);
+}
+
+// LD E,B
+template<typename BusT>
+static void op_00_58(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.B);
+}
+
+// LD E,C
+template<typename BusT>
+static void op_00_59(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.C);
+}
+
+// LD E,D
+template<typename BusT>
+static void op_00_5A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.D);
+}
+
+// LD E,E
+template<typename BusT>
+static void op_00_5B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.E);
+}
+
+// LD E,H
+template<typename BusT>
+static void op_00_5C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.H);
+}
+
+// LD E,L
+template<typename BusT>
+static void op_00_5D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.L);
+}
+
+// LD E,(HL)
+template<typename BusT>
+static void op_00_5E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.E), cpu->regs.HL);
+}
+
+// LD E,A
+template<typename BusT>
+static void op_00_5F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.A);
+}
+
+//
+// 0x6n
+//
+
+// LD H,B
+template<typename BusT>
+static void op_00_60(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.B);
+}
+
+// LD H,C
+template<typename BusT>
+static void op_00_61(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.C);
+}
+
+// LD H,D
+template<typename BusT>
+static void op_00_62(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.D);
+}
+
+// LD H,E
+template<typename BusT>
+static void op_00_63(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.E);
+}
+
+// LD H,H
+template<typename BusT>
+static void op_00_64(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.H);
+}
+
+// LD H,L
+template<typename BusT>
+static void op_00_65(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.L);
+}
+
+// LD H,(HL)
+template<typename BusT>
+static void op_00_66(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.H), cpu->regs.HL);
+}
+
+// LD H,A
+template<typename BusT>
+static void op_00_67(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.H), cpu->regs.A);
+}
+
+// LD L,B
+template<typename BusT>
+static void op_00_68(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.B);
+}
+
+// LD L,C
+template<typename BusT>
+static void op_00_69(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.C);
+}
+
+// LD L,D
+template<typename BusT>
+static void op_00_6A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.D);
+}
+
+// LD L,E
+template<typename BusT>
+static void op_00_6B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.E);
+}
+
+// LD L,H
+template<typename BusT>
+static void op_00_6C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.H);
+}
+
+// LD L,L
+template<typename BusT>
+static void op_00_6D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.L);
+}
+
+// LD L,(HL)
+template<typename BusT>
+static void op_00_6E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.L), cpu->regs.HL);
+}
+
+// LD L,A
+template<typename BusT>
+static void op_00_6F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.L), cpu->regs.A);
+}
+
+//
+// 0x7n
+//
+
+// LD (HL),B
+template<typename BusT>
+static void op_00_70(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.B);
+}
+
+// LD (HL),C
+template<typename BusT>
+static void op_00_71(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.C);
+}
+
+// LD (HL),D
+template<typename BusT>
+static void op_00_72(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.D);
+}
+
+// LD (HL),E
+template<typename BusT>
+static void op_00_73(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.E);
+}
+
+// LD (HL),H
+template<typename BusT>
+static void op_00_74(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.H);
+}
+
+// LD (HL),L
+template<typename BusT>
+static void op_00_75(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.L);
+}
+
+// HALT
+template<typename BusT>
+static void op_00_76(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_HALT(cpu);
+}
+
+// LD (HL),A
+template<typename BusT>
+static void op_00_77(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_R(cpu, cpu->regs.HL, cpu->regs.A);
+}
+
+// LD A,B
+template<typename BusT>
+static void op_00_78(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.B);
+}
+
+// LD A,C
+template<typename BusT>
+static void op_00_79(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.C);
+}
+
+// LD A,D
+template<typename BusT>
+static void op_00_7A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.D);
+}
+
+// LD A,E
+template<typename BusT>
+static void op_00_7B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.E);
+}
+
+// LD A,H
+template<typename BusT>
+static void op_00_7C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.H);
+}
+
+// LD A,L
+template<typename BusT>
+static void op_00_7D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.L);
+}
+
+// LD A,(HL)
+template<typename BusT>
+static void op_00_7E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_MRP(cpu, &(cpu->regs.A), cpu->regs.HL);
+}
+
+// LD A,A
+template<typename BusT>
+static void op_00_7F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.A);
+}
+
+//
+// 0x8n
+//
+
+// ADD A,B
+template<typename BusT>
+static void op_00_80(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.B);
+}
+
+// ADD A,C
+template<typename BusT>
+static void op_00_81(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.C);
+}
+
+// ADD A,D
+template<typename BusT>
+static void op_00_82(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.D);
+}
+
+// ADD A,E
+template<typename BusT>
+static void op_00_83(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.E);
+}
+
+// ADD A,H
+template<typename BusT>
+static void op_00_84(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.H);
+}
+
+// ADD A,L
+template<typename BusT>
+static void op_00_85(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.L);
+}
+
+// ADD A,(HL)
+template<typename BusT>
+static void op_00_86(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_ADD_8);
+}
+
+// ADD A,A
+template<typename BusT>
+static void op_00_87(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.A);
+}
+
+// ADC A,B
+template<typename BusT>
+static void op_00_88(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.B);
+}
+
+// ADC A,C
+template<typename BusT>
+static void op_00_89(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.C);
+}
+
+// ADC A,D
+template<typename BusT>
+static void op_00_8A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.D);
+}
+
+// ADC A,E
+template<typename BusT>
+static void op_00_8B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.E);
+}
+
+// ADC A,H
+template<typename BusT>
+static void op_00_8C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.H);
+}
+
+// ADC A,L
+template<typename BusT>
+static void op_00_8D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.L);
+}
+
+// ADC A,(HL)
+template<typename BusT>
+static void op_00_8E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_ADC_8);
+}
+
+// ADC A,A
+template<typename BusT>
+static void op_00_8F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.A);
+}
+
+//
+// 0x9n
+//
+
+// SUB B
+template<typename BusT>
+static void op_00_90(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.B);
+}
+
+// SUB C
+template<typename BusT>
+static void op_00_91(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.C);
+}
+
+// SUB D
+template<typename BusT>
+static void op_00_92(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.D);
+}
+
+// SUB E
+template<typename BusT>
+static void op_00_93(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.E);
+}
+
+// SUB H
+template<typename BusT>
+static void op_00_94(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.H);
+}
+
+// SUB L
+template<typename BusT>
+static void op_00_95(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.L);
+}
+
+// SUB (HL)
+template<typename BusT>
+static void op_00_96(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_SUB_8);
+}
+
+// SUB A
+template<typename BusT>
+static void op_00_97(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.A);
+}
+
+// SBC A,B
+template<typename BusT>
+static void op_00_98(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.B);
+}
+
+// SBC A,C
+template<typename BusT>
+static void op_00_99(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.C);
+}
+
+// SBC A,D
+template<typename BusT>
+static void op_00_9A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.D);
+}
+
+// SBC A,E
+template<typename BusT>
+static void op_00_9B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.E);
+}
+
+// SBC A,H
+template<typename BusT>
+static void op_00_9C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.H);
+}
+
+// SBC A,L
+template<typename BusT>
+static void op_00_9D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.L);
+}
+
+// SBC A,(HL)
+template<typename BusT>
+static void op_00_9E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_SBC_8);
+}
+
+// SBC A,A
+template<typename BusT>
+static void op_00_9F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.A);
+}
+
+//
+// 0xAn
+//
+
+// AND B
+template<typename BusT>
+static void op_00_A0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.B);
+}
+
+// AND C
+template<typename BusT>
+static void op_00_A1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.C);
+}
+
+// AND D
+template<typename BusT>
+static void op_00_A2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.D);
+}
+
+// AND E
+template<typename BusT>
+static void op_00_A3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.E);
+}
+
+// AND H
+template<typename BusT>
+static void op_00_A4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.H);
+}
+
+// AND L
+template<typename BusT>
+static void op_00_A5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.L);
+}
+
+// AND (HL)
+template<typename BusT>
+static void op_00_A6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_AND_8);
+}
+
+// AND A
+template<typename BusT>
+static void op_00_A7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.A);
+}
+
+// XOR B
+template<typename BusT>
+static void op_00_A8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.B);
+}
+
+// XOR C
+template<typename BusT>
+static void op_00_A9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.C);
+}
+
+// XOR D
+template<typename BusT>
+static void op_00_AA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.D);
+}
+
+// XOR E
+template<typename BusT>
+static void op_00_AB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.E);
+}
+
+// XOR H
+template<typename BusT>
+static void op_00_AC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.H);
+}
+
+// XOR L
+template<typename BusT>
+static void op_00_AD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.L);
+}
+
+// XOR (HL)
+template<typename BusT>
+static void op_00_AE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_XOR_8);
+}
+
+// XOR A
+template<typename BusT>
+static void op_00_AF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.A);
+}
+
+//
+// 0xBn
+//
+
+// OR B
+template<typename BusT>
+static void op_00_B0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.B);
+}
+
+// OR C
+template<typename BusT>
+static void op_00_B1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.C);
+}
+
+// OR D
+template<typename BusT>
+static void op_00_B2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.D);
+}
+
+// OR E
+template<typename BusT>
+static void op_00_B3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.E);
+}
+
+// OR H
+template<typename BusT>
+static void op_00_B4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.H);
+}
+
+// OR L
+template<typename BusT>
+static void op_00_B5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.L);
+}
+
+// OR (HL)
+template<typename BusT>
+static void op_00_B6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_OR_8);
+}
+
+// OR A
+template<typename BusT>
+static void op_00_B7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.A);
+}
+
+// CP B
+template<typename BusT>
+static void op_00_B8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.B);
+}
+
+// CP C
+template<typename BusT>
+static void op_00_B9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.C);
+}
+
+// CP D
+template<typename BusT>
+static void op_00_BA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.D);
+}
+
+// CP E
+template<typename BusT>
+static void op_00_BB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.E);
+}
+
+// CP H
+template<typename BusT>
+static void op_00_BC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.H);
+}
+
+// CP L
+template<typename BusT>
+static void op_00_BD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.L);
+}
+
+// CP (HL)
+template<typename BusT>
+static void op_00_BE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_MHL(cpu, Z80ChipCore<BusT>::do_CP_8);
+}
+
+// CP A
+template<typename BusT>
+static void op_00_BF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.A);
+}
+
+//
+// 0xCn
+//
+
+// RET NZ
+template<typename BusT>
+static void op_00_C0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+}
+
+// POP BC
+template<typename BusT>
+static void op_00_C1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.BC));
+}
+
+// JP NZ,NN
+template<typename BusT>
+static void op_00_C2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+}
+
+// JP NN
+template<typename BusT>
+static void op_00_C3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP(cpu);
+}
+
+// CALL NZ,NN
+template<typename BusT>
+static void op_00_C4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+}
+
+// PUSH BC
+template<typename BusT>
+static void op_00_C5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.BC);
+}
+
+// ADD A,N
+template<typename BusT>
+static void op_00_C6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADD_8);
+}
+
+// RST #00
+template<typename BusT>
+static void op_00_C7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x00);
+}
+
+// RET Z
+template<typename BusT>
+static void op_00_C8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+}
+
+// RET
+template<typename BusT>
+static void op_00_C9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET(cpu);
+}
+
+// JP Z,NN
+template<typename BusT>
+static void op_00_CA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+}
+
+// prefix #CB
+template<typename BusT>
+static void op_00_CB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_CB(cpu);
+}
+
+// CALL Z,NN
+template<typename BusT>
+static void op_00_CC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+}
+
+// CALL NN
+template<typename BusT>
+static void op_00_CD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL(cpu);
+}
+
+// ADC A,N
+template<typename BusT>
+static void op_00_CE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADC_8);
+}
+
+// RST #08
+template<typename BusT>
+static void op_00_CF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x08);
+}
+
+//
+// 0xDn
+//
+
+// RET NC
+template<typename BusT>
+static void op_00_D0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+}
+
+// POP DE
+template<typename BusT>
+static void op_00_D1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.DE));
+}
+
+// JP NC,NN
+template<typename BusT>
+static void op_00_D2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+}
+
+// OUT (N),A
+template<typename BusT>
+static void op_00_D3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_OUT_N_A(cpu);
+}
+
+// CALL NC,NN
+template<typename BusT>
+static void op_00_D4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+}
+
+// PUSH DE
+template<typename BusT>
+static void op_00_D5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.DE);
+}
+
+// SUB N
+template<typename BusT>
+static void op_00_D6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SUB_8);
+}
+
+// RST #10
+template<typename BusT>
+static void op_00_D7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x10);
+}
+
+// RET C
+template<typename BusT>
+static void op_00_D8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_C);
+}
+
+// EXX
+template<typename BusT>
+static void op_00_D9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EXX(cpu);
+}
+
+// JP C,NN
+template<typename BusT>
+static void op_00_DA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_C);
+}
+
+// IN A,(N)
+template<typename BusT>
+static void op_00_DB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_IN_A_N(cpu);
+}
+
+// CALL C,NN
+template<typename BusT>
+static void op_00_DC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_C);
+}
+
+// prefix #DD
+template<typename BusT>
+static void op_00_DD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_DD(cpu);
+}
+
+// SBC A,N
+template<typename BusT>
+static void op_00_DE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SBC_8);
+}
+
+// RST #18
+template<typename BusT>
+static void op_00_DF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x18);
+}
+
+//
+// 0xEn
+//
+
+// RET PO
+template<typename BusT>
+static void op_00_E0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+}
+
+// POP HL
+template<typename BusT>
+static void op_00_E1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.HL));
+}
+
+// JP PO,NN
+template<typename BusT>
+static void op_00_E2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+}
+
+// EX (SP),HL
+template<typename BusT>
+static void op_00_E3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_MSP_RP(cpu, &(cpu->regs.HL));
+}
+
+// CALL PO,NN
+template<typename BusT>
+static void op_00_E4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+}
+
+// PUSH HL
+template<typename BusT>
+static void op_00_E5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.HL);
+}
+
+// AND N
+template<typename BusT>
+static void op_00_E6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_AND_8);
+}
+
+// RST #20
+template<typename BusT>
+static void op_00_E7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x20);
+}
+
+// RET PE
+template<typename BusT>
+static void op_00_E8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+}
+
+// JP HL
+template<typename BusT>
+static void op_00_E9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_RP(cpu, cpu->regs.HL);
+}
+
+// JP PE,NN
+template<typename BusT>
+static void op_00_EA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+}
+
+// EX DE,HL
+template<typename BusT>
+static void op_00_EB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_DE_HL(cpu);
+}
+
+// CALL PE,NN
+template<typename BusT>
+static void op_00_EC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+}
+
+// prefix #ED
+template<typename BusT>
+static void op_00_ED(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_ED(cpu);
+}
+
+// XOR N
+template<typename BusT>
+static void op_00_EE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_XOR_8);
+}
+
+// RST #28
+template<typename BusT>
+static void op_00_EF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x28);
+}
+
+//
+// 0xFn
+//
+
+// RET P
+template<typename BusT>
+static void op_00_F0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_P);
+}
+
+// POP AF
+template<typename BusT>
+static void op_00_F1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.AF));
+}
+
+// JP P,NN
+template<typename BusT>
+static void op_00_F2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_P);
+}
+
+// DI
+template<typename BusT>
+static void op_00_F3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DI(cpu);
+}
+
+// CALL P,NN
+template<typename BusT>
+static void op_00_F4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_P);
+}
+
+// PUSH AF
+template<typename BusT>
+static void op_00_F5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.AF);
+}
+
+// OR N
+template<typename BusT>
+static void op_00_F6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_OR_8);
+}
+
+// RST #30
+template<typename BusT>
+static void op_00_F7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x30);
+}
+
+// RET M
+template<typename BusT>
+static void op_00_F8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_M);
+}
+
+// LD SP,HL
+template<typename BusT>
+static void op_00_F9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SP_RP(cpu, cpu->regs.HL);
+}
+
+// JP M,NN
+template<typename BusT>
+static void op_00_FA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_M);
+}
+
+// EI
+template<typename BusT>
+static void op_00_FB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EI(cpu);
+}
+
+// CALL M,NN
+template<typename BusT>
+static void op_00_FC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_M);
+}
+
+// prefix #FD
+template<typename BusT>
+static void op_00_FD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_FD(cpu);
+}
+
+// CP N
+template<typename BusT>
+static void op_00_FE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_CP_8);
+}
+
+// RST #38
+template<typename BusT>
+static void op_00_FF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x38);
+}
+
+template<typename BusT>
+typename BasicZ80Chip<BusT>::Opcode Z80ChipOptables<BusT>::table00[0x100] = {
+        op_00_00, op_00_01, op_00_02, op_00_03, op_00_04, op_00_05, op_00_06, op_00_07,
+        op_00_08, op_00_09, op_00_0A, op_00_0B, op_00_0C, op_00_0D, op_00_0E, op_00_0F,
+        op_00_10, op_00_11, op_00_12, op_00_13, op_00_14, op_00_15, op_00_16, op_00_17,
+        op_00_18, op_00_19, op_00_1A, op_00_1B, op_00_1C, op_00_1D, op_00_1E, op_00_1F,
+        op_00_20, op_00_21, op_00_22, op_00_23, op_00_24, op_00_25, op_00_26, op_00_27,
+        op_00_28, op_00_29, op_00_2A, op_00_2B, op_00_2C, op_00_2D, op_00_2E, op_00_2F,
+        op_00_30, op_00_31, op_00_32, op_00_33, op_00_34, op_00_35, op_00_36, op_00_37,
+        op_00_38, op_00_39, op_00_3A, op_00_3B, op_00_3C, op_00_3D, op_00_3E, op_00_3F,
+        op_00_40, op_00_41, op_00_42, op_00_43, op_00_44, op_00_45, op_00_46, op_00_47,
+        op_00_48, op_00_49, op_00_4A, op_00_4B, op_00_4C, op_00_4D, op_00_4E, op_00_4F,
+        op_00_50, op_00_51, op_00_52, op_00_53, op_00_54, op_00_55, op_00_56, op_00_57,
+        op_00_58, op_00_59, op_00_5A, op_00_5B, op_00_5C, op_00_5D, op_00_5E, op_00_5F,
+        op_00_60, op_00_61, op_00_62, op_00_63, op_00_64, op_00_65, op_00_66, op_00_67,
+        op_00_68, op_00_69, op_00_6A, op_00_6B, op_00_6C, op_00_6D, op_00_6E, op_00_6F,
+        op_00_70, op_00_71, op_00_72, op_00_73, op_00_74, op_00_75, op_00_76, op_00_77,
+        op_00_78, op_00_79, op_00_7A, op_00_7B, op_00_7C, op_00_7D, op_00_7E, op_00_7F,
+        op_00_80, op_00_81, op_00_82, op_00_83, op_00_84, op_00_85, op_00_86, op_00_87,
+        op_00_88, op_00_89, op_00_8A, op_00_8B, op_00_8C, op_00_8D, op_00_8E, op_00_8F,
+        op_00_90, op_00_91, op_00_92, op_00_93, op_00_94, op_00_95, op_00_96, op_00_97,
+        op_00_98, op_00_99, op_00_9A, op_00_9B, op_00_9C, op_00_9D, op_00_9E, op_00_9F,
+        op_00_A0, op_00_A1, op_00_A2, op_00_A3, op_00_A4, op_00_A5, op_00_A6, op_00_A7,
+        op_00_A8, op_00_A9, op_00_AA, op_00_AB, op_00_AC, op_00_AD, op_00_AE, op_00_AF,
+        op_00_B0, op_00_B1, op_00_B2, op_00_B3, op_00_B4, op_00_B5, op_00_B6, op_00_B7,
+        op_00_B8, op_00_B9, op_00_BA, op_00_BB, op_00_BC, op_00_BD, op_00_BE, op_00_BF,
+        op_00_C0, op_00_C1, op_00_C2, op_00_C3, op_00_C4, op_00_C5, op_00_C6, op_00_C7,
+        op_00_C8, op_00_C9, op_00_CA, op_00_CB, op_00_CC, op_00_CD, op_00_CE, op_00_CF,
+        op_00_D0, op_00_D1, op_00_D2, op_00_D3, op_00_D4, op_00_D5, op_00_D6, op_00_D7,
+        op_00_D8, op_00_D9, op_00_DA, op_00_DB, op_00_DC, op_00_DD, op_00_DE, op_00_DF,
+        op_00_E0, op_00_E1, op_00_E2, op_00_E3, op_00_E4, op_00_E5, op_00_E6, op_00_E7,
+        op_00_E8, op_00_E9, op_00_EA, op_00_EB, op_00_EC, op_00_ED, op_00_EE, op_00_EF,
+        op_00_F0, op_00_F1, op_00_F2, op_00_F3, op_00_F4, op_00_F5, op_00_F6, op_00_F7,
+        op_00_F8, op_00_F9, op_00_FA, op_00_FB, op_00_FC, op_00_FD, op_00_FE, op_00_FF };
+
+}
+
+#endif
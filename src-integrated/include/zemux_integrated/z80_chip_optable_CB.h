@@ -0,0 +1,1926 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_CB
+#define ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_CB
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+
+namespace zemux {
+
+//
+// 0x0n
+//
+
+// RLC B
+template<typename BusT>
+static void op_CB_00(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC C
+template<typename BusT>
+static void op_CB_01(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC D
+template<typename BusT>
+static void op_CB_02(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC E
+template<typename BusT>
+static void op_CB_03(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC H
+template<typename BusT>
+static void op_CB_04(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC L
+template<typename BusT>
+static void op_CB_05(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC (HL)
+template<typename BusT>
+static void op_CB_06(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_RLC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RLC A
+template<typename BusT>
+static void op_CB_07(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC B
+template<typename BusT>
+static void op_CB_08(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC C
+template<typename BusT>
+static void op_CB_09(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC D
+template<typename BusT>
+static void op_CB_0A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC E
+template<typename BusT>
+static void op_CB_0B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC H
+template<typename BusT>
+static void op_CB_0C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC L
+template<typename BusT>
+static void op_CB_0D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC (HL)
+template<typename BusT>
+static void op_CB_0E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_RRC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RRC A
+template<typename BusT>
+static void op_CB_0F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x1n
+//
+
+// RL B
+template<typename BusT>
+static void op_CB_10(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL C
+template<typename BusT>
+static void op_CB_11(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL D
+template<typename BusT>
+static void op_CB_12(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL E
+template<typename BusT>
+static void op_CB_13(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL H
+template<typename BusT>
+static void op_CB_14(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL L
+template<typename BusT>
+static void op_CB_15(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL (HL)
+template<typename BusT>
+static void op_CB_16(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_RL_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RL A
+template<typename BusT>
+static void op_CB_17(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR B
+template<typename BusT>
+static void op_CB_18(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR C
+template<typename BusT>
+static void op_CB_19(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR D
+template<typename BusT>
+static void op_CB_1A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR E
+template<typename BusT>
+static void op_CB_1B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR H
+template<typename BusT>
+static void op_CB_1C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR L
+template<typename BusT>
+static void op_CB_1D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR (HL)
+template<typename BusT>
+static void op_CB_1E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_RR_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RR A
+template<typename BusT>
+static void op_CB_1F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x2n
+//
+
+// SLA B
+template<typename BusT>
+static void op_CB_20(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA C
+template<typename BusT>
+static void op_CB_21(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA D
+template<typename BusT>
+static void op_CB_22(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA E
+template<typename BusT>
+static void op_CB_23(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA H
+template<typename BusT>
+static void op_CB_24(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA L
+template<typename BusT>
+static void op_CB_25(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA (HL)
+template<typename BusT>
+static void op_CB_26(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_SLA_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLA A
+template<typename BusT>
+static void op_CB_27(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA B
+template<typename BusT>
+static void op_CB_28(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA C
+template<typename BusT>
+static void op_CB_29(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA D
+template<typename BusT>
+static void op_CB_2A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA E
+template<typename BusT>
+static void op_CB_2B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA H
+template<typename BusT>
+static void op_CB_2C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA L
+template<typename BusT>
+static void op_CB_2D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA (HL)
+template<typename BusT>
+static void op_CB_2E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_SRA_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRA A
+template<typename BusT>
+static void op_CB_2F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x3n
+//
+
+// SLL B
+template<typename BusT>
+static void op_CB_30(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL C
+template<typename BusT>
+static void op_CB_31(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL D
+template<typename BusT>
+static void op_CB_32(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL E
+template<typename BusT>
+static void op_CB_33(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL H
+template<typename BusT>
+static void op_CB_34(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL L
+template<typename BusT>
+static void op_CB_35(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL (HL)
+template<typename BusT>
+static void op_CB_36(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_SLL_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SLL A
+template<typename BusT>
+static void op_CB_37(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL B
+template<typename BusT>
+static void op_CB_38(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL C
+template<typename BusT>
+static void op_CB_39(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL D
+template<typename BusT>
+static void op_CB_3A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL E
+template<typename BusT>
+static void op_CB_3B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL H
+template<typename BusT>
+static void op_CB_3C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL L
+template<typename BusT>
+static void op_CB_3D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL (HL)
+template<typename BusT>
+static void op_CB_3E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_MHL(cpu, Z80ChipCore<BusT>::do_SRL_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SRL A
+template<typename BusT>
+static void op_CB_3F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x4n
+//
+
+// BIT 0,B
+template<typename BusT>
+static void op_CB_40(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,C
+template<typename BusT>
+static void op_CB_41(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,D
+template<typename BusT>
+static void op_CB_42(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,E
+template<typename BusT>
+static void op_CB_43(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,H
+template<typename BusT>
+static void op_CB_44(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,L
+template<typename BusT>
+static void op_CB_45(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,(HL)
+template<typename BusT>
+static void op_CB_46(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 0);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 0,A
+template<typename BusT>
+static void op_CB_47(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 0, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,B
+template<typename BusT>
+static void op_CB_48(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,C
+template<typename BusT>
+static void op_CB_49(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,D
+template<typename BusT>
+static void op_CB_4A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,E
+template<typename BusT>
+static void op_CB_4B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,H
+template<typename BusT>
+static void op_CB_4C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,L
+template<typename BusT>
+static void op_CB_4D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,(HL)
+template<typename BusT>
+static void op_CB_4E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 1);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 1,A
+template<typename BusT>
+static void op_CB_4F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 1, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x5n
+//
+
+// BIT 2,B
+template<typename BusT>
+static void op_CB_50(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,C
+template<typename BusT>
+static void op_CB_51(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,D
+template<typename BusT>
+static void op_CB_52(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,E
+template<typename BusT>
+static void op_CB_53(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,H
+template<typename BusT>
+static void op_CB_54(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,L
+template<typename BusT>
+static void op_CB_55(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,(HL)
+template<typename BusT>
+static void op_CB_56(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 2);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 2,A
+template<typename BusT>
+static void op_CB_57(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 2, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,B
+template<typename BusT>
+static void op_CB_58(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,C
+template<typename BusT>
+static void op_CB_59(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,D
+template<typename BusT>
+static void op_CB_5A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,E
+template<typename BusT>
+static void op_CB_5B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,H
+template<typename BusT>
+static void op_CB_5C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,L
+template<typename BusT>
+static void op_CB_5D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,(HL)
+template<typename BusT>
+static void op_CB_5E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 3);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 3,A
+template<typename BusT>
+static void op_CB_5F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 3, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x6n
+//
+
+// BIT 4,B
+template<typename BusT>
+static void op_CB_60(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,C
+template<typename BusT>
+static void op_CB_61(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,D
+template<typename BusT>
+static void op_CB_62(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,E
+template<typename BusT>
+static void op_CB_63(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,H
+template<typename BusT>
+static void op_CB_64(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,L
+template<typename BusT>
+static void op_CB_65(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,(HL)
+template<typename BusT>
+static void op_CB_66(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 4);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 4,A
+template<typename BusT>
+static void op_CB_67(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 4, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,B
+template<typename BusT>
+static void op_CB_68(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,C
+template<typename BusT>
+static void op_CB_69(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,D
+template<typename BusT>
+static void op_CB_6A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,E
+template<typename BusT>
+static void op_CB_6B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,H
+template<typename BusT>
+static void op_CB_6C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,L
+template<typename BusT>
+static void op_CB_6D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,(HL)
+template<typename BusT>
+static void op_CB_6E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 5);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 5,A
+template<typename BusT>
+static void op_CB_6F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 5, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x7n
+//
+
+// BIT 6,B
+template<typename BusT>
+static void op_CB_70(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,C
+template<typename BusT>
+static void op_CB_71(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,D
+template<typename BusT>
+static void op_CB_72(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,E
+template<typename BusT>
+static void op_CB_73(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,H
+template<typename BusT>
+static void op_CB_74(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,L
+template<typename BusT>
+static void op_CB_75(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,(HL)
+template<typename BusT>
+static void op_CB_76(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 6);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 6,A
+template<typename BusT>
+static void op_CB_77(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 6, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,B
+template<typename BusT>
+static void op_CB_78(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,C
+template<typename BusT>
+static void op_CB_79(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,D
+template<typename BusT>
+static void op_CB_7A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,E
+template<typename BusT>
+static void op_CB_7B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,H
+template<typename BusT>
+static void op_CB_7C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.H);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,L
+template<typename BusT>
+static void op_CB_7D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.L);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,(HL)
+template<typename BusT>
+static void op_CB_7E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_MHL(cpu, 7);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// BIT 7,A
+template<typename BusT>
+static void op_CB_7F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_R(cpu, 7, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x8n
+//
+
+// RES 0,B
+template<typename BusT>
+static void op_CB_80(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,C
+template<typename BusT>
+static void op_CB_81(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,D
+template<typename BusT>
+static void op_CB_82(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,E
+template<typename BusT>
+static void op_CB_83(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,H
+template<typename BusT>
+static void op_CB_84(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,L
+template<typename BusT>
+static void op_CB_85(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,(HL)
+template<typename BusT>
+static void op_CB_86(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 0);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 0,A
+template<typename BusT>
+static void op_CB_87(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 0, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,B
+template<typename BusT>
+static void op_CB_88(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,C
+template<typename BusT>
+static void op_CB_89(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,D
+template<typename BusT>
+static void op_CB_8A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,E
+template<typename BusT>
+static void op_CB_8B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,H
+template<typename BusT>
+static void op_CB_8C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,L
+template<typename BusT>
+static void op_CB_8D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,(HL)
+template<typename BusT>
+static void op_CB_8E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 1);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 1,A
+template<typename BusT>
+static void op_CB_8F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 1, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x9n
+//
+
+// RES 2,B
+template<typename BusT>
+static void op_CB_90(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,C
+template<typename BusT>
+static void op_CB_91(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,D
+template<typename BusT>
+static void op_CB_92(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,E
+template<typename BusT>
+static void op_CB_93(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,H
+template<typename BusT>
+static void op_CB_94(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,L
+template<typename BusT>
+static void op_CB_95(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,(HL)
+template<typename BusT>
+static void op_CB_96(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 2);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 2,A
+template<typename BusT>
+static void op_CB_97(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 2, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,B
+template<typename BusT>
+static void op_CB_98(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,C
+template<typename BusT>
+static void op_CB_99(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,D
+template<typename BusT>
+static void op_CB_9A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,E
+template<typename BusT>
+static void op_CB_9B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,H
+template<typename BusT>
+static void op_CB_9C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,L
+template<typename BusT>
+static void op_CB_9D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,(HL)
+template<typename BusT>
+static void op_CB_9E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 3);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 3,A
+template<typename BusT>
+static void op_CB_9F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 3, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xAn
+//
+
+// RES 4,B
+template<typename BusT>
+static void op_CB_A0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,C
+template<typename BusT>
+static void op_CB_A1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,D
+template<typename BusT>
+static void op_CB_A2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,E
+template<typename BusT>
+static void op_CB_A3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,H
+template<typename BusT>
+static void op_CB_A4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,L
+template<typename BusT>
+static void op_CB_A5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,(HL)
+template<typename BusT>
+static void op_CB_A6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 4);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 4,A
+template<typename BusT>
+static void op_CB_A7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 4, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,B
+template<typename BusT>
+static void op_CB_A8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,C
+template<typename BusT>
+static void op_CB_A9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,D
+template<typename BusT>
+static void op_CB_AA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,E
+template<typename BusT>
+static void op_CB_AB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,H
+template<typename BusT>
+static void op_CB_AC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,L
+template<typename BusT>
+static void op_CB_AD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,(HL)
+template<typename BusT>
+static void op_CB_AE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 5);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 5,A
+template<typename BusT>
+static void op_CB_AF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 5, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xBn
+//
+
+// RES 6,B
+template<typename BusT>
+static void op_CB_B0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,C
+template<typename BusT>
+static void op_CB_B1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,D
+template<typename BusT>
+static void op_CB_B2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,E
+template<typename BusT>
+static void op_CB_B3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,H
+template<typename BusT>
+static void op_CB_B4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,L
+template<typename BusT>
+static void op_CB_B5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,(HL)
+template<typename BusT>
+static void op_CB_B6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 6);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 6,A
+template<typename BusT>
+static void op_CB_B7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 6, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,B
+template<typename BusT>
+static void op_CB_B8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,C
+template<typename BusT>
+static void op_CB_B9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,D
+template<typename BusT>
+static void op_CB_BA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,E
+template<typename BusT>
+static void op_CB_BB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,H
+template<typename BusT>
+static void op_CB_BC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,L
+template<typename BusT>
+static void op_CB_BD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,(HL)
+template<typename BusT>
+static void op_CB_BE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_MHL(cpu, 7);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// RES 7,A
+template<typename BusT>
+static void op_CB_BF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_R(cpu, 7, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xCn
+//
+
+// SET 0,B
+template<typename BusT>
+static void op_CB_C0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,C
+template<typename BusT>
+static void op_CB_C1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,D
+template<typename BusT>
+static void op_CB_C2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,E
+template<typename BusT>
+static void op_CB_C3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,H
+template<typename BusT>
+static void op_CB_C4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,L
+template<typename BusT>
+static void op_CB_C5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,(HL)
+template<typename BusT>
+static void op_CB_C6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 0);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 0,A
+template<typename BusT>
+static void op_CB_C7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 0, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,B
+template<typename BusT>
+static void op_CB_C8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,C
+template<typename BusT>
+static void op_CB_C9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,D
+template<typename BusT>
+static void op_CB_CA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,E
+template<typename BusT>
+static void op_CB_CB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,H
+template<typename BusT>
+static void op_CB_CC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,L
+template<typename BusT>
+static void op_CB_CD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,(HL)
+template<typename BusT>
+static void op_CB_CE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 1);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 1,A
+template<typename BusT>
+static void op_CB_CF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 1, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xDn
+//
+
+// SET 2,B
+template<typename BusT>
+static void op_CB_D0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,C
+template<typename BusT>
+static void op_CB_D1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,D
+template<typename BusT>
+static void op_CB_D2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,E
+template<typename BusT>
+static void op_CB_D3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,H
+template<typename BusT>
+static void op_CB_D4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,L
+template<typename BusT>
+static void op_CB_D5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,(HL)
+template<typename BusT>
+static void op_CB_D6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 2);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 2,A
+template<typename BusT>
+static void op_CB_D7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 2, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,B
+template<typename BusT>
+static void op_CB_D8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,C
+template<typename BusT>
+static void op_CB_D9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,D
+template<typename BusT>
+static void op_CB_DA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,E
+template<typename BusT>
+static void op_CB_DB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,H
+template<typename BusT>
+static void op_CB_DC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,L
+template<typename BusT>
+static void op_CB_DD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,(HL)
+template<typename BusT>
+static void op_CB_DE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 3);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 3,A
+template<typename BusT>
+static void op_CB_DF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 3, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xEn
+//
+
+// SET 4,B
+template<typename BusT>
+static void op_CB_E0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,C
+template<typename BusT>
+static void op_CB_E1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,D
+template<typename BusT>
+static void op_CB_E2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,E
+template<typename BusT>
+static void op_CB_E3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,H
+template<typename BusT>
+static void op_CB_E4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,L
+template<typename BusT>
+static void op_CB_E5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,(HL)
+template<typename BusT>
+static void op_CB_E6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 4);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 4,A
+template<typename BusT>
+static void op_CB_E7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 4, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,B
+template<typename BusT>
+static void op_CB_E8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,C
+template<typename BusT>
+static void op_CB_E9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,D
+template<typename BusT>
+static void op_CB_EA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,E
+template<typename BusT>
+static void op_CB_EB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,H
+template<typename BusT>
+static void op_CB_EC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,L
+template<typename BusT>
+static void op_CB_ED(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,(HL)
+template<typename BusT>
+static void op_CB_EE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 5);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 5,A
+template<typename BusT>
+static void op_CB_EF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 5, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xFn
+//
+
+// SET 6,B
+template<typename BusT>
+static void op_CB_F0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,C
+template<typename BusT>
+static void op_CB_F1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,D
+template<typename BusT>
+static void op_CB_F2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,E
+template<typename BusT>
+static void op_CB_F3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,H
+template<typename BusT>
+static void op_CB_F4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,L
+template<typename BusT>
+static void op_CB_F5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,(HL)
+template<typename BusT>
+static void op_CB_F6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 6);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 6,A
+template<typename BusT>
+static void op_CB_F7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 6, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,B
+template<typename BusT>
+static void op_CB_F8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,C
+template<typename BusT>
+static void op_CB_F9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,D
+template<typename BusT>
+static void op_CB_FA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,E
+template<typename BusT>
+static void op_CB_FB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,H
+template<typename BusT>
+static void op_CB_FC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.H));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,L
+template<typename BusT>
+static void op_CB_FD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.L));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,(HL)
+template<typename BusT>
+static void op_CB_FE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_MHL(cpu, 7);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SET 7,A
+template<typename BusT>
+static void op_CB_FF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_R(cpu, 7, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+template<typename BusT>
+typename BasicZ80Chip<BusT>::Opcode Z80ChipOptables<BusT>::tableCB[0x100] = {
+        op_CB_00, op_CB_01, op_CB_02, op_CB_03, op_CB_04, op_CB_05, op_CB_06, op_CB_07,
+        op_CB_08, op_CB_09, op_CB_0A, op_CB_0B, op_CB_0C, op_CB_0D, op_CB_0E, op_CB_0F,
+        op_CB_10, op_CB_11, op_CB_12, op_CB_13, op_CB_14, op_CB_15, op_CB_16, op_CB_17,
+        op_CB_18, op_CB_19, op_CB_1A, op_CB_1B, op_CB_1C, op_CB_1D, op_CB_1E, op_CB_1F,
+        op_CB_20, op_CB_21, op_CB_22, op_CB_23, op_CB_24, op_CB_25, op_CB_26, op_CB_27,
+        op_CB_28, op_CB_29, op_CB_2A, op_CB_2B, op_CB_2C, op_CB_2D, op_CB_2E, op_CB_2F,
+        op_CB_30, op_CB_31, op_CB_32, op_CB_33, op_CB_34, op_CB_35, op_CB_36, op_CB_37,
+        op_CB_38, op_CB_39, op_CB_3A, op_CB_3B, op_CB_3C, op_CB_3D, op_CB_3E, op_CB_3F,
+        op_CB_40, op_CB_41, op_CB_42, op_CB_43, op_CB_44, op_CB_45, op_CB_46, op_CB_47,
+        op_CB_48, op_CB_49, op_CB_4A, op_CB_4B, op_CB_4C, op_CB_4D, op_CB_4E, op_CB_4F,
+        op_CB_50, op_CB_51, op_CB_52, op_CB_53, op_CB_54, op_CB_55, op_CB_56, op_CB_57,
+        op_CB_58, op_CB_59, op_CB_5A, op_CB_5B, op_CB_5C, op_CB_5D, op_CB_5E, op_CB_5F,
+        op_CB_60, op_CB_61, op_CB_62, op_CB_63, op_CB_64, op_CB_65, op_CB_66, op_CB_67,
+        op_CB_68, op_CB_69, op_CB_6A, op_CB_6B, op_CB_6C, op_CB_6D, op_CB_6E, op_CB_6F,
+        op_CB_70, op_CB_71, op_CB_72, op_CB_73, op_CB_74, op_CB_75, op_CB_76, op_CB_77,
+        op_CB_78, op_CB_79, op_CB_7A, op_CB_7B, op_CB_7C, op_CB_7D, op_CB_7E, op_CB_7F,
+        op_CB_80, op_CB_81, op_CB_82, op_CB_83, op_CB_84, op_CB_85, op_CB_86, op_CB_87,
+        op_CB_88, op_CB_89, op_CB_8A, op_CB_8B, op_CB_8C, op_CB_8D, op_CB_8E, op_CB_8F,
+        op_CB_90, op_CB_91, op_CB_92, op_CB_93, op_CB_94, op_CB_95, op_CB_96, op_CB_97,
+        op_CB_98, op_CB_99, op_CB_9A, op_CB_9B, op_CB_9C, op_CB_9D, op_CB_9E, op_CB_9F,
+        op_CB_A0, op_CB_A1, op_CB_A2, op_CB_A3, op_CB_A4, op_CB_A5, op_CB_A6, op_CB_A7,
+        op_CB_A8, op_CB_A9, op_CB_AA, op_CB_AB, op_CB_AC, op_CB_AD, op_CB_AE, op_CB_AF,
+        op_CB_B0, op_CB_B1, op_CB_B2, op_CB_B3, op_CB_B4, op_CB_B5, op_CB_B6, op_CB_B7,
+        op_CB_B8, op_CB_B9, op_CB_BA, op_CB_BB, op_CB_BC, op_CB_BD, op_CB_BE, op_CB_BF,
+        op_CB_C0, op_CB_C1, op_CB_C2, op_CB_C3, op_CB_C4, op_CB_C5, op_CB_C6, op_CB_C7,
+        op_CB_C8, op_CB_C9, op_CB_CA, op_CB_CB, op_CB_CC, op_CB_CD, op_CB_CE, op_CB_CF,
+        op_CB_D0, op_CB_D1, op_CB_D2, op_CB_D3, op_CB_D4, op_CB_D5, op_CB_D6, op_CB_D7,
+        op_CB_D8, op_CB_D9, op_CB_DA, op_CB_DB, op_CB_DC, op_CB_DD, op_CB_DE, op_CB_DF,
+        op_CB_E0, op_CB_E1, op_CB_E2, op_CB_E3, op_CB_E4, op_CB_E5, op_CB_E6, op_CB_E7,
+        op_CB_E8, op_CB_E9, op_CB_EA, op_CB_EB, op_CB_EC, op_CB_ED, op_CB_EE, op_CB_EF,
+        op_CB_F0, op_CB_F1, op_CB_F2, op_CB_F3, op_CB_F4, op_CB_F5, op_CB_F6, op_CB_F7,
+        op_CB_F8, op_CB_F9, op_CB_FA, op_CB_FB, op_CB_FC, op_CB_FD, op_CB_FE, op_CB_FF };
+
+}
+
+#endif
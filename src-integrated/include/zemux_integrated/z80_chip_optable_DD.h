@@ -0,0 +1,1897 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_DD
+#define ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_DD
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+
+namespace zemux {
+
+//
+// 0x0n
+//
+
+// *NOP
+template<typename BusT>
+static void op_DD_00(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_NOP(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD BC,NN
+template<typename BusT>
+static void op_DD_01(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (BC),A
+template<typename BusT>
+static void op_DD_02(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC BC
+template<typename BusT>
+static void op_DD_03(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC B
+template<typename BusT>
+static void op_DD_04(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC B
+template<typename BusT>
+static void op_DD_05(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,N
+template<typename BusT>
+static void op_DD_06(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RLCA
+template<typename BusT>
+static void op_DD_07(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLCA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EX AF,AF'
+template<typename BusT>
+static void op_DD_08(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_AF_AF_(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IX,BC
+template<typename BusT>
+static void op_DD_09(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IX), cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(BC)
+template<typename BusT>
+static void op_DD_0A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC BC
+template<typename BusT>
+static void op_DD_0B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC C
+template<typename BusT>
+static void op_DD_0C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC C
+template<typename BusT>
+static void op_DD_0D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,N
+template<typename BusT>
+static void op_DD_0E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RRCA
+template<typename BusT>
+static void op_DD_0F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRCA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x1n
+//
+
+// *DJNZ O
+template<typename BusT>
+static void op_DD_10(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DJNZ(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD DE,NN
+template<typename BusT>
+static void op_DD_11(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (DE),A
+template<typename BusT>
+static void op_DD_12(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC DE
+template<typename BusT>
+static void op_DD_13(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC D
+template<typename BusT>
+static void op_DD_14(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC D
+template<typename BusT>
+static void op_DD_15(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,N
+template<typename BusT>
+static void op_DD_16(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RLA
+template<typename BusT>
+static void op_DD_17(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR O
+template<typename BusT>
+static void op_DD_18(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IX,DE
+template<typename BusT>
+static void op_DD_19(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IX), cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(DE)
+template<typename BusT>
+static void op_DD_1A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC DE
+template<typename BusT>
+static void op_DD_1B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC E
+template<typename BusT>
+static void op_DD_1C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC E
+template<typename BusT>
+static void op_DD_1D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,N
+template<typename BusT>
+static void op_DD_1E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RRA
+template<typename BusT>
+static void op_DD_1F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x2n
+//
+
+// *JR NZ,O
+template<typename BusT>
+static void op_DD_20(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IX,NN
+template<typename BusT>
+static void op_DD_21(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD (NN),IX
+template<typename BusT>
+static void op_DD_22(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_RP(cpu, cpu->regs.IX);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IX
+template<typename BusT>
+static void op_DD_23(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IXH
+template<typename BusT>
+static void op_DD_24(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.IXH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IXH
+template<typename BusT>
+static void op_DD_25(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.IXH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,N
+template<typename BusT>
+static void op_DD_26(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.IXH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DAA
+template<typename BusT>
+static void op_DD_27(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DAA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR Z,O
+template<typename BusT>
+static void op_DD_28(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IX,IX
+template<typename BusT>
+static void op_DD_29(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IX), cpu->regs.IX);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IX,(NN)
+template<typename BusT>
+static void op_DD_2A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_MNN(cpu, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IX
+template<typename BusT>
+static void op_DD_2B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IXL
+template<typename BusT>
+static void op_DD_2C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.IXL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IXL
+template<typename BusT>
+static void op_DD_2D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.IXL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,N
+template<typename BusT>
+static void op_DD_2E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.IXL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CPL
+template<typename BusT>
+static void op_DD_2F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CPL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x3n
+//
+
+// *JR NC,O
+template<typename BusT>
+static void op_DD_30(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD SP,NN
+template<typename BusT>
+static void op_DD_31(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (NN),A
+template<typename BusT>
+static void op_DD_32(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_A(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC SP
+template<typename BusT>
+static void op_DD_33(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC (IX+N)
+template<typename BusT>
+static void op_DD_34(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_ORP_P00(cpu, Z80ChipCore<BusT>::do_INC_8, cpu->regs.IX);
+}
+
+// DEC (IX+N)
+template<typename BusT>
+static void op_DD_35(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_ORP_P00(cpu, Z80ChipCore<BusT>::do_DEC_8, cpu->regs.IX);
+}
+
+// LD (IX+N),N
+template<typename BusT>
+static void op_DD_36(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_N_P00(cpu, cpu->regs.IX);
+}
+
+// *SCF
+template<typename BusT>
+static void op_DD_37(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SCF(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR C,O
+template<typename BusT>
+static void op_DD_38(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IX,SP
+template<typename BusT>
+static void op_DD_39(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IX), cpu->regs.SP);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(NN)
+template<typename BusT>
+static void op_DD_3A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MNN(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC SP
+template<typename BusT>
+static void op_DD_3B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC A
+template<typename BusT>
+static void op_DD_3C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC A
+template<typename BusT>
+static void op_DD_3D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,N
+template<typename BusT>
+static void op_DD_3E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CCF
+template<typename BusT>
+static void op_DD_3F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CCF(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x4n
+//
+
+// *LD B,B
+template<typename BusT>
+static void op_DD_40(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,C
+template<typename BusT>
+static void op_DD_41(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,D
+template<typename BusT>
+static void op_DD_42(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,E
+template<typename BusT>
+static void op_DD_43(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,IXH
+template<typename BusT>
+static void op_DD_44(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,IXL
+template<typename BusT>
+static void op_DD_45(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,(IX+N)
+template<typename BusT>
+static void op_DD_46(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// *LD B,A
+template<typename BusT>
+static void op_DD_47(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,B
+template<typename BusT>
+static void op_DD_48(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,C
+template<typename BusT>
+static void op_DD_49(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,D
+template<typename BusT>
+static void op_DD_4A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,E
+template<typename BusT>
+static void op_DD_4B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,IXH
+template<typename BusT>
+static void op_DD_4C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,IXL
+template<typename BusT>
+static void op_DD_4D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,(IX+N)
+template<typename BusT>
+static void op_DD_4E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// *LD C,A
+template<typename BusT>
+static void op_DD_4F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x5n
+//
+
+// *LD D,B
+template<typename BusT>
+static void op_DD_50(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,C
+template<typename BusT>
+static void op_DD_51(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,D
+template<typename BusT>
+static void op_DD_52(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,E
+template<typename BusT>
+static void op_DD_53(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,IXH
+template<typename BusT>
+static void op_DD_54(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,IXL
+template<typename BusT>
+static void op_DD_55(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,(IX+N)
+template<typename BusT>
+static void op_DD_56(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// *LD D,A
+template<typename BusT>
+static void op_DD_57(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,B
+template<typename BusT>
+static void op_DD_58(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,C
+template<typename BusT>
+static void op_DD_59(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,D
+template<typename BusT>
+static void op_DD_5A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,E
+template<typename BusT>
+static void op_DD_5B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,IXH
+template<typename BusT>
+static void op_DD_5C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,IXL
+template<typename BusT>
+static void op_DD_5D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,(IX+N)
+template<typename BusT>
+static void op_DD_5E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// *LD E,A
+template<typename BusT>
+static void op_DD_5F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x6n
+//
+
+// LD IXH,B
+template<typename BusT>
+static void op_DD_60(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,C
+template<typename BusT>
+static void op_DD_61(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,D
+template<typename BusT>
+static void op_DD_62(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,E
+template<typename BusT>
+static void op_DD_63(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,H
+template<typename BusT>
+static void op_DD_64(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXH,L
+template<typename BusT>
+static void op_DD_65(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD H,(IX+N)
+template<typename BusT>
+static void op_DD_66(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD IXH,A
+template<typename BusT>
+static void op_DD_67(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXH), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,B
+template<typename BusT>
+static void op_DD_68(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,C
+template<typename BusT>
+static void op_DD_69(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,D
+template<typename BusT>
+static void op_DD_6A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,E
+template<typename BusT>
+static void op_DD_6B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,H
+template<typename BusT>
+static void op_DD_6C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IXL,L
+template<typename BusT>
+static void op_DD_6D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD L,(IX+N)
+template<typename BusT>
+static void op_DD_6E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// LD IXL,A
+template<typename BusT>
+static void op_DD_6F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IXL), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x7n
+//
+
+// LD (IX+N),B
+template<typename BusT>
+static void op_DD_70(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.B);
+}
+
+// LD (IX+N),C
+template<typename BusT>
+static void op_DD_71(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.C);
+}
+
+// LD (IX+N),D
+template<typename BusT>
+static void op_DD_72(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.D);
+}
+
+// LD (IX+N),E
+template<typename BusT>
+static void op_DD_73(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.E);
+}
+
+// LD (IX+N),H
+template<typename BusT>
+static void op_DD_74(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.H);
+}
+
+// LD (IX+N),L
+template<typename BusT>
+static void op_DD_75(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.L);
+}
+
+// *HALT
+template<typename BusT>
+static void op_DD_76(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_HALT(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD (IX+N),A
+template<typename BusT>
+static void op_DD_77(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IX, cpu->regs.A);
+}
+
+// *LD A,B
+template<typename BusT>
+static void op_DD_78(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,C
+template<typename BusT>
+static void op_DD_79(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,D
+template<typename BusT>
+static void op_DD_7A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,E
+template<typename BusT>
+static void op_DD_7B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,IXH
+template<typename BusT>
+static void op_DD_7C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,IXL
+template<typename BusT>
+static void op_DD_7D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,(IX+N)
+template<typename BusT>
+static void op_DD_7E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// *LD A,A
+template<typename BusT>
+static void op_DD_7F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x8n
+//
+
+// *ADD A,B
+template<typename BusT>
+static void op_DD_80(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,C
+template<typename BusT>
+static void op_DD_81(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,D
+template<typename BusT>
+static void op_DD_82(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,E
+template<typename BusT>
+static void op_DD_83(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,IXH
+template<typename BusT>
+static void op_DD_84(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,IXL
+template<typename BusT>
+static void op_DD_85(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,(IX+N)
+template<typename BusT>
+static void op_DD_86(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IX);
+}
+
+// *ADD A,A
+template<typename BusT>
+static void op_DD_87(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,B
+template<typename BusT>
+static void op_DD_88(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,C
+template<typename BusT>
+static void op_DD_89(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,D
+template<typename BusT>
+static void op_DD_8A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,E
+template<typename BusT>
+static void op_DD_8B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,IXH
+template<typename BusT>
+static void op_DD_8C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,IXL
+template<typename BusT>
+static void op_DD_8D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,(IX+N)
+template<typename BusT>
+static void op_DD_8E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IX);
+}
+
+// *ADC A,A
+template<typename BusT>
+static void op_DD_8F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x9n
+//
+
+// *SUB B
+template<typename BusT>
+static void op_DD_90(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB C
+template<typename BusT>
+static void op_DD_91(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB D
+template<typename BusT>
+static void op_DD_92(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB E
+template<typename BusT>
+static void op_DD_93(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB IXH
+template<typename BusT>
+static void op_DD_94(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB IXL
+template<typename BusT>
+static void op_DD_95(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB (IX+N)
+template<typename BusT>
+static void op_DD_96(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IX);
+}
+
+// *SUB A
+template<typename BusT>
+static void op_DD_97(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,B
+template<typename BusT>
+static void op_DD_98(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,C
+template<typename BusT>
+static void op_DD_99(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,D
+template<typename BusT>
+static void op_DD_9A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,E
+template<typename BusT>
+static void op_DD_9B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,IXH
+template<typename BusT>
+static void op_DD_9C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,IXL
+template<typename BusT>
+static void op_DD_9D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,(IX+N)
+template<typename BusT>
+static void op_DD_9E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IX);
+}
+
+// *SBC A,A
+template<typename BusT>
+static void op_DD_9F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xAn
+//
+
+// *AND B
+template<typename BusT>
+static void op_DD_A0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND C
+template<typename BusT>
+static void op_DD_A1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND D
+template<typename BusT>
+static void op_DD_A2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND E
+template<typename BusT>
+static void op_DD_A3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND IXH
+template<typename BusT>
+static void op_DD_A4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND IXL
+template<typename BusT>
+static void op_DD_A5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND (IX+N)
+template<typename BusT>
+static void op_DD_A6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IX);
+}
+
+// *AND A
+template<typename BusT>
+static void op_DD_A7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR B
+template<typename BusT>
+static void op_DD_A8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR C
+template<typename BusT>
+static void op_DD_A9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR D
+template<typename BusT>
+static void op_DD_AA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR E
+template<typename BusT>
+static void op_DD_AB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR IXH
+template<typename BusT>
+static void op_DD_AC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR IXL
+template<typename BusT>
+static void op_DD_AD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR (IX+N)
+template<typename BusT>
+static void op_DD_AE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IX);
+}
+
+// *XOR A
+template<typename BusT>
+static void op_DD_AF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xBn
+//
+
+// *OR B
+template<typename BusT>
+static void op_DD_B0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR C
+template<typename BusT>
+static void op_DD_B1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR D
+template<typename BusT>
+static void op_DD_B2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR E
+template<typename BusT>
+static void op_DD_B3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR IXH
+template<typename BusT>
+static void op_DD_B4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR IXL
+template<typename BusT>
+static void op_DD_B5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR (IX+N)
+template<typename BusT>
+static void op_DD_B6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IX);
+}
+
+// *OR A
+template<typename BusT>
+static void op_DD_B7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP B
+template<typename BusT>
+static void op_DD_B8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP C
+template<typename BusT>
+static void op_DD_B9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP D
+template<typename BusT>
+static void op_DD_BA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP E
+template<typename BusT>
+static void op_DD_BB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP IXH
+template<typename BusT>
+static void op_DD_BC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IXH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP IXL
+template<typename BusT>
+static void op_DD_BD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IXL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP (IX+N)
+template<typename BusT>
+static void op_DD_BE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IX);
+}
+
+// *CP A
+template<typename BusT>
+static void op_DD_BF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xCn
+//
+
+// *RET NZ
+template<typename BusT>
+static void op_DD_C0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP BC
+template<typename BusT>
+static void op_DD_C1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NZ,NN
+template<typename BusT>
+static void op_DD_C2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NN
+template<typename BusT>
+static void op_DD_C3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NZ,NN
+template<typename BusT>
+static void op_DD_C4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH BC
+template<typename BusT>
+static void op_DD_C5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,N
+template<typename BusT>
+static void op_DD_C6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADD_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #00
+template<typename BusT>
+static void op_DD_C7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x00);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET Z
+template<typename BusT>
+static void op_DD_C8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET
+template<typename BusT>
+static void op_DD_C9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP Z,NN
+template<typename BusT>
+static void op_DD_CA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #DD_CB
+template<typename BusT>
+static void op_DD_CB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_XX_CB(cpu, Z80ChipOptables<BusT>::tableDD_CB);
+}
+
+// *CALL Z,NN
+template<typename BusT>
+static void op_DD_CC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NN
+template<typename BusT>
+static void op_DD_CD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,N
+template<typename BusT>
+static void op_DD_CE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #08
+template<typename BusT>
+static void op_DD_CF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x08);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xDn
+//
+
+// *RET NC
+template<typename BusT>
+static void op_DD_D0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP DE
+template<typename BusT>
+static void op_DD_D1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NC,NN
+template<typename BusT>
+static void op_DD_D2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OUT (N),A
+template<typename BusT>
+static void op_DD_D3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_OUT_N_A(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NC,NN
+template<typename BusT>
+static void op_DD_D4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH DE
+template<typename BusT>
+static void op_DD_D5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB N
+template<typename BusT>
+static void op_DD_D6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SUB_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #10
+template<typename BusT>
+static void op_DD_D7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x10);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET C
+template<typename BusT>
+static void op_DD_D8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EXX
+template<typename BusT>
+static void op_DD_D9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EXX(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP C,NN
+template<typename BusT>
+static void op_DD_DA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *IN A,(N)
+template<typename BusT>
+static void op_DD_DB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_IN_A_N(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL C,NN
+template<typename BusT>
+static void op_DD_DC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #DD
+template<typename BusT>
+static void op_DD_DD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_DD(cpu);
+}
+
+// *SBC A,N
+template<typename BusT>
+static void op_DD_DE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SBC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #18
+template<typename BusT>
+static void op_DD_DF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x18);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xEn
+//
+
+// *RET PO
+template<typename BusT>
+static void op_DD_E0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// POP IX
+template<typename BusT>
+static void op_DD_E1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP PO,NN
+template<typename BusT>
+static void op_DD_E2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// EX (SP),IX
+template<typename BusT>
+static void op_DD_E3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_MSP_RP(cpu, &(cpu->regs.IX));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL PO,NN
+template<typename BusT>
+static void op_DD_E4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// PUSH IX
+template<typename BusT>
+static void op_DD_E5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.IX);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND N
+template<typename BusT>
+static void op_DD_E6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_AND_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #20
+template<typename BusT>
+static void op_DD_E7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x20);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET PE
+template<typename BusT>
+static void op_DD_E8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// JP IX
+template<typename BusT>
+static void op_DD_E9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_RP(cpu, cpu->regs.IX);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP PE,NN
+template<typename BusT>
+static void op_DD_EA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EX DE,HL
+template<typename BusT>
+static void op_DD_EB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_DE_HL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL PE,NN
+template<typename BusT>
+static void op_DD_EC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #ED
+template<typename BusT>
+static void op_DD_ED(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_ED(cpu);
+}
+
+// *XOR N
+template<typename BusT>
+static void op_DD_EE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_XOR_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #28
+template<typename BusT>
+static void op_DD_EF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x28);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xFn
+//
+
+// *RET P
+template<typename BusT>
+static void op_DD_F0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP AF
+template<typename BusT>
+static void op_DD_F1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.AF));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP P,NN
+template<typename BusT>
+static void op_DD_F2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DI
+template<typename BusT>
+static void op_DD_F3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DI(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL P,NN
+template<typename BusT>
+static void op_DD_F4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH AF
+template<typename BusT>
+static void op_DD_F5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.AF);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR N
+template<typename BusT>
+static void op_DD_F6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_OR_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #30
+template<typename BusT>
+static void op_DD_F7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x30);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET M
+template<typename BusT>
+static void op_DD_F8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD SP,IX
+template<typename BusT>
+static void op_DD_F9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SP_RP(cpu, cpu->regs.IX);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP M,NN
+template<typename BusT>
+static void op_DD_FA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EI
+template<typename BusT>
+static void op_DD_FB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EI(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL M,NN
+template<typename BusT>
+static void op_DD_FC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #FD
+template<typename BusT>
+static void op_DD_FD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_FD(cpu);
+}
+
+// *CP N
+template<typename BusT>
+static void op_DD_FE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_CP_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #38
+template<typename BusT>
+static void op_DD_FF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x38);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+template<typename BusT>
+typename BasicZ80Chip<BusT>::Opcode Z80ChipOptables<BusT>::tableDD[0x100] = {
+        op_DD_00, op_DD_01, op_DD_02, op_DD_03, op_DD_04, op_DD_05, op_DD_06, op_DD_07,
+        op_DD_08, op_DD_09, op_DD_0A, op_DD_0B, op_DD_0C, op_DD_0D, op_DD_0E, op_DD_0F,
+        op_DD_10, op_DD_11, op_DD_12, op_DD_13, op_DD_14, op_DD_15, op_DD_16, op_DD_17,
+        op_DD_18, op_DD_19, op_DD_1A, op_DD_1B, op_DD_1C, op_DD_1D, op_DD_1E, op_DD_1F,
+        op_DD_20, op_DD_21, op_DD_22, op_DD_23, op_DD_24, op_DD_25, op_DD_26, op_DD_27,
+        op_DD_28, op_DD_29, op_DD_2A, op_DD_2B, op_DD_2C, op_DD_2D, op_DD_2E, op_DD_2F,
+        op_DD_30, op_DD_31, op_DD_32, op_DD_33, op_DD_34, op_DD_35, op_DD_36, op_DD_37,
+        op_DD_38, op_DD_39, op_DD_3A, op_DD_3B, op_DD_3C, op_DD_3D, op_DD_3E, op_DD_3F,
+        op_DD_40, op_DD_41, op_DD_42, op_DD_43, op_DD_44, op_DD_45, op_DD_46, op_DD_47,
+        op_DD_48, op_DD_49, op_DD_4A, op_DD_4B, op_DD_4C, op_DD_4D, op_DD_4E, op_DD_4F,
+        op_DD_50, op_DD_51, op_DD_52, op_DD_53, op_DD_54, op_DD_55, op_DD_56, op_DD_57,
+        op_DD_58, op_DD_59, op_DD_5A, op_DD_5B, op_DD_5C, op_DD_5D, op_DD_5E, op_DD_5F,
+        op_DD_60, op_DD_61, op_DD_62, op_DD_63, op_DD_64, op_DD_65, op_DD_66, op_DD_67,
+        op_DD_68, op_DD_69, op_DD_6A, op_DD_6B, op_DD_6C, op_DD_6D, op_DD_6E, op_DD_6F,
+        op_DD_70, op_DD_71, op_DD_72, op_DD_73, op_DD_74, op_DD_75, op_DD_76, op_DD_77,
+        op_DD_78, op_DD_79, op_DD_7A, op_DD_7B, op_DD_7C, op_DD_7D, op_DD_7E, op_DD_7F,
+        op_DD_80, op_DD_81, op_DD_82, op_DD_83, op_DD_84, op_DD_85, op_DD_86, op_DD_87,
+        op_DD_88, op_DD_89, op_DD_8A, op_DD_8B, op_DD_8C, op_DD_8D, op_DD_8E, op_DD_8F,
+        op_DD_90, op_DD_91, op_DD_92, op_DD_93, op_DD_94, op_DD_95, op_DD_96, op_DD_97,
+        op_DD_98, op_DD_99, op_DD_9A, op_DD_9B, op_DD_9C, op_DD_9D, op_DD_9E, op_DD_9F,
+        op_DD_A0, op_DD_A1, op_DD_A2, op_DD_A3, op_DD_A4, op_DD_A5, op_DD_A6, op_DD_A7,
+        op_DD_A8, op_DD_A9, op_DD_AA, op_DD_AB, op_DD_AC, op_DD_AD, op_DD_AE, op_DD_AF,
+        op_DD_B0, op_DD_B1, op_DD_B2, op_DD_B3, op_DD_B4, op_DD_B5, op_DD_B6, op_DD_B7,
+        op_DD_B8, op_DD_B9, op_DD_BA, op_DD_BB, op_DD_BC, op_DD_BD, op_DD_BE, op_DD_BF,
+        op_DD_C0, op_DD_C1, op_DD_C2, op_DD_C3, op_DD_C4, op_DD_C5, op_DD_C6, op_DD_C7,
+        op_DD_C8, op_DD_C9, op_DD_CA, op_DD_CB, op_DD_CC, op_DD_CD, op_DD_CE, op_DD_CF,
+        op_DD_D0, op_DD_D1, op_DD_D2, op_DD_D3, op_DD_D4, op_DD_D5, op_DD_D6, op_DD_D7,
+        op_DD_D8, op_DD_D9, op_DD_DA, op_DD_DB, op_DD_DC, op_DD_DD, op_DD_DE, op_DD_DF,
+        op_DD_E0, op_DD_E1, op_DD_E2, op_DD_E3, op_DD_E4, op_DD_E5, op_DD_E6, op_DD_E7,
+        op_DD_E8, op_DD_E9, op_DD_EA, op_DD_EB, op_DD_EC, op_DD_ED, op_DD_EE, op_DD_EF,
+        op_DD_F0, op_DD_F1, op_DD_F2, op_DD_F3, op_DD_F4, op_DD_F5, op_DD_F6, op_DD_F7,
+        op_DD_F8, op_DD_F9, op_DD_FA, op_DD_FB, op_DD_FC, op_DD_FD, op_DD_FE, op_DD_FF };
+
+}
+
+#endif
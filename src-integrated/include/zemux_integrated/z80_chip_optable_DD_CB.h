@@ -0,0 +1,1402 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_DD_CB
+#define ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_DD_CB
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+
+namespace zemux {
+
+//
+// 0x0n
+//
+
+// LD B,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_00(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_01(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_02(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_03(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_04(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_05(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_06(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, cpu->regs.IX);
+}
+
+// LD A,RLC (IX+N)
+template<typename BusT>
+static void op_DD_CB_07(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RLC_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_08(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_09(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, cpu->regs.IX);
+}
+
+// LD A,RRC (IX+N)
+template<typename BusT>
+static void op_DD_CB_0F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RRC_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0x1n
+//
+
+// LD B,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_10(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_11(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_12(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_13(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_14(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_15(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_16(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, cpu->regs.IX);
+}
+
+// LD A,RL (IX+N)
+template<typename BusT>
+static void op_DD_CB_17(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RL_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_18(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_19(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, cpu->regs.IX);
+}
+
+// LD A,RR (IX+N)
+template<typename BusT>
+static void op_DD_CB_1F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_RR_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0x2n
+//
+
+// LD B,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_20(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_21(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_22(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_23(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_24(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_25(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_26(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, cpu->regs.IX);
+}
+
+// LD A,SLA (IX+N)
+template<typename BusT>
+static void op_DD_CB_27(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLA_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_28(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_29(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, cpu->regs.IX);
+}
+
+// LD A,SRA (IX+N)
+template<typename BusT>
+static void op_DD_CB_2F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRA_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0x3n
+//
+
+// LD B,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_30(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_31(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_32(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_33(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_34(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_35(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_36(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, cpu->regs.IX);
+}
+
+// LD A,SLL (IX+N)
+template<typename BusT>
+static void op_DD_CB_37(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SLL_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_38(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_39(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, cpu->regs.IX);
+}
+
+// LD A,SRL (IX+N)
+template<typename BusT>
+static void op_DD_CB_3F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_DO_R_PORP_P00(cpu, Z80ChipCore<BusT>::do_SRL_8, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0x4n
+//
+
+#define op_DD_CB_40 op_DD_CB_46
+#define op_DD_CB_41 op_DD_CB_46
+#define op_DD_CB_42 op_DD_CB_46
+#define op_DD_CB_43 op_DD_CB_46
+#define op_DD_CB_44 op_DD_CB_46
+#define op_DD_CB_45 op_DD_CB_46
+
+// BIT 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_46(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 0, cpu->regs.IX);
+}
+
+#define op_DD_CB_47 op_DD_CB_46
+#define op_DD_CB_48 op_DD_CB_4E
+#define op_DD_CB_49 op_DD_CB_4E
+#define op_DD_CB_4A op_DD_CB_4E
+#define op_DD_CB_4B op_DD_CB_4E
+#define op_DD_CB_4C op_DD_CB_4E
+#define op_DD_CB_4D op_DD_CB_4E
+
+// BIT 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_4E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 1, cpu->regs.IX);
+}
+
+#define op_DD_CB_4F op_DD_CB_4E
+
+//
+// 0x5n
+//
+
+#define op_DD_CB_50 op_DD_CB_56
+#define op_DD_CB_51 op_DD_CB_56
+#define op_DD_CB_52 op_DD_CB_56
+#define op_DD_CB_53 op_DD_CB_56
+#define op_DD_CB_54 op_DD_CB_56
+#define op_DD_CB_55 op_DD_CB_56
+
+// BIT 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_56(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 2, cpu->regs.IX);
+}
+
+#define op_DD_CB_57 op_DD_CB_56
+#define op_DD_CB_58 op_DD_CB_5E
+#define op_DD_CB_59 op_DD_CB_5E
+#define op_DD_CB_5A op_DD_CB_5E
+#define op_DD_CB_5B op_DD_CB_5E
+#define op_DD_CB_5C op_DD_CB_5E
+#define op_DD_CB_5D op_DD_CB_5E
+
+// BIT 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_5E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 3, cpu->regs.IX);
+}
+
+#define op_DD_CB_5F op_DD_CB_5E
+
+//
+// 0x6n
+//
+
+#define op_DD_CB_60 op_DD_CB_66
+#define op_DD_CB_61 op_DD_CB_66
+#define op_DD_CB_62 op_DD_CB_66
+#define op_DD_CB_63 op_DD_CB_66
+#define op_DD_CB_64 op_DD_CB_66
+#define op_DD_CB_65 op_DD_CB_66
+
+// BIT 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_66(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 4, cpu->regs.IX);
+}
+
+#define op_DD_CB_67 op_DD_CB_66
+#define op_DD_CB_68 op_DD_CB_6E
+#define op_DD_CB_69 op_DD_CB_6E
+#define op_DD_CB_6A op_DD_CB_6E
+#define op_DD_CB_6B op_DD_CB_6E
+#define op_DD_CB_6C op_DD_CB_6E
+#define op_DD_CB_6D op_DD_CB_6E
+
+// BIT 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_6E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 5, cpu->regs.IX);
+}
+
+#define op_DD_CB_6F op_DD_CB_6E
+
+//
+// 0x7n
+//
+
+#define op_DD_CB_70 op_DD_CB_76
+#define op_DD_CB_71 op_DD_CB_76
+#define op_DD_CB_72 op_DD_CB_76
+#define op_DD_CB_73 op_DD_CB_76
+#define op_DD_CB_74 op_DD_CB_76
+#define op_DD_CB_75 op_DD_CB_76
+
+// BIT 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_76(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 6, cpu->regs.IX);
+}
+
+#define op_DD_CB_77 op_DD_CB_76
+#define op_DD_CB_78 op_DD_CB_7E
+#define op_DD_CB_79 op_DD_CB_7E
+#define op_DD_CB_7A op_DD_CB_7E
+#define op_DD_CB_7B op_DD_CB_7E
+#define op_DD_CB_7C op_DD_CB_7E
+#define op_DD_CB_7D op_DD_CB_7E
+
+// BIT 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_7E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_BIT_PORP_P00(cpu, 7, cpu->regs.IX);
+}
+
+#define op_DD_CB_7F op_DD_CB_7E
+
+//
+// 0x8n
+//
+
+// LD B,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_80(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_81(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_82(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_83(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_84(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_85(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_86(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 0, cpu->regs.IX);
+}
+
+// LD A,RES 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_87(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 0, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_88(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_89(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 1, cpu->regs.IX);
+}
+
+// LD A,RES 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_8F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 1, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0x9n
+//
+
+// LD B,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_90(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_91(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_92(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_93(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_94(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_95(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_96(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 2, cpu->regs.IX);
+}
+
+// LD A,RES 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_97(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 2, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_98(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_99(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 3, cpu->regs.IX);
+}
+
+// LD A,RES 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_9F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 3, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xAn
+//
+
+// LD B,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 4, cpu->regs.IX);
+}
+
+// LD A,RES 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 4, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_A9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 5, cpu->regs.IX);
+}
+
+// LD A,RES 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_AF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 5, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xBn
+//
+
+// LD B,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 6, cpu->regs.IX);
+}
+
+// LD A,RES 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 6, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_B9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RES_PORP_P00(cpu, 7, cpu->regs.IX);
+}
+
+// LD A,RES 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_BF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RES_PORP_P00(cpu, 7, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xCn
+//
+
+// LD B,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 0, cpu->regs.IX);
+}
+
+// LD A,SET 0,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 0, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_C9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 1, cpu->regs.IX);
+}
+
+// LD A,SET 1,(IX+N)
+template<typename BusT>
+static void op_DD_CB_CF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 1, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xDn
+//
+
+// LD B,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 2, cpu->regs.IX);
+}
+
+// LD A,SET 2,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 2, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_D9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 3, cpu->regs.IX);
+}
+
+// LD A,SET 3,(IX+N)
+template<typename BusT>
+static void op_DD_CB_DF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 3, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xEn
+//
+
+// LD B,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 4, cpu->regs.IX);
+}
+
+// LD A,SET 4,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 4, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_E9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_EA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_EB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_EC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_ED(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 5,(IX+N
+template<typename BusT>
+static void op_DD_CB_EE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 5, cpu->regs.IX);
+}
+
+// LD A,SET 5,(IX+N)
+template<typename BusT>
+static void op_DD_CB_EF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 5, &(cpu->regs.A), cpu->regs.IX);
+}
+
+//
+// 0xFn
+//
+
+// LD B,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 6, cpu->regs.IX);
+}
+
+// LD A,SET 6,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 6, &(cpu->regs.A), cpu->regs.IX);
+}
+
+// LD B,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.B), cpu->regs.IX);
+}
+
+// LD C,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_F9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.C), cpu->regs.IX);
+}
+
+// LD D,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.D), cpu->regs.IX);
+}
+
+// LD E,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.E), cpu->regs.IX);
+}
+
+// LD H,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.H), cpu->regs.IX);
+}
+
+// LD L,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.L), cpu->regs.IX);
+}
+
+// SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SET_PORP_P00(cpu, 7, cpu->regs.IX);
+}
+
+// LD A,SET 7,(IX+N)
+template<typename BusT>
+static void op_DD_CB_FF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SET_PORP_P00(cpu, 7, &(cpu->regs.A), cpu->regs.IX);
+}
+
+template<typename BusT>
+typename BasicZ80Chip<BusT>::Opcode Z80ChipOptables<BusT>::tableDD_CB[0x100] = {
+        op_DD_CB_00, op_DD_CB_01, op_DD_CB_02, op_DD_CB_03, op_DD_CB_04, op_DD_CB_05, op_DD_CB_06, op_DD_CB_07,
+        op_DD_CB_08, op_DD_CB_09, op_DD_CB_0A, op_DD_CB_0B, op_DD_CB_0C, op_DD_CB_0D, op_DD_CB_0E, op_DD_CB_0F,
+        op_DD_CB_10, op_DD_CB_11, op_DD_CB_12, op_DD_CB_13, op_DD_CB_14, op_DD_CB_15, op_DD_CB_16, op_DD_CB_17,
+        op_DD_CB_18, op_DD_CB_19, op_DD_CB_1A, op_DD_CB_1B, op_DD_CB_1C, op_DD_CB_1D, op_DD_CB_1E, op_DD_CB_1F,
+        op_DD_CB_20, op_DD_CB_21, op_DD_CB_22, op_DD_CB_23, op_DD_CB_24, op_DD_CB_25, op_DD_CB_26, op_DD_CB_27,
+        op_DD_CB_28, op_DD_CB_29, op_DD_CB_2A, op_DD_CB_2B, op_DD_CB_2C, op_DD_CB_2D, op_DD_CB_2E, op_DD_CB_2F,
+        op_DD_CB_30, op_DD_CB_31, op_DD_CB_32, op_DD_CB_33, op_DD_CB_34, op_DD_CB_35, op_DD_CB_36, op_DD_CB_37,
+        op_DD_CB_38, op_DD_CB_39, op_DD_CB_3A, op_DD_CB_3B, op_DD_CB_3C, op_DD_CB_3D, op_DD_CB_3E, op_DD_CB_3F,
+        op_DD_CB_40, op_DD_CB_41, op_DD_CB_42, op_DD_CB_43, op_DD_CB_44, op_DD_CB_45, op_DD_CB_46, op_DD_CB_47,
+        op_DD_CB_48, op_DD_CB_49, op_DD_CB_4A, op_DD_CB_4B, op_DD_CB_4C, op_DD_CB_4D, op_DD_CB_4E, op_DD_CB_4F,
+        op_DD_CB_50, op_DD_CB_51, op_DD_CB_52, op_DD_CB_53, op_DD_CB_54, op_DD_CB_55, op_DD_CB_56, op_DD_CB_57,
+        op_DD_CB_58, op_DD_CB_59, op_DD_CB_5A, op_DD_CB_5B, op_DD_CB_5C, op_DD_CB_5D, op_DD_CB_5E, op_DD_CB_5F,
+        op_DD_CB_60, op_DD_CB_61, op_DD_CB_62, op_DD_CB_63, op_DD_CB_64, op_DD_CB_65, op_DD_CB_66, op_DD_CB_67,
+        op_DD_CB_68, op_DD_CB_69, op_DD_CB_6A, op_DD_CB_6B, op_DD_CB_6C, op_DD_CB_6D, op_DD_CB_6E, op_DD_CB_6F,
+        op_DD_CB_70, op_DD_CB_71, op_DD_CB_72, op_DD_CB_73, op_DD_CB_74, op_DD_CB_75, op_DD_CB_76, op_DD_CB_77,
+        op_DD_CB_78, op_DD_CB_79, op_DD_CB_7A, op_DD_CB_7B, op_DD_CB_7C, op_DD_CB_7D, op_DD_CB_7E, op_DD_CB_7F,
+        op_DD_CB_80, op_DD_CB_81, op_DD_CB_82, op_DD_CB_83, op_DD_CB_84, op_DD_CB_85, op_DD_CB_86, op_DD_CB_87,
+        op_DD_CB_88, op_DD_CB_89, op_DD_CB_8A, op_DD_CB_8B, op_DD_CB_8C, op_DD_CB_8D, op_DD_CB_8E, op_DD_CB_8F,
+        op_DD_CB_90, op_DD_CB_91, op_DD_CB_92, op_DD_CB_93, op_DD_CB_94, op_DD_CB_95, op_DD_CB_96, op_DD_CB_97,
+        op_DD_CB_98, op_DD_CB_99, op_DD_CB_9A, op_DD_CB_9B, op_DD_CB_9C, op_DD_CB_9D, op_DD_CB_9E, op_DD_CB_9F,
+        op_DD_CB_A0, op_DD_CB_A1, op_DD_CB_A2, op_DD_CB_A3, op_DD_CB_A4, op_DD_CB_A5, op_DD_CB_A6, op_DD_CB_A7,
+        op_DD_CB_A8, op_DD_CB_A9, op_DD_CB_AA, op_DD_CB_AB, op_DD_CB_AC, op_DD_CB_AD, op_DD_CB_AE, op_DD_CB_AF,
+        op_DD_CB_B0, op_DD_CB_B1, op_DD_CB_B2, op_DD_CB_B3, op_DD_CB_B4, op_DD_CB_B5, op_DD_CB_B6, op_DD_CB_B7,
+        op_DD_CB_B8, op_DD_CB_B9, op_DD_CB_BA, op_DD_CB_BB, op_DD_CB_BC, op_DD_CB_BD, op_DD_CB_BE, op_DD_CB_BF,
+        op_DD_CB_C0, op_DD_CB_C1, op_DD_CB_C2, op_DD_CB_C3, op_DD_CB_C4, op_DD_CB_C5, op_DD_CB_C6, op_DD_CB_C7,
+        op_DD_CB_C8, op_DD_CB_C9, op_DD_CB_CA, op_DD_CB_CB, op_DD_CB_CC, op_DD_CB_CD, op_DD_CB_CE, op_DD_CB_CF,
+        op_DD_CB_D0, op_DD_CB_D1, op_DD_CB_D2, op_DD_CB_D3, op_DD_CB_D4, op_DD_CB_D5, op_DD_CB_D6, op_DD_CB_D7,
+        op_DD_CB_D8, op_DD_CB_D9, op_DD_CB_DA, op_DD_CB_DB, op_DD_CB_DC, op_DD_CB_DD, op_DD_CB_DE, op_DD_CB_DF,
+        op_DD_CB_E0, op_DD_CB_E1, op_DD_CB_E2, op_DD_CB_E3, op_DD_CB_E4, op_DD_CB_E5, op_DD_CB_E6, op_DD_CB_E7,
+        op_DD_CB_E8, op_DD_CB_E9, op_DD_CB_EA, op_DD_CB_EB, op_DD_CB_EC, op_DD_CB_ED, op_DD_CB_EE, op_DD_CB_EF,
+        op_DD_CB_F0, op_DD_CB_F1, op_DD_CB_F2, op_DD_CB_F3, op_DD_CB_F4, op_DD_CB_F5, op_DD_CB_F6, op_DD_CB_F7,
+        op_DD_CB_F8, op_DD_CB_F9, op_DD_CB_FA, op_DD_CB_FB, op_DD_CB_FC, op_DD_CB_FD, op_DD_CB_FE, op_DD_CB_FF };
+
+}
+
+#endif
@@ -0,0 +1,1897 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_FD
+#define ZEMUX_INTEGRATED__Z80_CHIP_OPTABLE_FD
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+
+namespace zemux {
+
+//
+// 0x0n
+//
+
+// *NOP
+template<typename BusT>
+static void op_FD_00(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_NOP(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD BC,NN
+template<typename BusT>
+static void op_FD_01(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (BC),A
+template<typename BusT>
+static void op_FD_02(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC BC
+template<typename BusT>
+static void op_FD_03(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC B
+template<typename BusT>
+static void op_FD_04(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC B
+template<typename BusT>
+static void op_FD_05(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,N
+template<typename BusT>
+static void op_FD_06(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.B));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RLCA
+template<typename BusT>
+static void op_FD_07(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLCA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EX AF,AF'
+template<typename BusT>
+static void op_FD_08(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_AF_AF_(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IY,BC
+template<typename BusT>
+static void op_FD_09(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IY), cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(BC)
+template<typename BusT>
+static void op_FD_0A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC BC
+template<typename BusT>
+static void op_FD_0B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC C
+template<typename BusT>
+static void op_FD_0C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC C
+template<typename BusT>
+static void op_FD_0D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,N
+template<typename BusT>
+static void op_FD_0E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.C));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RRCA
+template<typename BusT>
+static void op_FD_0F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRCA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x1n
+//
+
+// *DJNZ O
+template<typename BusT>
+static void op_FD_10(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DJNZ(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD DE,NN
+template<typename BusT>
+static void op_FD_11(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (DE),A
+template<typename BusT>
+static void op_FD_12(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MRP_A(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC DE
+template<typename BusT>
+static void op_FD_13(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC D
+template<typename BusT>
+static void op_FD_14(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC D
+template<typename BusT>
+static void op_FD_15(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,N
+template<typename BusT>
+static void op_FD_16(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.D));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RLA
+template<typename BusT>
+static void op_FD_17(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RLA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR O
+template<typename BusT>
+static void op_FD_18(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IY,DE
+template<typename BusT>
+static void op_FD_19(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IY), cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(DE)
+template<typename BusT>
+static void op_FD_1A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MRP(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC DE
+template<typename BusT>
+static void op_FD_1B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC E
+template<typename BusT>
+static void op_FD_1C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC E
+template<typename BusT>
+static void op_FD_1D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,N
+template<typename BusT>
+static void op_FD_1E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.E));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RRA
+template<typename BusT>
+static void op_FD_1F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RRA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x2n
+//
+
+// *JR NZ,O
+template<typename BusT>
+static void op_FD_20(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IY,NN
+template<typename BusT>
+static void op_FD_21(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD (NN),IY
+template<typename BusT>
+static void op_FD_22(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_RP(cpu, cpu->regs.IY);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IY
+template<typename BusT>
+static void op_FD_23(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IYH
+template<typename BusT>
+static void op_FD_24(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.IYH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IYH
+template<typename BusT>
+static void op_FD_25(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.IYH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,N
+template<typename BusT>
+static void op_FD_26(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.IYH));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DAA
+template<typename BusT>
+static void op_FD_27(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DAA(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR Z,O
+template<typename BusT>
+static void op_FD_28(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IY,IY
+template<typename BusT>
+static void op_FD_29(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IY), cpu->regs.IY);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IY,(NN)
+template<typename BusT>
+static void op_FD_2A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_MNN(cpu, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IY
+template<typename BusT>
+static void op_FD_2B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC IYL
+template<typename BusT>
+static void op_FD_2C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.IYL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// DEC IYL
+template<typename BusT>
+static void op_FD_2D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.IYL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,N
+template<typename BusT>
+static void op_FD_2E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.IYL));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CPL
+template<typename BusT>
+static void op_FD_2F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CPL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x3n
+//
+
+// *JR NC,O
+template<typename BusT>
+static void op_FD_30(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD SP,NN
+template<typename BusT>
+static void op_FD_31(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_RP_NN(cpu, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD (NN),A
+template<typename BusT>
+static void op_FD_32(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_MNN_A(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC SP
+template<typename BusT>
+static void op_FD_33(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_INC_16, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// INC (IY+N)
+template<typename BusT>
+static void op_FD_34(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_ORP_P00(cpu, Z80ChipCore<BusT>::do_INC_8, cpu->regs.IY);
+}
+
+// DEC (IY+N)
+template<typename BusT>
+static void op_FD_35(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_ORP_P00(cpu, Z80ChipCore<BusT>::do_DEC_8, cpu->regs.IY);
+}
+
+// LD (IY+N),N
+template<typename BusT>
+static void op_FD_36(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_N_P00(cpu, cpu->regs.IY);
+}
+
+// *SCF
+template<typename BusT>
+static void op_FD_37(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_SCF(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JR C,O
+template<typename BusT>
+static void op_FD_38(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JR_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD IY,SP
+template<typename BusT>
+static void op_FD_39(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_ADD_RP_RP(cpu, &(cpu->regs.IY), cpu->regs.SP);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,(NN)
+template<typename BusT>
+static void op_FD_3A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_A_MNN(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC SP
+template<typename BusT>
+static void op_FD_3B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_RP(cpu, Z80ChipCore<BusT>::do_DEC_16, &(cpu->regs.SP));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *INC A
+template<typename BusT>
+static void op_FD_3C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_INC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DEC A
+template<typename BusT>
+static void op_FD_3D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_R(cpu, Z80ChipCore<BusT>::do_DEC_8, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,N
+template<typename BusT>
+static void op_FD_3E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_N(cpu, &(cpu->regs.A));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CCF
+template<typename BusT>
+static void op_FD_3F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CCF(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x4n
+//
+
+// *LD B,B
+template<typename BusT>
+static void op_FD_40(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,C
+template<typename BusT>
+static void op_FD_41(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,D
+template<typename BusT>
+static void op_FD_42(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD B,E
+template<typename BusT>
+static void op_FD_43(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,IYH
+template<typename BusT>
+static void op_FD_44(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,IYL
+template<typename BusT>
+static void op_FD_45(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD B,(IY+N)
+template<typename BusT>
+static void op_FD_46(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.B), cpu->regs.IY);
+}
+
+// *LD B,A
+template<typename BusT>
+static void op_FD_47(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.B), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,B
+template<typename BusT>
+static void op_FD_48(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,C
+template<typename BusT>
+static void op_FD_49(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,D
+template<typename BusT>
+static void op_FD_4A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD C,E
+template<typename BusT>
+static void op_FD_4B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,IYH
+template<typename BusT>
+static void op_FD_4C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,IYL
+template<typename BusT>
+static void op_FD_4D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD C,(IY+N)
+template<typename BusT>
+static void op_FD_4E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.C), cpu->regs.IY);
+}
+
+// *LD C,A
+template<typename BusT>
+static void op_FD_4F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.C), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x5n
+//
+
+// *LD D,B
+template<typename BusT>
+static void op_FD_50(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,C
+template<typename BusT>
+static void op_FD_51(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,D
+template<typename BusT>
+static void op_FD_52(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD D,E
+template<typename BusT>
+static void op_FD_53(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,IYH
+template<typename BusT>
+static void op_FD_54(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,IYL
+template<typename BusT>
+static void op_FD_55(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD D,(IY+N)
+template<typename BusT>
+static void op_FD_56(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.D), cpu->regs.IY);
+}
+
+// *LD D,A
+template<typename BusT>
+static void op_FD_57(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.D), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,B
+template<typename BusT>
+static void op_FD_58(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,C
+template<typename BusT>
+static void op_FD_59(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,D
+template<typename BusT>
+static void op_FD_5A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD E,E
+template<typename BusT>
+static void op_FD_5B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,IYH
+template<typename BusT>
+static void op_FD_5C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,IYL
+template<typename BusT>
+static void op_FD_5D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD E,(IY+N)
+template<typename BusT>
+static void op_FD_5E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.E), cpu->regs.IY);
+}
+
+// *LD E,A
+template<typename BusT>
+static void op_FD_5F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.E), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x6n
+//
+
+// LD IYH,B
+template<typename BusT>
+static void op_FD_60(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,C
+template<typename BusT>
+static void op_FD_61(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,D
+template<typename BusT>
+static void op_FD_62(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,E
+template<typename BusT>
+static void op_FD_63(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,H
+template<typename BusT>
+static void op_FD_64(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYH,L
+template<typename BusT>
+static void op_FD_65(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD H,(IY+N)
+template<typename BusT>
+static void op_FD_66(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.H), cpu->regs.IY);
+}
+
+// LD IYH,A
+template<typename BusT>
+static void op_FD_67(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYH), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,B
+template<typename BusT>
+static void op_FD_68(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,C
+template<typename BusT>
+static void op_FD_69(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,D
+template<typename BusT>
+static void op_FD_6A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,E
+template<typename BusT>
+static void op_FD_6B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,H
+template<typename BusT>
+static void op_FD_6C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD IYL,L
+template<typename BusT>
+static void op_FD_6D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD L,(IY+N)
+template<typename BusT>
+static void op_FD_6E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.L), cpu->regs.IY);
+}
+
+// LD IYL,A
+template<typename BusT>
+static void op_FD_6F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.IYL), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x7n
+//
+
+// LD (IY+N),B
+template<typename BusT>
+static void op_FD_70(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.B);
+}
+
+// LD (IY+N),C
+template<typename BusT>
+static void op_FD_71(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.C);
+}
+
+// LD (IY+N),D
+template<typename BusT>
+static void op_FD_72(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.D);
+}
+
+// LD (IY+N),E
+template<typename BusT>
+static void op_FD_73(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.E);
+}
+
+// LD (IY+N),H
+template<typename BusT>
+static void op_FD_74(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.H);
+}
+
+// LD (IY+N),L
+template<typename BusT>
+static void op_FD_75(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.L);
+}
+
+// *HALT
+template<typename BusT>
+static void op_FD_76(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_HALT(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD (IY+N),A
+template<typename BusT>
+static void op_FD_77(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_ORP_R_P00(cpu, cpu->regs.IY, cpu->regs.A);
+}
+
+// *LD A,B
+template<typename BusT>
+static void op_FD_78(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,C
+template<typename BusT>
+static void op_FD_79(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,D
+template<typename BusT>
+static void op_FD_7A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *LD A,E
+template<typename BusT>
+static void op_FD_7B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,IYH
+template<typename BusT>
+static void op_FD_7C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,IYL
+template<typename BusT>
+static void op_FD_7D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD A,(IY+N)
+template<typename BusT>
+static void op_FD_7E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_ORP_P00(cpu, &(cpu->regs.A), cpu->regs.IY);
+}
+
+// *LD A,A
+template<typename BusT>
+static void op_FD_7F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_R_R(cpu, &(cpu->regs.A), cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x8n
+//
+
+// *ADD A,B
+template<typename BusT>
+static void op_FD_80(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,C
+template<typename BusT>
+static void op_FD_81(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,D
+template<typename BusT>
+static void op_FD_82(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,E
+template<typename BusT>
+static void op_FD_83(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,IYH
+template<typename BusT>
+static void op_FD_84(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,IYL
+template<typename BusT>
+static void op_FD_85(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADD A,(IY+N)
+template<typename BusT>
+static void op_FD_86(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.IY);
+}
+
+// *ADD A,A
+template<typename BusT>
+static void op_FD_87(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADD_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,B
+template<typename BusT>
+static void op_FD_88(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,C
+template<typename BusT>
+static void op_FD_89(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,D
+template<typename BusT>
+static void op_FD_8A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,E
+template<typename BusT>
+static void op_FD_8B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,IYH
+template<typename BusT>
+static void op_FD_8C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,IYL
+template<typename BusT>
+static void op_FD_8D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// ADC A,(IY+N)
+template<typename BusT>
+static void op_FD_8E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.IY);
+}
+
+// *ADC A,A
+template<typename BusT>
+static void op_FD_8F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_ADC_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0x9n
+//
+
+// *SUB B
+template<typename BusT>
+static void op_FD_90(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB C
+template<typename BusT>
+static void op_FD_91(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB D
+template<typename BusT>
+static void op_FD_92(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB E
+template<typename BusT>
+static void op_FD_93(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB IYH
+template<typename BusT>
+static void op_FD_94(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB IYL
+template<typename BusT>
+static void op_FD_95(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SUB (IY+N)
+template<typename BusT>
+static void op_FD_96(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.IY);
+}
+
+// *SUB A
+template<typename BusT>
+static void op_FD_97(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SUB_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,B
+template<typename BusT>
+static void op_FD_98(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,C
+template<typename BusT>
+static void op_FD_99(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,D
+template<typename BusT>
+static void op_FD_9A(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SBC A,E
+template<typename BusT>
+static void op_FD_9B(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,IYH
+template<typename BusT>
+static void op_FD_9C(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,IYL
+template<typename BusT>
+static void op_FD_9D(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// SBC A,(IY+N)
+template<typename BusT>
+static void op_FD_9E(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.IY);
+}
+
+// *SBC A,A
+template<typename BusT>
+static void op_FD_9F(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_SBC_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xAn
+//
+
+// *AND B
+template<typename BusT>
+static void op_FD_A0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND C
+template<typename BusT>
+static void op_FD_A1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND D
+template<typename BusT>
+static void op_FD_A2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND E
+template<typename BusT>
+static void op_FD_A3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND IYH
+template<typename BusT>
+static void op_FD_A4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND IYL
+template<typename BusT>
+static void op_FD_A5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// AND (IY+N)
+template<typename BusT>
+static void op_FD_A6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.IY);
+}
+
+// *AND A
+template<typename BusT>
+static void op_FD_A7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_AND_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR B
+template<typename BusT>
+static void op_FD_A8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR C
+template<typename BusT>
+static void op_FD_A9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR D
+template<typename BusT>
+static void op_FD_AA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *XOR E
+template<typename BusT>
+static void op_FD_AB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR IYH
+template<typename BusT>
+static void op_FD_AC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR IYL
+template<typename BusT>
+static void op_FD_AD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// XOR (IY+N)
+template<typename BusT>
+static void op_FD_AE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.IY);
+}
+
+// *XOR A
+template<typename BusT>
+static void op_FD_AF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_XOR_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xBn
+//
+
+// *OR B
+template<typename BusT>
+static void op_FD_B0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR C
+template<typename BusT>
+static void op_FD_B1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR D
+template<typename BusT>
+static void op_FD_B2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR E
+template<typename BusT>
+static void op_FD_B3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR IYH
+template<typename BusT>
+static void op_FD_B4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR IYL
+template<typename BusT>
+static void op_FD_B5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// OR (IY+N)
+template<typename BusT>
+static void op_FD_B6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.IY);
+}
+
+// *OR A
+template<typename BusT>
+static void op_FD_B7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_OR_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP B
+template<typename BusT>
+static void op_FD_B8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.B);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP C
+template<typename BusT>
+static void op_FD_B9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP D
+template<typename BusT>
+static void op_FD_BA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.D);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CP E
+template<typename BusT>
+static void op_FD_BB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.E);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP IYH
+template<typename BusT>
+static void op_FD_BC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IYH);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP IYL
+template<typename BusT>
+static void op_FD_BD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IYL);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// CP (IY+N)
+template<typename BusT>
+static void op_FD_BE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_ORP_P00(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.IY);
+}
+
+// *CP A
+template<typename BusT>
+static void op_FD_BF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_R(cpu, Z80ChipCore<BusT>::do_CP_8, cpu->regs.A);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xCn
+//
+
+// *RET NZ
+template<typename BusT>
+static void op_FD_C0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP BC
+template<typename BusT>
+static void op_FD_C1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.BC));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NZ,NN
+template<typename BusT>
+static void op_FD_C2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NN
+template<typename BusT>
+static void op_FD_C3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NZ,NN
+template<typename BusT>
+static void op_FD_C4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NZ);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH BC
+template<typename BusT>
+static void op_FD_C5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.BC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADD A,N
+template<typename BusT>
+static void op_FD_C6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADD_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #00
+template<typename BusT>
+static void op_FD_C7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x00);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET Z
+template<typename BusT>
+static void op_FD_C8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET
+template<typename BusT>
+static void op_FD_C9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP Z,NN
+template<typename BusT>
+static void op_FD_CA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #FD_CB
+template<typename BusT>
+static void op_FD_CB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_XX_CB(cpu, Z80ChipOptables<BusT>::tableFD_CB);
+}
+
+// *CALL Z,NN
+template<typename BusT>
+static void op_FD_CC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_Z);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NN
+template<typename BusT>
+static void op_FD_CD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *ADC A,N
+template<typename BusT>
+static void op_FD_CE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_ADC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #08
+template<typename BusT>
+static void op_FD_CF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x08);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xDn
+//
+
+// *RET NC
+template<typename BusT>
+static void op_FD_D0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP DE
+template<typename BusT>
+static void op_FD_D1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.DE));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP NC,NN
+template<typename BusT>
+static void op_FD_D2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OUT (N),A
+template<typename BusT>
+static void op_FD_D3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_OUT_N_A(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL NC,NN
+template<typename BusT>
+static void op_FD_D4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_NC);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH DE
+template<typename BusT>
+static void op_FD_D5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.DE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *SUB N
+template<typename BusT>
+static void op_FD_D6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SUB_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #10
+template<typename BusT>
+static void op_FD_D7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x10);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET C
+template<typename BusT>
+static void op_FD_D8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EXX
+template<typename BusT>
+static void op_FD_D9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EXX(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP C,NN
+template<typename BusT>
+static void op_FD_DA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *IN A,(N)
+template<typename BusT>
+static void op_FD_DB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_IN_A_N(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL C,NN
+template<typename BusT>
+static void op_FD_DC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_C);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #DD
+template<typename BusT>
+static void op_FD_DD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_DD(cpu);
+}
+
+// *SBC A,N
+template<typename BusT>
+static void op_FD_DE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_SBC_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #18
+template<typename BusT>
+static void op_FD_DF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x18);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xEn
+//
+
+// *RET PO
+template<typename BusT>
+static void op_FD_E0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// POP IY
+template<typename BusT>
+static void op_FD_E1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP PO,NN
+template<typename BusT>
+static void op_FD_E2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// EX (SP),IY
+template<typename BusT>
+static void op_FD_E3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_MSP_RP(cpu, &(cpu->regs.IY));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL PO,NN
+template<typename BusT>
+static void op_FD_E4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PO);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// PUSH IY
+template<typename BusT>
+static void op_FD_E5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.IY);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *AND N
+template<typename BusT>
+static void op_FD_E6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_AND_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #20
+template<typename BusT>
+static void op_FD_E7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x20);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET PE
+template<typename BusT>
+static void op_FD_E8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// JP IY
+template<typename BusT>
+static void op_FD_E9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_RP(cpu, cpu->regs.IY);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP PE,NN
+template<typename BusT>
+static void op_FD_EA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EX DE,HL
+template<typename BusT>
+static void op_FD_EB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EX_DE_HL(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL PE,NN
+template<typename BusT>
+static void op_FD_EC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_PE);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #ED
+template<typename BusT>
+static void op_FD_ED(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_ED(cpu);
+}
+
+// *XOR N
+template<typename BusT>
+static void op_FD_EE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_XOR_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #28
+template<typename BusT>
+static void op_FD_EF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x28);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+//
+// 0xFn
+//
+
+// *RET P
+template<typename BusT>
+static void op_FD_F0(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *POP AF
+template<typename BusT>
+static void op_FD_F1(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_POP_RP(cpu, &(cpu->regs.AF));
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP P,NN
+template<typename BusT>
+static void op_FD_F2(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *DI
+template<typename BusT>
+static void op_FD_F3(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DI(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL P,NN
+template<typename BusT>
+static void op_FD_F4(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_P);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *PUSH AF
+template<typename BusT>
+static void op_FD_F5(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PUSH_RP(cpu, cpu->regs.AF);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *OR N
+template<typename BusT>
+static void op_FD_F6(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_OR_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #30
+template<typename BusT>
+static void op_FD_F7(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x30);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RET M
+template<typename BusT>
+static void op_FD_F8(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RET_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// LD SP,IY
+template<typename BusT>
+static void op_FD_F9(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_LD_SP_RP(cpu, cpu->regs.IY);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *JP M,NN
+template<typename BusT>
+static void op_FD_FA(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_JP_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *EI
+template<typename BusT>
+static void op_FD_FB(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_EI(cpu);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *CALL M,NN
+template<typename BusT>
+static void op_FD_FC(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_CALL_CC(cpu, Z80ChipCore<BusT>::cc_M);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// prefix #FD
+template<typename BusT>
+static void op_FD_FD(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_PREF_FD(cpu);
+}
+
+// *CP N
+template<typename BusT>
+static void op_FD_FE(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_DO_A_N(cpu, Z80ChipCore<BusT>::do_CP_8);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+// *RST #38
+template<typename BusT>
+static void op_FD_FF(BasicZ80Chip<BusT>* cpu) {
+    Z80ChipCore<BusT>::op_RST(cpu, 0x38);
+    Z80ChipCore<BusT>::do_PREF_00(cpu);
+}
+
+template<typename BusT>
+typename BasicZ80Chip<BusT>::Opcode Z80ChipOptables<BusT>::tableFD[0x100] = {
+        op_FD_00, op_FD_01, op_FD_02, op_FD_03, op_FD_04, op_FD_05, op_FD_06, op_FD_07,
+        op_FD_08, op_FD_09, op_FD_0A, op_FD_0B, op_FD_0C, op_FD_0D, op_FD_0E, op_FD_0F,
+        op_FD_10, op_FD_11, op_FD_12, op_FD_13, op_FD_14, op_FD_15, op_FD_16, op_FD_17,
+        op_FD_18, op_FD_19, op_FD_1A, op_FD_1B, op_FD_1C, op_FD_1D, op_FD_1E, op_FD_1F,
+        op_FD_20, op_FD_21, op_FD_22, op_FD_23, op_FD_24, op_FD_25, op_FD_26, op_FD_27,
+        op_FD_28, op_FD_29, op_FD_2A, op_FD_2B, op_FD_2C, op_FD_2D, op_FD_2E, op_FD_2F,
+        op_FD_30, op_FD_31, op_FD_32, op_FD_33, op_FD_34, op_FD_35, op_FD_36, op_FD_37,
+        op_FD_38, op_FD_39, op_FD_3A, op_FD_3B, op_FD_3C, op_FD_3D, op_FD_3E, op_FD_3F,
+        op_FD_40, op_FD_41, op_FD_42, op_FD_43, op_FD_44, op_FD_45, op_FD_46, op_FD_47,
+        op_FD_48, op_FD_49, op_FD_4A, op_FD_4B, op_FD_4C, op_FD_4D, op_FD_4E, op_FD_4F,
+        op_FD_50, op_FD_51, op_FD_52, op_FD_53, op_FD_54, op_FD_55, op_FD_56, op_FD_57,
+        op_FD_58, op_FD_59, op_FD_5A, op_FD_5B, op_FD_5C, op_FD_5D, op_FD_5E, op_FD_5F,
+        op_FD_60, op_FD_61, op_FD_62, op_FD_63, op_FD_64, op_FD_65, op_FD_66, op_FD_67,
+        op_FD_68, op_FD_69, op_FD_6A, op_FD_6B, op_FD_6C, op_FD_6D, op_FD_6E, op_FD_6F,
+        op_FD_70, op_FD_71, op_FD_72, op_FD_73, op_FD_74, op_FD_75, op_FD_76, op_FD_77,
+        op_FD_78, op_FD_79, op_FD_7A, op_FD_7B, op_FD_7C, op_FD_7D, op_FD_7E, op_FD_7F,
+        op_FD_80, op_FD_81, op_FD_82, op_FD_83, op_FD_84, op_FD_85, op_FD_86, op_FD_87,
+        op_FD_88, op_FD_89, op_FD_8A, op_FD_8B, op_FD_8C, op_FD_8D, op_FD_8E, op_FD_8F,
+        op_FD_90, op_FD_91, op_FD_92, op_FD_93, op_FD_94, op_FD_95, op_FD_96, op_FD_97,
+        op_FD_98, op_FD_99, op_FD_9A, op_FD_9B, op_FD_9C, op_FD_9D, op_FD_9E, op_FD_9F,
+        op_FD_A0, op_FD_A1, op_FD_A2, op_FD_A3, op_FD_A4, op_FD_A5, op_FD_A6, op_FD_A7,
+        op_FD_A8, op_FD_A9, op_FD_AA, op_FD_AB, op_FD_AC, op_FD_AD, op_FD_AE, op_FD_AF,
+        op_FD_B0, op_FD_B1, op_FD_B2, op_FD_B3, op_FD_B4, op_FD_B5, op_FD_B6, op_FD_B7,
+        op_FD_B8, op_FD_B9, op_FD_BA, op_FD_BB, op_FD_BC, op_FD_BD, op_FD_BE, op_FD_BF,
+        op_FD_C0, op_FD_C1, op_FD_C2, op_FD_C3, op_FD_C4, op_FD_C5, op_FD_C6, op_FD_C7,
+        op_FD_C8, op_FD_C9, op_FD_CA, op_FD_CB, op_FD_CC, op_FD_CD, op_FD_CE, op_FD_CF,
+        op_FD_D0, op_FD_D1, op_FD_D2, op_FD_D3, op_FD_D4, op_FD_D5, op_FD_D6, op_FD_D7,
+        op_FD_D8, op_FD_D9, op_FD_DA, op_FD_DB, op_FD_DC, op_FD_DD, op_FD_DE, op_FD_DF,
+        op_FD_E0, op_FD_E1, op_FD_E2, op_FD_E3, op_FD_E4, op_FD_E5, op_FD_E6, op_FD_E7,
+        op_FD_E8, op_FD_E9, op_FD_EA, op_FD_EB, op_FD_EC, op_FD_ED, op_FD_EE, op_FD_EF,
+        op_FD_F0, op_FD_F1, op_FD_F2, op_FD_F3, op_FD_F4, op_FD_F5, op_FD_F6, op_FD_F7,
+        op_FD_F8, op_FD_F9, op_FD_FA, op_FD_FB, op_FD_FC, op_FD_FD, op_FD_FE, op_FD_FF };
+
+}
+
+#endif
@@ -0,0 +1,275 @@
+#ifndef ZEMUX_INTEGRATED__Z80_CHIP_THREADED
+#define ZEMUX_INTEGRATED__Z80_CHIP_THREADED
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Threaded-code backend for BasicZ80Chip::run(). All optables are compiled into the same translation unit,
+// so every handler is called directly (and usually inlined) from its own label, and dispatch is done
+// with computed goto from handler to handler. Prefixes are processed inline, without returning to the loop.
+
+#include "z80_chip.h"
+#include "z80_chip_core.h"
+#include "z80_chip_optable_00.h"
+#include "z80_chip_optable_CB.h"
+#include "z80_chip_optable_DD.h"
+#include "z80_chip_optable_ED.h"
+#include "z80_chip_optable_FD.h"
+#include "z80_chip_optable_DD_CB.h"
+#include "z80_chip_optable_FD_CB.h"
+
+#define ZEMUX_Z80_THREADED_HEX_16(M, T, H) \
+    M(T, H##0) M(T, H##1) M(T, H##2) M(T, H##3) M(T, H##4) M(T, H##5) M(T, H##6) M(T, H##7) \
+    M(T, H##8) M(T, H##9) M(T, H##A) M(T, H##B) M(T, H##C) M(T, H##D) M(T, H##E) M(T, H##F)
+
+#define ZEMUX_Z80_THREADED_HEX_256(M, T) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, 0) ZEMUX_Z80_THREADED_HEX_16(M, T, 1) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, 2) ZEMUX_Z80_THREADED_HEX_16(M, T, 3) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, 4) ZEMUX_Z80_THREADED_HEX_16(M, T, 5) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, 6) ZEMUX_Z80_THREADED_HEX_16(M, T, 7) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, 8) ZEMUX_Z80_THREADED_HEX_16(M, T, 9) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, A) ZEMUX_Z80_THREADED_HEX_16(M, T, B) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, C) ZEMUX_Z80_THREADED_HEX_16(M, T, D) \
+    ZEMUX_Z80_THREADED_HEX_16(M, T, E) ZEMUX_Z80_THREADED_HEX_16(M, T, F)
+
+#define ZEMUX_Z80_THREADED_LABEL_ADDRESS(T, N) &&label_##T##_##N,
+
+// Every handler has its own copy of the dispatch code, so the host branch predictor can learn opcode pairs.
+// Budget is checked after prefixes too, so prefix is counted as separate instruction, just like in step().
+// DD CB / FD CB are expanded inline.
+#define ZEMUX_Z80_THREADED_LABEL(T, N) \
+    label_##T##_##N: \
+    if constexpr (threadedNext(ThreadedTable##T, 0x##N) == ThreadedNextXxCb) { \
+        cbOffset = static_cast<int8_t>(fetchByte()); \
+        uint16_t address = regs.PC; \
+        uint8_t opcode = fetchByte(); \
+        putAddressOnBus(address, 2); \
+        goto *(ThreadedTable##T == ThreadedTableDD ? labelsDD_CB : labelsFD_CB)[opcode]; \
+    } else { \
+        op_##T##_##N<BusT>(this); \
+        isProcessingInstruction = false; \
+        \
+        if (tstate >= tstateBudget) { \
+            return; \
+        } \
+        \
+        if constexpr (threadedNext(ThreadedTable##T, 0x##N) == ThreadedNextNone) { \
+            if constexpr (hasIntLine) { \
+                if (tstate < intLineTstates) { \
+                    goto interrupt; \
+                } \
+            } \
+            \
+            shouldResetPv = false; \
+            shouldSkipNextInterrupt = false; \
+            isProcessingInstruction = true; \
+            \
+            goto *labels00[fetchOpcode()]; \
+        } else { \
+            shouldResetPv = false; \
+            shouldSkipNextInterrupt = false; \
+            isProcessingInstruction = true; \
+            \
+            goto *threadedLabels(threadedNext(ThreadedTable##T, 0x##N), \
+                    labelsCB, \
+                    labelsDD, \
+                    labelsED, \
+                    labelsFD)[fetchOpcode()]; \
+        } \
+    }
+
+namespace zemux {
+
+enum ThreadedTable {
+    ThreadedTable00,
+    ThreadedTableCB,
+    ThreadedTableDD,
+    ThreadedTableED,
+    ThreadedTableFD,
+    ThreadedTableDD_CB,
+    ThreadedTableFD_CB
+};
+
+enum ThreadedNext {
+    ThreadedNextNone,
+    ThreadedNextCb,
+    ThreadedNextDd,
+    ThreadedNextEd,
+    ThreadedNextFd,
+    ThreadedNextXxCb
+};
+
+static constexpr ThreadedNext threadedNext(ThreadedTable table, int opcode) {
+    if (table != ThreadedTable00 && table != ThreadedTableDD && table != ThreadedTableFD) {
+        return ThreadedNextNone;
+    }
+
+    switch (opcode) {
+        case 0xCB:
+            return (table == ThreadedTable00) ? ThreadedNextCb : ThreadedNextXxCb;
+
+        case 0xDD:
+            return ThreadedNextDd;
+
+        case 0xED:
+            return ThreadedNextEd;
+
+        case 0xFD:
+            return ThreadedNextFd;
+
+        default:
+            return ThreadedNextNone;
+    }
+}
+
+static constexpr void* const* threadedLabels(ThreadedNext next,
+        void* const* labelsCB,
+        void* const* labelsDD,
+        void* const* labelsED,
+        void* const* labelsFD) {
+
+    switch (next) {
+        case ThreadedNextCb:
+            return labelsCB;
+
+        case ThreadedNextDd:
+            return labelsDD;
+
+        case ThreadedNextEd:
+            return labelsED;
+
+        default:
+            return labelsFD;
+    }
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "OCDFAInspection"
+
+template<typename BusT>
+template<bool hasIntLine>
+__attribute__((flatten)) void BasicZ80Chip<BusT>::runThreaded(uint_fast32_t tstateBudget,
+        [[maybe_unused]] uint_fast32_t intLineTstates) {
+
+    static void* const labels00[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, 00) };
+    static void* const labelsCB[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, CB) };
+    static void* const labelsDD[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, DD) };
+    static void* const labelsED[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, ED) };
+    static void* const labelsFD[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, FD) };
+    static void* const labelsDD_CB[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, DD_CB) };
+    static void* const labelsFD_CB[0x100] = { ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL_ADDRESS, FD_CB) };
+
+    // Prefix may be pending after step() or after the previous run().
+    goto entry;
+
+next:
+    if (tstate >= tstateBudget) {
+        return;
+    }
+
+    if (hasIntLine && tstate < intLineTstates) {
+        goto interrupt;
+    }
+
+dispatch:
+    shouldResetPv = false;
+    shouldSkipNextInterrupt = false;
+    isProcessingInstruction = true;
+
+    goto *labels00[fetchOpcode()];
+
+interrupt:
+    if (hasIntLine) {
+        uint_fast32_t prevTstate = tstate;
+        executeInt();
+
+        // Accepted interrupt always takes some time (and in IM 0 it can even leave prefix pending).
+        if (tstate == prevTstate) {
+            goto dispatch;
+        }
+    }
+
+entry:
+    if (!prefix) {
+        goto next;
+    }
+
+    if (tstate >= tstateBudget) {
+        return;
+    }
+
+    shouldResetPv = false;
+    shouldSkipNextInterrupt = false;
+    isProcessingInstruction = true;
+
+    goto *threadedLabels(prefix == 0xCB ? ThreadedNextCb : (prefix == 0xDD ? ThreadedNextDd : (prefix == 0xED
+            ? ThreadedNextEd
+            : ThreadedNextFd)), labelsCB, labelsDD, labelsED, labelsFD)[fetchOpcode()];
+
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, 00)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, CB)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, DD)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, ED)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, FD)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, DD_CB)
+    ZEMUX_Z80_THREADED_HEX_256(ZEMUX_Z80_THREADED_LABEL, FD_CB)
+}
+
+#pragma clang diagnostic pop
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<false>(tstateBudget, 0);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+    runThreaded<false>(tstateBudget, 0);
+    runTstateBudget = 0;
+    return tstate;
+}
+
+template<typename BusT>
+uint_fast32_t BasicZ80Chip<BusT>::run(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates) {
+    tstate = 0;
+
+    if (trace) {
+        runTraced<true>(tstateBudget, intLineTstates);
+        return tstate;
+    }
+
+    runTstateBudget = tstateBudget;
+    runIntLineTstates = intLineTstates;
+    runThreaded<true>(tstateBudget, intLineTstates);
+    runTstateBudget = 0;
+    runIntLineTstates = 0;
+    return tstate;
+}
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "z80_chip.h"
+
+#ifdef ZEMUX_Z80_PROFILER
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace zemux {
+
+struct Z80ChipProfileEntry {
+    Z80ChipProfile::Table table;
+    int opcode;
+    uint64_t executions;
+    uint64_t tstates;
+};
+
+static const char* const profileTableNames[Z80ChipProfile::TABLES] = {
+        "",
+        "CB ",
+        "DD ",
+        "ED ",
+        "FD ",
+        "DD CB ",
+        "FD CB ",
+};
+
+static const char* const profileCallbackNames[Z80ChipProfile::CALLBACKS] = {
+        "MreqM1",
+        "MreqRd",
+        "MreqWr",
+        "IorqRd",
+        "IorqWr",
+        "IorqM1",
+        "PutAddress",
+};
+
+static std::vector<Z80ChipProfileEntry> collectProfileEntries(const Z80ChipProfile& profile) {
+    std::vector<Z80ChipProfileEntry> entries;
+
+    for (int table = 0; table < Z80ChipProfile::TABLES; ++table) {
+        for (int opcode = 0; opcode < 0x100; ++opcode) {
+            if (profile.opcodeExecutions[table][opcode]) {
+                entries.push_back(Z80ChipProfileEntry {
+                        static_cast<Z80ChipProfile::Table>(table),
+                        opcode,
+                        profile.opcodeExecutions[table][opcode],
+                        profile.opcodeTstates[table][opcode] });
+            }
+        }
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.tstates > b.tstates;
+    });
+
+    return entries;
+}
+
+static std::string profileOpcodeName(const Z80ChipProfileEntry& entry) {
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%s%02X", profileTableNames[entry.table], entry.opcode);
+    return buffer;
+}
+
+void Z80ChipProfile::reset() {
+    *this = Z80ChipProfile {};
+}
+
+void Z80ChipProfile::writeReport(std::ostream& os, int maxOpcodes) const {
+    auto entries = collectProfileEntries(*this);
+    uint64_t totalExecutions = 0;
+    uint64_t totalTstates = 0;
+
+    for (const auto& entry : entries) {
+        totalExecutions += entry.executions;
+        totalTstates += entry.tstates;
+    }
+
+    os << "opcodes: " << totalExecutions << " executions, " << totalTstates << " T-states\n";
+    char buffer[64];
+
+    for (int i = 0, count = std::min(maxOpcodes, static_cast<int>(entries.size())); i < count; ++i) {
+        const auto& entry = entries[i];
+
+        std::snprintf(buffer,
+                sizeof(buffer),
+                "  %-8s %12" PRIu64 " %14" PRIu64 " %6.2f%%\n",
+                profileOpcodeName(entry).c_str(),
+                entry.executions,
+                entry.tstates,
+                totalTstates ? static_cast<double>(entry.tstates) * 100.0 / static_cast<double>(totalTstates) : 0.0);
+
+        os << buffer;
+    }
+
+    os << "callbacks:\n";
+
+    for (int callback = 0; callback < CALLBACKS; ++callback) {
+        os << "  " << profileCallbackNames[callback] << ' ' << callbackCalls[callback] << '\n';
+    }
+}
+
+void Z80ChipProfile::writeCsv(std::ostream& os) const {
+    os << "name,executions,tstates\n";
+
+    for (const auto& entry : collectProfileEntries(*this)) {
+        os << profileOpcodeName(entry) << ',' << entry.executions << ',' << entry.tstates << '\n';
+    }
+
+    for (int callback = 0; callback < CALLBACKS; ++callback) {
+        os << "callback " << profileCallbackNames[callback] << ',' << callbackCalls[callback] << ",0\n";
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <cstdio>
+#include "z80_chip.h"
+
+namespace zemux {
+
+static unsigned int roundUpToPowerOfTwo(unsigned int value) {
+    unsigned int result = 1;
+
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+Z80ChipTrace::Z80ChipTrace(unsigned int capacity, bool isRegsTraced) :
+        entries(roundUpToPowerOfTwo(capacity)),
+        mask { entries.size() - 1 },
+        isRegsTraced { isRegsTraced } {
+}
+
+void Z80ChipTrace::clear() {
+    count = 0;
+    tstate = 0;
+}
+
+void Z80ChipTrace::setTrigger(uint16_t address, TriggerCallback callback, void* data) {
+    if (callback == nullptr) {
+        removeTrigger();
+        return;
+    }
+
+    triggerAddress = address;
+    triggerCallback = callback;
+    triggerData = data;
+}
+
+void Z80ChipTrace::removeTrigger() {
+    triggerAddress = -1;
+    triggerCallback = nullptr;
+    triggerData = nullptr;
+}
+
+void Z80ChipTrace::dump(std::ostream& os, unsigned int maxEntries) const {
+    unsigned int size = getSize();
+    char buffer[192];
+
+    for (unsigned int index = size - std::min(size, maxEntries); index < size; ++index) {
+        const auto& entry = getEntry(index);
+
+        if (entry.prefix) {
+            std::snprintf(buffer,
+                    sizeof(buffer),
+                    "%10llu %04X %02X %02X",
+                    static_cast<unsigned long long>(entry.tstate),
+                    entry.pc,
+                    entry.prefix,
+                    entry.opcode);
+        } else {
+            std::snprintf(buffer,
+                    sizeof(buffer),
+                    "%10llu %04X    %02X",
+                    static_cast<unsigned long long>(entry.tstate),
+                    entry.pc,
+                    entry.opcode);
+        }
+
+        os << buffer;
+
+        if (isRegsTraced) {
+            const auto& regs = entry.regs;
+
+            std::snprintf(buffer,
+                    sizeof(buffer),
+                    " AF=%04X BC=%04X DE=%04X HL=%04X IX=%04X IY=%04X SP=%04X MP=%04X"
+                    " AF'=%04X BC'=%04X DE'=%04X HL'=%04X I=%02X R=%02X IFF1=%d IFF2=%d IM=%d",
+                    regs.AF,
+                    regs.BC,
+                    regs.DE,
+                    regs.HL,
+                    regs.IX,
+                    regs.IY,
+                    regs.SP,
+                    regs.MP,
+                    regs.AF_,
+                    regs.BC_,
+                    regs.DE_,
+                    regs.HL_,
+                    regs.I,
+                    regs.R,
+                    regs.IFF1,
+                    regs.IFF2,
+                    regs.IM);
+
+            os << buffer;
+        }
+
+        os << '\n';
+    }
+}
+
+}
@@ -29,38 +29,460 @@
 #include <memory>
 #include <array>
 #include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <thread>
 #include <zemux_core/non_copyable.h>
 #include <zemux_core/chronometer.h>
+#include <zemux_integrated/z80_chip.h>
 #include "event.h"
 
 namespace zemux {
 
-class Z80Chip;
 class Device;
 class MemoryDevice;
 class ExtPortDevice;
 class Tape;
 
 struct BusMreqRdElement {
-    uint8_t (* callback)(void* data, int mreqRdLayer, uint16_t address, bool isM1);
+    using Callback = uint8_t (*)(void* data, int mreqRdLayer, uint16_t address, bool isM1);
+
+    Callback callback;
     void* data;
 };
 
 struct BusMreqWrElement {
-    void (* callback)(void* data, int mreqWrLayer, uint16_t address, uint8_t value);
+    using Callback = void (*)(void* data, int mreqWrLayer, uint16_t address, uint8_t value);
+
+    Callback callback;
     void* data;
 };
 
 struct BusIorqRdElement {
-    uint8_t (* callback)(void* data, int iorqRdLayer, uint16_t port);
+    using Callback = uint8_t (*)(void* data, int iorqRdLayer, uint16_t port);
+
+    Callback callback;
     void* data;
 };
 
 struct BusIorqWrElement {
-    void (* callback)(void* data, int iorqWrLayer, uint16_t port, uint8_t value);
+    using Callback = void (*)(void* data, int iorqWrLayer, uint16_t port, uint8_t value);
+
+    Callback callback;
     void* data;
 };
 
+// Element of the decode image. Instead of the data pointer it holds an index in the data table of the bus
+// (Bus::slots), so the same image could be used by several buses.
+template<typename CallbackT>
+struct BusSlotElement {
+    CallbackT callback;
+    int slot;
+};
+
+using BusMreqRdSlotElement = BusSlotElement<BusMreqRdElement::Callback>;
+using BusMreqWrSlotElement = BusSlotElement<BusMreqWrElement::Callback>;
+using BusIorqRdSlotElement = BusSlotElement<BusIorqRdElement::Callback>;
+using BusIorqWrSlotElement = BusSlotElement<BusIorqWrElement::Callback>;
+
+// Resolvers return host pointer to the beginning of the page with the given address,
+// or nullptr if the page is not plain memory (in the current state of the device).
+using BusMreqRdResolver = uint8_t* (*)(void* data, int mreqRdLayer, uint16_t address, bool isM1);
+using BusMreqWrResolver = uint8_t* (*)(void* data, int mreqWrLayer, uint16_t address);
+
+struct BusMreqRdPage {
+    BusMreqRdResolver resolver;
+    int slot;
+};
+
+struct BusMreqWrPage {
+    BusMreqWrResolver resolver;
+    int slot;
+};
+
+// MREQ maps are two-level: layer has a table of pages (Z80ChipMemoryPages::PAGE_SIZE addresses each).
+// Page where all elements are the same holds a single element (mask = 0), such pages are shared
+// between layers and between M1 and non-M1 halves of the map.
+template<typename ElementT>
+struct BusMapPage {
+    ElementT* elements;
+    int mask;
+
+    ZEMUX_FORCE_INLINE ElementT& element(int address) {
+        return elements[address & mask];
+    }
+};
+
+using BusMreqRdMapPage = BusMapPage<BusMreqRdSlotElement>;
+using BusMreqWrMapPage = BusMapPage<BusMreqWrSlotElement>;
+
+// Owns elements of the map pages, equal pages are stored only once.
+template<typename ElementT>
+class BusMapPageStore final : private NonCopyable {
+public:
+
+    BusMapPageStore() = default;
+    ~BusMapPageStore() = default;
+
+    BusMapPage<ElementT> acquireUniform(ElementT element);
+    BusMapPage<ElementT> acquire(const ElementT* elements); // Z80ChipMemoryPages::PAGE_SIZE elements
+    void clear();
+
+    // Pages are not reference-counted, so unused pages are freed by the owner of the tables.
+    bool isGarbageExpected();
+    void collectGarbage(std::vector<const ElementT*>& usedElements);
+
+private:
+
+    std::vector<std::unique_ptr<ElementT[]>> uniformPages;
+    std::vector<std::unique_ptr<ElementT[]>> detailedPages;
+    std::size_t pagesAfterCollect = 0;
+};
+
+// Element is used for every map index where (index & mask) == value, in every layer where
+// (layer & layerMask) == layerValue. Rules are applied in the device order, later rules override earlier ones.
+// For MREQ RD index is address + Bus::ELEMENTS_MREQ_RD_BASE for M1 cycles, so rule which doesn't have this bit
+// in the mask is used for both M1 and non-M1 cycles.
+// When isPassThrough is set (MREQ maps only), overridden page is saved to the pass-through map of the layer
+// (see Bus::getMreqRdPassElement). Pass-through rules of the same layer must not overlap.
+template<typename ElementT>
+struct BusRule {
+    int mask;
+    int value;
+    ElementT element;
+    int layerMask = 0;
+    int layerValue = 0;
+    bool isPassThrough = false;
+};
+
+using BusMreqRdRule = BusRule<BusMreqRdElement>;
+using BusMreqWrRule = BusRule<BusMreqWrElement>;
+using BusIorqRdRule = BusRule<BusIorqRdElement>;
+using BusIorqWrRule = BusRule<BusIorqWrElement>;
+
+using BusMreqRdSlotRule = BusRule<BusMreqRdSlotElement>;
+using BusMreqWrSlotRule = BusRule<BusMreqWrSlotElement>;
+using BusIorqRdSlotRule = BusRule<BusIorqRdSlotElement>;
+using BusIorqWrSlotRule = BusRule<BusIorqWrSlotElement>;
+
+// Alternative to the flat IORQ maps. Rules of every layer are compiled into buckets by the lower byte of the port,
+// bucket holds only rules matching this lower byte (checked by the upper byte, the most prior first),
+// and always ends with the rule which matches any upper byte.
+template<typename ElementT, std::size_t LAYERS>
+class BusPortDecoder final : private NonCopyable {
+public:
+
+    static constexpr int BUCKETS = 0x100;
+
+    BusPortDecoder() = default;
+    ~BusPortDecoder() = default;
+
+    // Rules must match the layer and be in the order of application.
+    void compile(int layer, const std::vector<BusRule<ElementT>>& rules, ElementT fallback);
+
+    // Compiles again only buckets where (lower & lowerMask) == lowerValue.
+    void recompile(
+            int layer,
+            int lowerMask,
+            int lowerValue,
+            const std::vector<BusRule<ElementT>>& rules,
+            ElementT fallback);
+
+    ElementT lookup(int layer, uint16_t port) const {
+        auto entry = &entries[layer][buckets[layer][port & 0xFF]];
+        int upper = port >> 8;
+
+        while ((upper & entry->mask) != entry->value) {
+            ++entry;
+        }
+
+        return entry->element;
+    }
+
+private:
+
+    struct Entry {
+        int mask;
+        int value;
+        ElementT element;
+    };
+
+    std::array<std::vector<Entry>, LAYERS> entries;
+    std::array<std::vector<std::pair<std::size_t, std::size_t>>, LAYERS> ranges;
+    std::array<std::size_t, LAYERS> entriesAfterCompile {};
+    std::array<std::array<uint32_t, BUCKETS>, LAYERS> buckets {};
+    std::vector<Entry> bucketEntries;
+
+    void compileBucket(int layer, int lower, const std::vector<BusRule<ElementT>>& rules, ElementT fallback);
+};
+
+// Small direct-mapped cache of recently decoded ports. Decoder may be shared, so the cache belongs to the bus.
+template<typename ElementT, std::size_t LAYERS>
+class BusPortCache final : private NonCopyable {
+public:
+
+    static constexpr int SIZE_BITS = 6;
+    static constexpr int SIZE = 1 << SIZE_BITS;
+
+    BusPortCache() {
+        invalidate();
+    }
+
+    ~BusPortCache() = default;
+
+    ZEMUX_FORCE_INLINE ElementT decode(const BusPortDecoder<ElementT, LAYERS>* decoder, int layer, uint16_t port) {
+        int key = (layer << 16) | port;
+
+        // Fibonacci hashing, so ports which differ only in the upper bits (like #7FFD, #BFFD and #FFFD)
+        // get different slots.
+        auto& slot = slots[(static_cast<uint32_t>(key) * 0x9E3779B1u) >> (32 - SIZE_BITS)];
+
+        if (slot.key != key) {
+            slot.key = key;
+            slot.element = decoder->lookup(layer, port);
+        }
+
+        return slot.element;
+    }
+
+    void invalidate() {
+        // Valid keys are never negative.
+        slots.fill(Slot { .key = -1, .element = ElementT {} });
+    }
+
+private:
+
+    struct Slot {
+        int key;
+        ElementT element;
+    };
+
+    std::array<Slot, SIZE> slots;
+};
+
+// Maps built from the device rules. Elements refer to the data via slots, so the image doesn't depend on the bus
+// instance, and buses with the same configuration use the same image (see BusDecodeImageCache).
+// Image must not be changed while it is shared.
+class BusDecodeImage final : private NonCopyable {
+public:
+
+    enum IorqDecoder {
+        IorqDecoderMaps = 0, // flat maps, 64K elements per layer
+        IorqDecoderRules = 1, // BusPortDecoder
+    };
+
+    static constexpr int SLOT_NULL = 0;
+    static constexpr int SLOT_BUS = 1;
+
+    static constexpr int ELEMENTS_MREQ_RD_BASE = 0x10000;
+    static constexpr int ELEMENTS_IORQ_RD = 0x10000;
+    static constexpr int ELEMENTS_IORQ_WR = 0x10000;
+    static constexpr int PAGES_MREQ_RD_BASE = Z80ChipMemoryPages::PAGES;
+    static constexpr int PAGES_MREQ_RD_FULL = PAGES_MREQ_RD_BASE * 2;
+    static constexpr int PAGES_MREQ_WR = Z80ChipMemoryPages::PAGES;
+
+    static constexpr int LAYERS_MREQ_RD = 8;
+    static constexpr int LAYERS_MREQ_WR = 4;
+    static constexpr int LAYERS_IORQ_RD = 8;
+    static constexpr int LAYERS_IORQ_WR = 8;
+
+    struct DeviceRules {
+        std::vector<BusMreqRdSlotRule> mreqRd;
+        std::vector<BusMreqWrSlotRule> mreqWr;
+        std::vector<BusIorqRdSlotRule> iorqRd;
+        std::vector<BusIorqWrSlotRule> iorqWr;
+    };
+
+    // Everything the image is built from.
+    struct Configuration {
+        std::vector<DeviceRules> deviceRules;
+        std::vector<std::pair<BusMreqRdElement::Callback, BusMreqRdResolver>> mreqRdResolvers;
+        std::vector<std::pair<BusMreqWrElement::Callback, BusMreqWrResolver>> mreqWrResolvers;
+        IorqDecoder iorqDecoder = IorqDecoderRules;
+    };
+
+    std::array<std::array<BusMreqRdMapPage, PAGES_MREQ_RD_FULL>, LAYERS_MREQ_RD> mreqRdMapLayers {};
+    std::array<std::array<BusMreqWrMapPage, PAGES_MREQ_WR>, LAYERS_MREQ_WR> mreqWrMapLayers {};
+    std::array<std::array<BusMreqRdMapPage, PAGES_MREQ_RD_FULL>, LAYERS_MREQ_RD> mreqRdPassLayers {};
+    std::array<std::array<BusMreqWrMapPage, PAGES_MREQ_WR>, LAYERS_MREQ_WR> mreqWrPassLayers {};
+    std::array<std::array<BusMreqRdPage, PAGES_MREQ_RD_FULL>, LAYERS_MREQ_RD> mreqRdPageLayers {};
+    std::array<std::array<BusMreqWrPage, PAGES_MREQ_WR>, LAYERS_MREQ_WR> mreqWrPageLayers {};
+    std::array<std::unique_ptr<BusIorqRdSlotElement[]>, LAYERS_IORQ_RD> iorqRdMapLayers;
+    std::array<std::unique_ptr<BusIorqWrSlotElement[]>, LAYERS_IORQ_WR> iorqWrMapLayers;
+    BusPortDecoder<BusIorqRdSlotElement, LAYERS_IORQ_RD> iorqRdDecoder;
+    BusPortDecoder<BusIorqWrSlotElement, LAYERS_IORQ_WR> iorqWrDecoder;
+
+    explicit BusDecodeImage(Configuration configuration);
+    ~BusDecodeImage() = default;
+
+    const Configuration& getConfiguration();
+
+    // Compares with the other configuration, where rules of the device at deviceIndex are replaced
+    // with the given rules (if rules is not nullptr).
+    bool isSameConfiguration(const Configuration& other, std::size_t deviceIndex, const DeviceRules* rules);
+
+    // Replaces rules of the single device and rebuilds only elements covered by changed rules.
+    // Returns true when resolvers of memory pages may be changed.
+    bool reconfigureDevice(std::size_t deviceIndex, DeviceRules& rules);
+
+    // Brings the image to the other configuration by reconfiguring every changed device.
+    // Returns false (leaving the image intact) when the configurations differ in anything except device rules.
+    bool reconfigure(const Configuration& other);
+
+    static bool isSameDeviceRules(const DeviceRules& a, const DeviceRules& b);
+
+private:
+
+    Configuration configuration;
+    BusMapPageStore<BusMreqRdSlotElement> mreqRdPageStore;
+    BusMapPageStore<BusMreqWrSlotElement> mreqWrPageStore;
+
+    void configureIorqMaps();
+    void configureMreqRdPage(int layer, int page);
+    void configureMreqWrPage(int layer, int page);
+
+    template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+    void configurePagedMap(
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+            BusMapPageStore<ElementT>& store,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember);
+
+    template<typename ElementT, std::size_t PAGES, std::size_t LAYERS, typename OnChangedT>
+    void reconfigurePagedMap(
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+            BusMapPageStore<ElementT>& store,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+            DeviceRules& deviceEntry,
+            std::vector<BusRule<ElementT>>& rules,
+            OnChangedT onChanged);
+
+    template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+    BusMapPage<ElementT> resolvePage(
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+            BusMapPageStore<ElementT>& store,
+            int layer,
+            int page,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember);
+
+    template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+    void collectPageGarbage(
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+            std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+            BusMapPageStore<ElementT>& store);
+
+    template<typename ElementT, std::size_t LAYERS>
+    void configureMap(
+            std::array<std::unique_ptr<ElementT[]>, LAYERS>& mapLayers,
+            int elements,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember);
+
+    template<typename ElementT, std::size_t LAYERS>
+    void reconfigureMap(
+            std::array<std::unique_ptr<ElementT[]>, LAYERS>& mapLayers,
+            int elements,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+            DeviceRules& deviceEntry,
+            std::vector<BusRule<ElementT>>& rules);
+
+    template<typename ElementT, std::size_t LAYERS>
+    void configurePortDecoder(
+            BusPortDecoder<ElementT, LAYERS>& decoder,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember);
+
+    template<typename ElementT, std::size_t LAYERS>
+    void reconfigurePortDecoder(
+            BusPortDecoder<ElementT, LAYERS>& decoder,
+            ElementT fallback,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+            DeviceRules& deviceEntry,
+            std::vector<BusRule<ElementT>>& rules);
+
+    template<typename ElementT>
+    void collectLayerRules(
+            std::vector<BusRule<ElementT>>& layerRules,
+            int layer,
+            std::vector<BusRule<ElementT>> DeviceRules::* rulesMember);
+};
+
+// Process-wide registry of published decode images (held weakly), thread-safe.
+class BusDecodeImageCache final {
+public:
+
+    // Finds the image for the configuration, where rules of the device at deviceIndex are replaced
+    // with the given rules (if rules is not nullptr).
+    static std::shared_ptr<BusDecodeImage> find(
+            const BusDecodeImage::Configuration& configuration,
+            std::size_t deviceIndex,
+            const BusDecodeImage::DeviceRules* rules);
+
+    // Returns already published image with the same configuration, or publishes the given one.
+    static std::shared_ptr<BusDecodeImage> publish(const std::shared_ptr<BusDecodeImage>& image);
+
+    // Unpublishes the image when the caller is its only user, so it could be changed in place.
+    static bool withdraw(const std::shared_ptr<BusDecodeImage>& image);
+
+private:
+
+    static std::mutex mutex;
+    static std::vector<std::weak_ptr<BusDecodeImage>> images;
+};
+
+// Single persistent thread, which builds decode images for all buses in the background reconfigure mode.
+// It is started on the first use, jobs are built in the order of submission.
+class BusDecodeImageWorker final : private NonCopyable {
+public:
+
+    using BuildFunc = std::function<std::shared_ptr<BusDecodeImage>()>;
+
+    struct Job {
+        BuildFunc build;
+        std::shared_ptr<BusDecodeImage> image; // only after isDone
+        std::exception_ptr failure;
+        bool isDone = false;
+    };
+
+    static BusDecodeImageWorker& getInstance();
+
+    std::shared_ptr<Job> submit(BuildFunc build);
+
+    // Waits until the job is built, rethrows exception of the build (if any).
+    std::shared_ptr<BusDecodeImage> wait(Job& job);
+
+    ~BusDecodeImageWorker();
+
+private:
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::shared_ptr<Job>> queue;
+    bool isStopping = false;
+    std::thread thread;
+
+    BusDecodeImageWorker();
+    void run();
+};
+
+// Emulated state of the bus, which is saved to machine snapshots.
+struct BusState {
+    int mreqRdLayer;
+    int mreqWrLayer;
+    int iorqRdLayer;
+    int iorqWrLayer;
+    int cpuClockRatio;
+    uint_fast32_t cpuTstatesPassed;
+};
+
 class BusOwner {
 public:
 
@@ -76,40 +498,67 @@ protected:
 class Bus final : private NonCopyable {
 public:
 
-    static constexpr int ELEMENTS_MREQ_RD_BASE = 0x10000;
-    static constexpr int ELEMENTS_MREQ_RD_FULL = ELEMENTS_MREQ_RD_BASE * 2;
-    static constexpr int ELEMENTS_MREQ_RD_BASE_MASK = 0xFFFF;
-    static constexpr int ELEMENTS_MREQ_WR = 0x10000;
-    static constexpr int ELEMENTS_IORQ_RD = 0x10000;
-    static constexpr int ELEMENTS_IORQ_WR = 0x10000;
+    using IorqDecoder = BusDecodeImage::IorqDecoder;
+
+    enum ReconfigureMode {
+        ReconfigureImmediate = 0, // maps are changed right away, even in the middle of the instruction
+        ReconfigureDeferred = 1, // new maps are built aside right away and swapped at the next instruction boundary
+        ReconfigureBackground = 2, // maps are built by the worker thread and swapped at the next machine deadline
+    };
+
+    static constexpr int ELEMENTS_MREQ_RD_BASE = BusDecodeImage::ELEMENTS_MREQ_RD_BASE;
+    static constexpr int ELEMENTS_IORQ_RD = BusDecodeImage::ELEMENTS_IORQ_RD;
+    static constexpr int ELEMENTS_IORQ_WR = BusDecodeImage::ELEMENTS_IORQ_WR;
+    static constexpr int MASK_ADDRESS = 0xFFFF;
+    static constexpr int MASK_PORT = 0xFFFF;
+    static constexpr int PAGES_MREQ_RD_BASE = BusDecodeImage::PAGES_MREQ_RD_BASE;
+    static constexpr int PAGES_MREQ_RD_FULL = BusDecodeImage::PAGES_MREQ_RD_FULL;
+    static constexpr int PAGES_MREQ_WR = BusDecodeImage::PAGES_MREQ_WR;
 
     static constexpr int OVERLAY_MREQ_RD_TRDOS = 0b0000'0001;
-    static constexpr int OVERLAY_MREQ_RD_TRDOS_LMASK = 0b0000'0000;
-    static constexpr int OVERLAY_MREQ_RD_TRDOS_UMASK = 0b1111'1110;
     static constexpr int OVERLAY_IORQ_RD_TRDOS = 0b0000'0001;
     static constexpr int OVERLAY_IORQ_WR_TRDOS = 0b0000'0001;
 
-    static constexpr int LAYERS_MREQ_RD = 2;
-    static constexpr int LAYERS_MREQ_WR = 1;
-    static constexpr int LAYERS_IORQ_RD = 2;
-    static constexpr int LAYERS_IORQ_WR = 2;
+    // Debugger and profiler overlays must be the highest bits, these devices rely on being configured last
+    // (profiler after debugger, so it sees every access, including ones reported by the debugger).
+    static constexpr int OVERLAY_MREQ_RD_DEBUGGER = 0b0000'0010;
+    static constexpr int OVERLAY_MREQ_WR_DEBUGGER = 0b0000'0001;
+    static constexpr int OVERLAY_IORQ_RD_DEBUGGER = 0b0000'0010;
+    static constexpr int OVERLAY_IORQ_WR_DEBUGGER = 0b0000'0010;
 
-    BusMreqRdElement* mreqRdMap;
-    BusMreqWrElement* mreqWrMap;
-    BusIorqRdElement* iorqRdMap;
-    BusIorqWrElement* iorqWrMap;
+    static constexpr int OVERLAY_MREQ_RD_PROFILER = 0b0000'0100;
+    static constexpr int OVERLAY_MREQ_WR_PROFILER = 0b0000'0010;
+    static constexpr int OVERLAY_IORQ_RD_PROFILER = 0b0000'0100;
+    static constexpr int OVERLAY_IORQ_WR_PROFILER = 0b0000'0100;
 
-    std::array<std::unique_ptr<BusMreqRdElement[]>, LAYERS_MREQ_RD> mreqRdMapLayers;
-    std::array<std::unique_ptr<BusMreqWrElement[]>, LAYERS_MREQ_WR> mreqWrMapLayers;
-    std::array<std::unique_ptr<BusIorqRdElement[]>, LAYERS_IORQ_RD> iorqRdMapLayers;
-    std::array<std::unique_ptr<BusIorqWrElement[]>, LAYERS_IORQ_WR> iorqWrMapLayers;
+    // Overlays, which are toggled by the emulated machine itself. Debugger and profiler overlays are toggled
+    // by the host, so they are neither saved nor restored with the bus state.
+    static constexpr int STATE_OVERLAYS_MREQ_RD = OVERLAY_MREQ_RD_TRDOS;
+    static constexpr int STATE_OVERLAYS_MREQ_WR = 0;
+    static constexpr int STATE_OVERLAYS_IORQ_RD = OVERLAY_IORQ_RD_TRDOS;
+    static constexpr int STATE_OVERLAYS_IORQ_WR = OVERLAY_IORQ_WR_TRDOS;
 
-    Z80Chip* cpu = nullptr;
+    static constexpr int LAYERS_MREQ_RD = BusDecodeImage::LAYERS_MREQ_RD;
+    static constexpr int LAYERS_MREQ_WR = BusDecodeImage::LAYERS_MREQ_WR;
+    static constexpr int LAYERS_IORQ_RD = BusDecodeImage::LAYERS_IORQ_RD;
+    static constexpr int LAYERS_IORQ_WR = BusDecodeImage::LAYERS_IORQ_WR;
+
+    BusMreqRdMapPage* mreqRdMap;
+    BusMreqWrMapPage* mreqWrMap;
+    BusIorqRdSlotElement* iorqRdMap;
+    BusIorqWrSlotElement* iorqWrMap;
+    void** slots;
+
+    BasicZ80Chip<Bus>* cpu = nullptr;
     EventEmitter* hostEmitter = nullptr;
     MemoryDevice* memoryDevice = nullptr;
     ExtPortDevice* extPortDevice = nullptr;
     Tape* tape = nullptr;
 
+    // Set by the machine during the run-ahead. Speculative frames are discarded, so devices shouldn't change
+    // the state, which is not restored with the snapshot (e.g. sound chips and sound output), or report to the host.
+    bool isSpeculative = false;
+
     Bus(BusOwner* owner, ChronometerNarrow* cpuChronometer);
     ~Bus() = default;
 
@@ -123,35 +572,221 @@ public:
     void toggleIorqRdOverlay(int iorqRdOverlay, bool isEnabled);
     void toggleIorqWrOverlay(int iorqWrOverlay, bool isEnabled);
 
+    // Both decoders give the same elements, maps are faster on miss but take much more memory.
+    void setIorqDecoder(IorqDecoder decoder);
+    IorqDecoder getIorqDecoder();
+
+    // When enabled (by default), buses with the same configuration use the same decode image.
+    // Changed image is copied before the change, unless the bus is its only user.
+    void setDecodeImageShared(bool isShared);
+    const BusDecodeImage* getDecodeImage();
+
+    // In the deferred mode the current maps stay active until the next opcode fetch (M1), so instruction
+    // is never executed with mixed maps, but the maps are still built inside the call that changed devices.
+    // In the background mode the worker builds new maps while the emulation continues with the current ones
+    // until the next onMachineDeadline(). Swap waits for the worker, if it is not done yet, so the swap point
+    // doesn't depend on the host scheduling and emulation stays deterministic.
+    void setReconfigureMode(ReconfigureMode mode);
+    ReconfigureMode getReconfigureMode();
+    bool isReconfigurePending();
+
+    // Swaps the pending maps right away (waiting for the worker if needed).
+    void flushReconfigure();
+
+    // Called by the machine between CPU runs (at the deadlines of its timeline, e.g. INT or end of the frame).
+    void onMachineDeadline();
+
+    // Resolver will be used for pages, where all elements have the same callback and data.
+    void registerMreqRdResolver(BusMreqRdElement::Callback callback, BusMreqRdResolver resolver);
+    void registerMreqWrResolver(BusMreqWrElement::Callback callback, BusMreqWrResolver resolver);
+
+    // Should be called by devices when the memory behind the published pages is changed (e.g. on remap).
+    void updateMemoryPages();
+
+    // Same as above, but only for count pages starting from firstPage (e.g. when one memory window is remapped).
+    void updateMemoryPages(int firstPage, int count);
+
+    // Pages, which are currently published to the CPU.
+    const Z80ChipMemoryPages& getMemoryPages();
+
+    // Same as above, but only for writes (e.g. when memory device starts or stops trapping writes to some pages).
+    void updateMemoryWrPage(uint16_t address);
+    void updateMemoryWrPages();
+
+    // Withdraws every page, which is published for writes, without asking resolvers. Should be called
+    // when writes to all pages become trapped (e.g. when memory device clears dirty pages).
+    void withdrawMemoryWrPages();
+
+    // Should be called by devices before the memory, which may have been published, is released
+    // (e.g. when the shared memory bank is copied), so CPU forgets the cached code of it.
+    void releaseMemory(const uint8_t* memory, size_t size);
+
+    // Should be called by devices when they write to the memory, which may be published (e.g. in the write
+    // callbacks), so CPU invalidates cached code of it. Host page is the same pointer, that the resolver returns.
+    ZEMUX_FORCE_INLINE void onMemoryWrite([[maybe_unused]] uint8_t* hostPage, [[maybe_unused]] uint8_t offset) {
+#ifdef ZEMUX_Z80_CODE_CACHE
+        if (cpu != nullptr) {
+            cpu->invalidateCodeCache(hostPage, offset);
+        }
+#endif
+    }
+
+    [[nodiscard]] BusState getState();
+    void setState(const BusState& state);
+
+    // Collects rules of the single device again and rebuilds only elements covered by changed rules.
+    // Device must be configured by the last onMachineReconfigure(), otherwise nothing happens.
+    void reconfigureDevice(Device* device);
+
     void onMachineReconfigure(std::vector<Device*>& devices);
     void onMachineReset();
 
-    static uint8_t onCpuMreqRd(void* data, uint16_t address, bool isM1);
-    static void onCpuMreqWr(void* data, uint16_t address, uint8_t value);
-    static uint8_t onCpuIorqRd(void* data, uint16_t port);
-    static void onCpuIorqWr(void* data, uint16_t port, uint8_t value);
-    static uint8_t onCpuIorqM1(void* data);
-    static void onCpuPutAddress(void* data, uint16_t address, uint_fast32_t cycles);
+    ZEMUX_FORCE_INLINE BusMreqRdElement getMreqRdElement(int layer, uint16_t address, bool isM1) {
+        auto& page = decodeImage->mreqRdMapLayers[layer][(address >> Z80ChipMemoryPages::PAGE_BITS)
+                + (isM1 ? PAGES_MREQ_RD_BASE : 0)];
+
+        return toElement<BusMreqRdElement>(page.element(address));
+    }
+
+    ZEMUX_FORCE_INLINE BusMreqWrElement getMreqWrElement(int layer, uint16_t address) {
+        auto& page = decodeImage->mreqWrMapLayers[layer][address >> Z80ChipMemoryPages::PAGE_BITS];
+        return toElement<BusMreqWrElement>(page.element(address));
+    }
+
+    // Elements overridden by pass-through rules.
+
+    ZEMUX_FORCE_INLINE BusMreqRdElement getMreqRdPassElement(int layer, uint16_t address, bool isM1) {
+        auto& page = decodeImage->mreqRdPassLayers[layer][(address >> Z80ChipMemoryPages::PAGE_BITS)
+                + (isM1 ? PAGES_MREQ_RD_BASE : 0)];
+
+        return toElement<BusMreqRdElement>(page.element(address));
+    }
+
+    ZEMUX_FORCE_INLINE BusMreqWrElement getMreqWrPassElement(int layer, uint16_t address) {
+        auto& page = decodeImage->mreqWrPassLayers[layer][address >> Z80ChipMemoryPages::PAGE_BITS];
+        return toElement<BusMreqWrElement>(page.element(address));
+    }
+
+    ZEMUX_FORCE_INLINE BusIorqRdElement getIorqRdElement(int layer, uint16_t port) {
+        return toElement<BusIorqRdElement>((iorqDecoder == BusDecodeImage::IorqDecoderMaps)
+                ? decodeImage->iorqRdMapLayers[layer][port]
+                : iorqRdCache.decode(iorqRdDecoder, layer, port));
+    }
+
+    ZEMUX_FORCE_INLINE BusIorqWrElement getIorqWrElement(int layer, uint16_t port) {
+        return toElement<BusIorqWrElement>((iorqDecoder == BusDecodeImage::IorqDecoderMaps)
+                ? decodeImage->iorqWrMapLayers[layer][port]
+                : iorqWrCache.decode(iorqWrDecoder, layer, port));
+    }
+
+    // CPU is instantiated over the Bus, so these are inlined into the opcode handlers.
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuMreqRd(uint16_t address, bool isM1) {
+        // Direct M1 pages are not published while deferred reconfiguration is pending,
+        // so every opcode fetch comes here.
+        if (isM1 && isPendingImage && reconfigureMode == ReconfigureDeferred) {
+            onInstructionBoundary();
+        }
+
+        auto elem = mreqRdMap[(address >> Z80ChipMemoryPages::PAGE_BITS) + (isM1 ? PAGES_MREQ_RD_BASE : 0)]
+                .element(address);
+
+        return elem.callback(slots[elem.slot], mreqRdLayer, address, isM1);
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuMreqWr(uint16_t address, uint8_t value) {
+        auto elem = mreqWrMap[address >> Z80ChipMemoryPages::PAGE_BITS].element(address);
+        elem.callback(slots[elem.slot], mreqWrLayer, address, value);
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqRd(uint16_t port) {
+        auto elem = (iorqDecoder == BusDecodeImage::IorqDecoderMaps)
+                ? iorqRdMap[port]
+                : iorqRdCache.decode(iorqRdDecoder, iorqRdLayer, port);
+
+        return elem.callback(slots[elem.slot], iorqRdLayer, port);
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuIorqWr(uint16_t port, uint8_t value) {
+        auto elem = (iorqDecoder == BusDecodeImage::IorqDecoderMaps)
+                ? iorqWrMap[port]
+                : iorqWrCache.decode(iorqWrDecoder, iorqWrLayer, port);
+
+        elem.callback(slots[elem.slot], iorqWrLayer, port, value);
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqM1() {
+        // TODO: unstable data bus
+        return 0xFF;
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuPutAddress(uint16_t /* address */, uint_fast32_t /* cycles */) {
+        // TODO: slow memory
+    }
 
 private:
 
     BusOwner* owner;
     ChronometerNarrow* cpuChronometer;
 
-    int mreqRdLayer;
-    int mreqWrLayer;
-    int iorqRdLayer;
-    int iorqWrLayer;
+    int mreqRdLayer = 0;
+    int mreqWrLayer = 0;
+    int iorqRdLayer = 0;
+    int iorqWrLayer = 0;
+    IorqDecoder iorqDecoder = BusDecodeImage::IorqDecoderRules;
+    bool isDecodeImageShared = true;
+    ReconfigureMode reconfigureMode = ReconfigureImmediate;
+
+    std::vector<Device*> configuredDevices;
+    std::vector<void*> slotData;
+    std::shared_ptr<BusDecodeImage> decodeImage;
+
+    // Second buffer: the previous image, which is brought up to date and reused for the next pending image.
+    std::shared_ptr<BusDecodeImage> spareImage;
+
+    bool isPendingImage = false;
+    BusDecodeImage::Configuration pendingConfiguration;
+    std::vector<void*> pendingSlotData;
+    std::shared_ptr<BusDecodeImage> pendingImage;
+    std::shared_ptr<BusDecodeImageWorker::Job> pendingJob; // only in the background mode
+    const BusPortDecoder<BusIorqRdSlotElement, LAYERS_IORQ_RD>* iorqRdDecoder;
+    const BusPortDecoder<BusIorqWrSlotElement, LAYERS_IORQ_WR>* iorqWrDecoder;
+    BusPortCache<BusIorqRdSlotElement, LAYERS_IORQ_RD> iorqRdCache;
+    BusPortCache<BusIorqWrSlotElement, LAYERS_IORQ_WR> iorqWrCache;
+    std::vector<std::pair<BusMreqRdElement::Callback, BusMreqRdResolver>> mreqRdResolvers;
+    std::vector<std::pair<BusMreqWrElement::Callback, BusMreqWrResolver>> mreqWrResolvers;
+    Z80ChipMemoryPages memoryPages;
+
+    template<typename ElementT, typename SlotElementT>
+    ZEMUX_FORCE_INLINE ElementT toElement(SlotElementT element) {
+        return ElementT { .callback = element.callback, .data = slots[element.slot] };
+    }
 
-    static uint8_t onFallbackMreqRd(void* /* data */, int /* mreqRdLayer */, uint16_t /* address */, bool /* isM1 */);
-    static void onFallbackMreqWr(void* /* data */, int /* mreqWrLayer */, uint16_t /* address */, uint8_t /* value */);
-    static uint8_t onFallbackIorqRd(void* data, int /* iorqRdLayer */, uint16_t /* port */);
-    static void onFallbackIorqWr(void* /* data */, int /* iorqWrLayer */, uint16_t /* port */, uint8_t /* value */);
+    template<typename ElementT>
+    BusRule<BusSlotElement<typename ElementT::Callback>> toSlotRule(
+            const BusRule<ElementT>& rule,
+            std::vector<void*>& slotTable);
+
+    void collectRules(Device* device, BusDecodeImage::DeviceRules& rules, std::vector<void*>& slotTable);
+    void configureDecodeImage(BusDecodeImage::Configuration configuration);
+    void scheduleDecodeImage(BusDecodeImage::Configuration configuration, std::vector<void*> slotTable);
+    void onInstructionBoundary();
+    void usePendingImage();
+    void useDecodeImage(std::shared_ptr<BusDecodeImage> image);
+    void updateMaps();
+
+    // Updates only pages, which are resolved differently in the current and the given layers.
+    void updateMemoryPagesAfterToggle(int prevMreqRdLayer, int prevMreqWrLayer);
+
+    static int acquireSlot(std::vector<void*>& slotTable, void* data);
+
+    static std::shared_ptr<BusDecodeImage> buildDecodeImage(
+            BusDecodeImage::Configuration configuration,
+            std::shared_ptr<BusDecodeImage> spareImage,
+            bool isShared);
 };
 
-ZEMUX_FORCE_INLINE int busLayerWithoutOverlay(int layer, int lmask, int umask) {
-    return ((layer & umask) >> 1) | (layer & lmask);
-}
+extern template class BasicZ80Chip<Bus>;
 
 }
 
@@ -52,7 +52,9 @@ public:
 
     void onAttach() override;
     void onDetach() override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
+    void onSaveState(DeviceState& state) override;
+    void onLoadState(const DeviceState& state) override;
 
     ZEMUX_FORCE_INLINE uint8_t getPortFB() {
         return portFB;
@@ -42,7 +42,7 @@ public:
 
     void onAttach() override;
     void onDetach() override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
     void onReset() override;
 
 private:
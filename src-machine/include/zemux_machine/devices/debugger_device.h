@@ -0,0 +1,112 @@
+#ifndef ZEMUX_MACHINE__DEBUGGER_DEVICE
+#define ZEMUX_MACHINE__DEBUGGER_DEVICE
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <zemux_core/non_copyable.h>
+#include "bus.h"
+#include "device.h"
+#include "event.h"
+
+namespace zemux {
+
+// Watchpoints live in the debugger overlay layers only, so code without watchpoints pays nothing
+// (and pages without watchpoints are still accessed directly). Enabling or disabling debugger just toggles overlays.
+// Every hit is reported to the host with Host::EventDebuggerHit.
+class DebuggerDevice final : public Device, private NonCopyable {
+public:
+
+    enum EventType {
+        EventSetEnabled = Event::CategoryDebugger | 1,
+        EventIsEnabled = Event::CategoryDebugger | 2,
+        EventAddWatchpoint = Event::CategoryDebugger | 3, // input.value = watchpointEventValue(kind, address)
+        EventRemoveWatchpoint = Event::CategoryDebugger | 4, // input.value = watchpointEventValue(kind, address)
+        EventRemoveAllWatchpoints = Event::CategoryDebugger | 5,
+    };
+
+    enum WatchKind {
+        WatchExec = 0,
+        WatchMreqRd = 1,
+        WatchMreqWr = 2,
+        WatchIorqRd = 3,
+        WatchIorqWr = 4,
+    };
+
+    static constexpr int SHIFT_EVENT_KIND = 16;
+    static constexpr int MASK_EVENT_ADDRESS = 0xFFFF;
+
+    static constexpr int32_t watchpointEventValue(WatchKind kind, uint16_t address) {
+        return (static_cast<int32_t>(kind) << SHIFT_EVENT_KIND) | address;
+    }
+
+    explicit DebuggerDevice(Bus* bus);
+    virtual ~DebuggerDevice() = default;
+
+    uint32_t getEventCategory() override;
+    EventOutput onEvent(uint32_t type, EventInput input) override;
+
+    void onDetach() override;
+
+    void onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) override;
+    void onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) override;
+    void onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
+    void onReset() override;
+
+    void setEnabled(bool isEnabled);
+    void addWatchpoint(WatchKind kind, uint16_t address);
+    void removeWatchpoint(WatchKind kind, uint16_t address);
+    void removeAllWatchpoints();
+
+    ZEMUX_FORCE_INLINE bool isEnabled() {
+        return isEnabled_;
+    }
+
+    ZEMUX_FORCE_INLINE bool hasWatchpoint(WatchKind kind, uint16_t address) {
+        return watchFlags[address] & (1 << kind);
+    }
+
+private:
+
+    bool isEnabled_ = false;
+    std::unique_ptr<uint8_t[]> watchFlags; // bit per WatchKind, indexed by address or port
+    std::vector<int32_t> watchpoints; // watchpointEventValue(kind, address), in order of addition
+
+    void patch();
+    void onHit(WatchKind kind, uint16_t address, uint8_t value);
+
+    static uint8_t onMreqRd(void* data, int mreqRdLayer, uint16_t address, bool isM1);
+    static void onMreqWr(void* data, int mreqWrLayer, uint16_t address, uint8_t value);
+    static uint8_t onIorqRd(void* data, int iorqRdLayer, uint16_t port);
+    static void onIorqWr(void* data, int iorqWrLayer, uint16_t port, uint8_t value);
+};
+
+}
+
+#endif
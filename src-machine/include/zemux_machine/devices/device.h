@@ -25,12 +25,50 @@
  * THE SOFTWARE.
  */
 
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
 #include <zemux_core/force_inline.h>
 #include "bus.h"
 #include "event.h"
 
 namespace zemux {
 
+// Emulated state of the device (not its configuration), saved to machine snapshots as a single trivially copyable
+// value. Storage is fixed, since snapshots may be taken every frame.
+class DeviceState final {
+public:
+
+    static constexpr std::size_t CAPACITY = 64;
+
+    template<typename T>
+    ZEMUX_FORCE_INLINE void store(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= CAPACITY, "Device state is too complex");
+
+        std::memcpy(data.data(), &value, sizeof(T));
+        size = sizeof(T);
+    }
+
+    // Returns false (and leaves the value as is) when nothing of this type was stored.
+    template<typename T>
+    ZEMUX_FORCE_INLINE bool load(T& value) const {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= CAPACITY, "Device state is too complex");
+
+        if (size != sizeof(T)) {
+            return false;
+        }
+
+        std::memcpy(&value, data.data(), sizeof(T));
+        return true;
+    }
+
+private:
+
+    std::array<uint8_t, CAPACITY> data {};
+    std::size_t size = 0;
+};
+
 class Device : public EventListener {
 public:
 
@@ -44,8 +82,12 @@ public:
         KindZxm = 7,
         KindTrDos = 8,
         KindExtPort = 9,
+        KindDebugger = 10, // must be next to the last one (see Bus::OVERLAY_MREQ_RD_DEBUGGER)
+        KindProfiler = 11, // must be the last one (see Bus::OVERLAY_MREQ_RD_PROFILER)
     };
 
+    static constexpr int KINDS_COUNT = KindProfiler + 1;
+
     virtual ~Device() = default;
 
     virtual void onAttach() {
@@ -56,37 +98,19 @@ public:
         isAttached_ = false;
     }
 
-    virtual BusMreqRdElement onConfigureMreqRd(
-            BusMreqRdElement prev,
-            [[maybe_unused]] int mreqRdLayer,
-            [[maybe_unused]] uint16_t address,
-            [[maybe_unused]] bool isM1) {
+    // Rules must depend only on the device state. When the state is changed,
+    // device should call Bus::reconfigureDevice() to apply new rules.
 
-        return prev;
+    virtual void onConfigureMreqRd([[maybe_unused]] std::vector<BusMreqRdRule>& rules) {
     }
 
-    virtual BusMreqWrElement onConfigureMreqWr(
-            BusMreqWrElement prev,
-            [[maybe_unused]] int mreqWrLayer,
-            [[maybe_unused]] uint16_t address) {
-
-        return prev;
+    virtual void onConfigureMreqWr([[maybe_unused]] std::vector<BusMreqWrRule>& rules) {
     }
 
-    virtual BusIorqRdElement onConfigureIorqRd(
-            BusIorqRdElement prev,
-            [[maybe_unused]] int iorqRdLayer,
-            [[maybe_unused]] uint16_t port) {
-
-        return prev;
+    virtual void onConfigureIorqRd([[maybe_unused]] std::vector<BusIorqRdRule>& rules) {
     }
 
-    virtual BusIorqWrElement onConfigureIorqWr(
-            BusIorqWrElement prev,
-            [[maybe_unused]] int iorqWrLayer,
-            [[maybe_unused]] uint16_t port) {
-
-        return prev;
+    virtual void onConfigureIorqWr([[maybe_unused]] std::vector<BusIorqWrRule>& rules) {
     }
 
     virtual void onConfigureTimings(uint32_t ticksPerFrame);
@@ -95,6 +119,13 @@ public:
     virtual void onReset() {
     }
 
+    // Host-controlled state (e.g. debugger watchpoints) is not saved, devices without emulated state do nothing.
+    virtual void onSaveState([[maybe_unused]] DeviceState& state) {
+    }
+
+    virtual void onLoadState([[maybe_unused]] const DeviceState& state) {
+    }
+
     ZEMUX_FORCE_INLINE bool isAttached() {
         return isAttached_;
     }
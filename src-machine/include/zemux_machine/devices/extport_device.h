@@ -80,8 +80,10 @@ public:
 
     void onAttach() override;
     void onDetach() override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
     void onReset() override;
+    void onSaveState(DeviceState& state) override;
+    void onLoadState(const DeviceState& state) override;
 
     ZEMUX_FORCE_INLINE bool is16Colors() {
         return portEFF7 & (isOldMode ? BIT_OLD_16_COLORS : BIT_16_COLORS);
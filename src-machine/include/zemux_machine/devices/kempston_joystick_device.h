@@ -60,7 +60,7 @@ public:
     uint32_t getEventCategory() override;
     EventOutput onEvent(uint32_t type, EventInput input) override;
 
-    BusIorqRdElement onConfigureIorqRd(BusIorqRdElement prev, int /* iorqRdLayer */, uint16_t port) override;
+    void onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) override;
 
 private:
 
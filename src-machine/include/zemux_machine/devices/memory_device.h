@@ -25,6 +25,7 @@
  * THE SOFTWARE.
  */
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <zemux_core/non_copyable.h>
@@ -54,8 +55,11 @@ public:
     };
 
     static constexpr int SIZE_BANK = 0x4000;
+    static constexpr int MASK_BANK_ADDRESS = 0xC000;
     static constexpr int BANKS_ROM = 2;
     static constexpr int BANKS_RAM = 64;
+    static constexpr int SIZE_RAM = SIZE_BANK * BANKS_RAM;
+    static constexpr int WINDOWS = 0x10000 / SIZE_BANK;
     static constexpr uint16_t PORT_7FFD = 0x7FFD;
 
     static constexpr uint8_t MASK_WRITE_128 = 0b0011'1111;
@@ -68,7 +72,22 @@ public:
     static constexpr uint8_t BIT_ROM_BANK_1 = 0b0001'0000;
     static constexpr uint8_t BIT_LOCK = 0b0010'0000;
 
+    // Dirty pages are tracked with the same granularity as direct CPU pages.
+    static constexpr int PAGE_BITS = Z80ChipMemoryPages::PAGE_BITS;
+    static constexpr int PAGE_SIZE = Z80ChipMemoryPages::PAGE_SIZE;
+    static constexpr int PAGES_RAM = SIZE_RAM / PAGE_SIZE;
+    static constexpr int PAGES_PER_BANK = SIZE_BANK / PAGE_SIZE;
+    static constexpr int PAGE_MASK = Z80ChipMemoryPages::PAGE_MASK;
+    static constexpr int DIRTY_WORD_BITS = 64;
+    static constexpr int DIRTY_WORDS = PAGES_RAM / DIRTY_WORD_BITS;
+
     explicit MemoryDevice(Bus* bus);
+
+    // ROM and RAM banks of the given device are shared with the new one, both devices copy the bank on the first
+    // write to it, so nothing is allocated. Shared banks are never written, so devices may be used from different
+    // threads after that.
+    MemoryDevice(Bus* bus, MemoryDevice* sharedDevice);
+
     virtual ~MemoryDevice() = default;
 
     uint32_t getEventCategory() override;
@@ -77,15 +96,12 @@ public:
     void onAttach() override;
     void onDetach() override;
 
-    BusMreqRdElement onConfigureMreqRd(
-            BusMreqRdElement /* prev */,
-            int /* mreqRdLayer */,
-            uint16_t address,
-            bool /* isM1 */) override;
-
-    BusMreqWrElement onConfigureMreqWr(BusMreqWrElement /* prev */, int /* mreqWrLayer */, uint16_t address) override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) override;
+    void onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) override;
+    void onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
     void onReset() override;
+    void onSaveState(DeviceState& state) override;
+    void onLoadState(const DeviceState& state) override;
 
     void remap();
     void enableBasic48Rom();
@@ -94,19 +110,126 @@ public:
         return (mode == Mode48) || (port7FFD & BIT_ROM_BANK_1);
     }
 
+    // RAM is kept in banks, which may be shared with forked devices until the first write (copy-on-write),
+    // so it is accessed by pages (page index is the offset in RAM divided by PAGE_SIZE). Pointer is valid
+    // until the next write to the bank.
+    ZEMUX_FORCE_INLINE const uint8_t* getRamPage(int page) {
+        return ramBankPtrs[page / PAGES_PER_BANK] + (page % PAGES_PER_BANK) * PAGE_SIZE;
+    }
+
+    // Bank of the page is unshared first. Dirty pages are not marked.
+    uint8_t* getRamPageForWrite(int page);
+
+    // Whole RAM as if it was contiguous, SIZE_RAM bytes.
+    void copyRamTo(uint8_t* dst);
+    void copyRamFrom(const uint8_t* src);
+
+    // While tracking is enabled, first write to the clean RAM page goes through the callback, which marks the page
+    // as dirty (before the value is written) and publishes it for direct writes. So tracking costs nothing
+    // for pages, that are already dirty.
+    void setDirtyTracking(bool isEnabled);
+
+    ZEMUX_FORCE_INLINE bool isDirtyTracking() {
+        return isDirtyTracking_;
+    }
+
+    // Bit per RAM page (page index is the offset in RAM divided by PAGE_SIZE), DIRTY_WORDS words.
+    ZEMUX_FORCE_INLINE const uint64_t* getDirtyPages() {
+        return dirtyPages.data();
+    }
+
+    ZEMUX_FORCE_INLINE bool isPageDirty(int page) {
+        return (dirtyPages[page / DIRTY_WORD_BITS] >> (page % DIRTY_WORD_BITS)) & 1;
+    }
+
+    // Marks all pages as clean, so writes to them are trapped again.
+    void clearDirtyPages();
+
+    // While the journal is recorded, the first write to every page saves its previous content, so revertJournal()
+    // cheaply restores RAM and dirty pages as they were in beginJournal() (e.g. for the run-ahead).
+    // Dirty pages should not be cleared in between. Returns number of restored pages.
+    void beginJournal();
+    int revertJournal();
+
 private:
 
     Mode mode = Mode48;
     uint8_t port7FFD = 0;
-    std::unique_ptr<uint8_t[]> rom;
-    std::unique_ptr<uint8_t[]> ram;
+    std::shared_ptr<uint8_t[]> rom;
+    std::array<std::shared_ptr<uint8_t[]>, BANKS_RAM> ramBanks;
+    std::array<uint8_t*, BANKS_RAM> ramBankPtrs {};
+    bool isRomShared = false;
+    uint64_t sharedRamBanks = 0; // bit per bank
     void (MemoryDevice::* onMreqWrRomPtr)(uint16_t address, uint8_t value);
     uint8_t* romBankPtr;
     uint8_t* ramBankPtr;
+    int ramBankSel = 0;
+    std::array<uint8_t*, WINDOWS> windowPtrs {}; // memory of the 16K windows, as it was published to the bus
+    bool isDirtyTracking_ = false;
+    std::array<uint64_t, DIRTY_WORDS> dirtyPages {};
+    bool isJournalRecording = false;
+    bool isJournalDirtyTracking = false;
+    std::array<uint64_t, DIRTY_WORDS> journalDirtyPages {};
+    std::unique_ptr<uint8_t[]> journalRam; // allocated on the first use
+    std::unique_ptr<uint16_t[]> journalPages;
+    int journalPagesCount = 0;
 
     void onMreqWrRomNone(uint16_t /* address */, uint8_t /* value */);
     void onMreqWrRomRam(uint16_t address, uint8_t value);
 
+    ZEMUX_FORCE_INLINE void markPageDirty(uint16_t address, uint32_t ramOffset) {
+        if (isDirtyTracking_) {
+            auto page = ramOffset >> PAGE_BITS;
+            auto bit = static_cast<uint64_t>(1) << (page % DIRTY_WORD_BITS);
+            auto& word = dirtyPages[page / DIRTY_WORD_BITS];
+
+            if (!(word & bit)) {
+                if (isJournalRecording) {
+                    recordJournalPage(page);
+                }
+
+                word |= bit;
+                bus->updateMemoryWrPage(address);
+            }
+        }
+    }
+
+    // Should be called before the page is written.
+    void recordJournalPage(uint32_t page);
+
+    ZEMUX_FORCE_INLINE bool isRamBankShared(uint32_t bank) {
+        return (sharedRamBanks >> bank) & 1;
+    }
+
+    // Doesn't update memory pages of the bus.
+    void unshareRamBank(uint32_t bank);
+    void unshareRom();
+
+    // Writes, that are trapped by the write callbacks (shared bank, clean page while tracking).
+    ZEMUX_FORCE_INLINE void writeRam(uint16_t address, uint32_t ramOffset, uint8_t value) {
+        auto bank = ramOffset / SIZE_BANK;
+
+        if (isRamBankShared(bank)) {
+            unshareRamBank(bank);
+            remap();
+        }
+
+        markPageDirty(address, ramOffset);
+
+        auto bankOffset = ramOffset % SIZE_BANK;
+        ramBankPtrs[bank][bankOffset] = value;
+        bus->onMemoryWrite(&ramBankPtrs[bank][bankOffset & ~PAGE_MASK], static_cast<uint8_t>(bankOffset & PAGE_MASK));
+    }
+
+    // Direct write page for the given RAM offset, or nullptr when writes to the page should be trapped.
+    ZEMUX_FORCE_INLINE uint8_t* resolveRamWrPage(uint32_t ramOffset) {
+        auto bank = ramOffset / SIZE_BANK;
+
+        return (isRamBankShared(bank) || (isDirtyTracking_ && !isPageDirty(static_cast<int>(ramOffset >> PAGE_BITS))))
+                ? nullptr
+                : &ramBankPtrs[bank][ramOffset % SIZE_BANK];
+    }
+
     static uint8_t onMreqRdRom(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
     static uint8_t onMreqRdRamBank2(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
     static uint8_t onMreqRdRamBank5(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
@@ -116,6 +239,15 @@ private:
     static void onMreqWrRamBank5(void* data, int /* mreqWrLayer */, uint16_t address, uint8_t value);
     static void onMreqWrRamBankSel(void* data, int /* mreqWrLayer */, uint16_t address, uint8_t value);
     static void onIorqWr(void* data, int /* iorqWrLayer */, uint16_t port, uint8_t value);
+
+    static uint8_t* onResolveMreqRdRom(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
+    static uint8_t* onResolveMreqRdRamBank2(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
+    static uint8_t* onResolveMreqRdRamBank5(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
+    static uint8_t* onResolveMreqRdRamBankSel(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
+    static uint8_t* onResolveMreqWrRom(void* data, int /* mreqWrLayer */, uint16_t address);
+    static uint8_t* onResolveMreqWrRamBank2(void* data, int /* mreqWrLayer */, uint16_t address);
+    static uint8_t* onResolveMreqWrRamBank5(void* data, int /* mreqWrLayer */, uint16_t address);
+    static uint8_t* onResolveMreqWrRamBankSel(void* data, int /* mreqWrLayer */, uint16_t address);
 };
 
 }
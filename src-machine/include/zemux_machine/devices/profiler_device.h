@@ -0,0 +1,118 @@
+#ifndef ZEMUX_MACHINE__PROFILER_DEVICE
+#define ZEMUX_MACHINE__PROFILER_DEVICE
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <zemux_core/non_copyable.h>
+#include "bus.h"
+#include "device.h"
+#include "event.h"
+
+namespace zemux {
+
+// Counts bus accesses. Catch-all rules live in the profiler overlay layers only, so the fast path (including direct
+// memory pages) is untouched while profiler is disabled. When enabled, every access goes through the callbacks.
+class ProfilerDevice final : public Device, private NonCopyable {
+public:
+
+    enum EventType {
+        EventSetEnabled = Event::CategoryProfiler | 1,
+        EventIsEnabled = Event::CategoryProfiler | 2,
+        EventGetFrameProfile = Event::CategoryProfiler | 3, // input.pointer = const Profile**, see getFrameProfile()
+    };
+
+    // Layers below the profiler overlay.
+    static constexpr int LAYERS_MREQ_RD = Bus::OVERLAY_MREQ_RD_PROFILER;
+    static constexpr int LAYERS_MREQ_WR = Bus::OVERLAY_MREQ_WR_PROFILER;
+    static constexpr int LAYERS_IORQ_RD = Bus::OVERLAY_IORQ_RD_PROFILER;
+    static constexpr int LAYERS_IORQ_WR = Bus::OVERLAY_IORQ_WR_PROFILER;
+
+    static constexpr int PAGE_BITS = 14;
+    static constexpr int PAGES = 0x10000 >> PAGE_BITS;
+    static constexpr int PORTS = 0x10000;
+
+    struct Profile {
+        // Indexed by layer (without the profiler overlay) and 16K page.
+        std::array<std::array<uint32_t, PAGES>, LAYERS_MREQ_RD> mreqRd {};
+        std::array<std::array<uint32_t, PAGES>, LAYERS_MREQ_RD> mreqM1 {};
+        std::array<std::array<uint32_t, PAGES>, LAYERS_MREQ_WR> mreqWr {};
+
+        // Indexed by layer (without the profiler overlay).
+        std::array<uint32_t, LAYERS_IORQ_RD> iorqRd {};
+        std::array<uint32_t, LAYERS_IORQ_WR> iorqWr {};
+
+        // Indexed by port, PORTS entries while profiler is enabled, empty otherwise.
+        std::vector<uint32_t> iorqRdPorts;
+        std::vector<uint32_t> iorqWrPorts;
+
+        void clear();
+        void allocatePorts();
+        void freePorts();
+    };
+
+    explicit ProfilerDevice(Bus* bus);
+    virtual ~ProfilerDevice() = default;
+
+    uint32_t getEventCategory() override;
+    EventOutput onEvent(uint32_t type, EventInput input) override;
+
+    void onDetach() override;
+
+    void onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) override;
+    void onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) override;
+    void onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
+    void onFrameFinished(uint32_t ticks) override;
+    void onReset() override;
+
+    void setEnabled(bool isEnabled);
+
+    ZEMUX_FORCE_INLINE bool isEnabled() {
+        return isEnabled_;
+    }
+
+    // Counters of the last finished frame. Reference stays valid, but the content is replaced by every frame.
+    ZEMUX_FORCE_INLINE const Profile& getFrameProfile() {
+        return frameProfile;
+    }
+
+private:
+
+    bool isEnabled_ = false;
+    Profile profile;
+    Profile frameProfile;
+
+    static uint8_t onMreqRd(void* data, int mreqRdLayer, uint16_t address, bool isM1);
+    static void onMreqWr(void* data, int mreqWrLayer, uint16_t address, uint8_t value);
+    static uint8_t onIorqRd(void* data, int iorqRdLayer, uint16_t port);
+    static void onIorqWr(void* data, int iorqWrLayer, uint16_t port, uint8_t value);
+};
+
+}
+
+#endif
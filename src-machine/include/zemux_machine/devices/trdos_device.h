@@ -25,6 +25,7 @@
  * THE SOFTWARE.
  */
 
+#include <memory>
 #include <zemux_core/non_copyable.h>
 #include "bus.h"
 #include "device.h"
@@ -46,22 +47,23 @@ public:
     static constexpr uint16_t PORT_BDI_RQS = 0xFF;
 
     explicit TrDosDevice(Bus* bus);
+
+    // ROM of the given device is shared with the new one until either of them loads another ROM.
+    TrDosDevice(Bus* bus, TrDosDevice* sharedDevice);
     virtual ~TrDosDevice() = default;
 
     uint32_t getEventCategory() override;
     EventOutput onEvent(uint32_t type, EventInput input) override;
 
     void onAttach() override;
-    void onDetach() override;
 
-    BusMreqRdElement onConfigureMreqRd(BusMreqRdElement prev, int mreqRdLayer, uint16_t address, bool isM1) override;
-    BusIorqRdElement onConfigureIorqRd(BusIorqRdElement prev, int iorqRdLayer, uint16_t port) override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int iorqWrLayer, uint16_t port) override;
+    void onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) override;
+    void onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
 
 private:
 
-    std::array<std::unique_ptr<BusMreqRdElement[]>, Bus::LAYERS_IORQ_RD - 1> prevMreqRdMapLayers;
-    std::unique_ptr<uint8_t[]> rom;
+    std::shared_ptr<uint8_t[]> rom;
 
     void toggle(bool isEnabled);
 
@@ -78,6 +80,8 @@ private:
     static void onIorqWrSector(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value);
     static void onIorqWrData(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value);
     static void onIorqWrBdi(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value);
+
+    static uint8_t* onResolveMreqRdRomOverlay(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */);
 };
 
 }
@@ -97,11 +97,13 @@ public:
 
     void onAttach() override;
     void onDetach() override;
-    BusIorqRdElement onConfigureIorqRd(BusIorqRdElement prev, int /* iorqRdLayer */, uint16_t port) override;
-    BusIorqWrElement onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) override;
+    void onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) override;
+    void onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) override;
     void onConfigureTimings(uint32_t ticksPerFrame) override;
     void onFrameFinished(uint32_t ticks) override;
     void onReset() override;
+    void onSaveState(DeviceState& state) override;
+    void onLoadState(const DeviceState& state) override;
 
 private:
 
@@ -32,6 +32,7 @@ namespace zemux {
 namespace Event {
 
 static constexpr int SHIFT_CATEGORY = 16;
+static constexpr uint32_t MASK_CATEGORY = ~((1u << SHIFT_CATEGORY) - 1);
 
 enum Category {
     CategoryHost = 1 << SHIFT_CATEGORY,
@@ -42,6 +43,8 @@ enum Category {
     CategoryZxm = 6 << SHIFT_CATEGORY,
     CategoryKeyboard = 7 << SHIFT_CATEGORY,
     CategoryTrDos = 8 << SHIFT_CATEGORY,
+    CategoryDebugger = 9 << SHIFT_CATEGORY,
+    CategoryProfiler = 10 << SHIFT_CATEGORY,
 };
 
 }
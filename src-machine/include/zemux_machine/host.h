@@ -33,6 +33,8 @@ namespace Host {
 
 enum EventType {
     EventGetMouseState = Event::CategoryHost | 1,
+    EventDebuggerHit = Event::CategoryHost | 2,
+    EventRunAheadFrame = Event::CategoryHost | 3, // see Machine::setRunAheadFrames()
 };
 
 }
@@ -47,6 +49,13 @@ struct HostMouseState {
     int buttons;
 };
 
+// Kind is one of DebuggerDevice::WatchKind. Value is the byte read or written.
+struct HostDebuggerHit {
+    int kind;
+    uint16_t address;
+    uint8_t value;
+};
+
 }
 
 #endif
@@ -25,6 +25,7 @@
  * THE SOFTWARE.
  */
 
+#include <chrono>
 #include <memory>
 #include <map>
 #include <zemux_core/non_copyable.h>
@@ -32,26 +33,108 @@
 #include <zemux_integrated/z80_chip.h>
 #include "bus.h"
 #include "event.h"
+#include "machine_snapshot.h"
+#include "timeline.h"
+#include "timings.h"
 #include "devices/device.h"
 #include "video/video_surface.h"
 #include "sound/sound_desk.h"
 
 namespace zemux {
 
-class Machine final : public BusOwner, private NonCopyable {
+// Wall-clock time spent in the stages of Machine::renderFrame(), accumulated while attached to the machine.
+struct MachineFrameStats {
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t frames = 0;
+    Clock::duration cpuTime {};
+    Clock::duration devicesTime {};
+    Clock::duration soundDeskTime {};
+
+    // Extra cost of the run-ahead (speculative frames with saving and restoring of the state),
+    // not included in the stages above.
+    uint64_t runAheadFrames = 0;
+    Clock::duration runAheadTime {};
+};
+
+class Machine final : public BusOwner, public EventEmitter, private NonCopyable {
 public:
 
+    static constexpr uint32_t SOUND_SAMPLES_PER_SECOND = 44100;
+
+    enum TimingsKind {
+        TimingsPentagon = 0,
+        TimingsScorpion = 1,
+        TimingsSpectrum48 = 2,
+        TimingsSpectrum128 = 3,
+    };
+
     ChronometerNarrow cpuChronometer { 1, 1 };
     Bus bus;
-    Z80Chip cpu;
+    BasicZ80Chip<Bus> cpu;
 
     VideoSurface videoSurface;
     SoundDesk soundDesk;
 
-    Machine();
-    ~Machine() = default;
+    // Timings can't be changed later, since the frame loop is compiled for each of them.
+    explicit Machine(TimingsKind timingsKind = TimingsPentagon);
+    ~Machine();
+
+    // Runs CPU in bursts between deadlines of the timeline (interrupt, scheduled events, end of frame).
+    ZEMUX_FORCE_INLINE void renderFrame() {
+        (this->*renderFrameFunc)();
+
+        if (runAheadFrames) {
+            runAhead();
+        }
+    }
+
+    // Every frame is followed by the given number of speculative frames, using the same input. After the last one
+    // Host::EventRunAheadFrame is emitted, so the host can present it instead of the real one, then the state
+    // is restored. It hides the latency of software, that polls input once per interrupt. Sound is produced
+    // and scheduled events are emitted only in real frames. Zero turns the run-ahead off.
+    void setRunAheadFrames(int frames);
+
+    ZEMUX_FORCE_INLINE int getRunAheadFrames() {
+        return runAheadFrames;
+    }
+
+    // Passes the event to the device of the event category (e.g. ProfilerDevice::EventGetFrameProfile).
+    EventOutput emitEvent(uint32_t event, EventInput input) override;
+
+    // Event will be passed to emitEvent() when the frame reaches given ticks (counted from the start of the current
+    // frame, or the next one when called between frames). Pointer in the input must be valid until that moment.
+    void scheduleEvent(uint32_t ticks, uint32_t event, EventInput input);
+
+    // Should be called between frames. ROM, host-controlled state (input devices, debugger, profiler, sound output)
+    // and events scheduled for the next frames are not saved. When the snapshot is the latest one saved or loaded
+    // by this machine, only RAM pages written since then are copied, so it is cheap to save it every frame.
+    // Returns number of copied RAM pages (MemoryDevice::PAGE_SIZE bytes each).
+    int saveSnapshot(MachineSnapshot* snapshot);
+
+    // Same as above, when the snapshot is the latest one, only RAM pages written since then are copied back.
+    int loadSnapshot(const MachineSnapshot& snapshot);
 
-    void renderFrame();
+    // True when RAM differs from the snapshot only in pages, marked dirty by the memory device.
+    [[nodiscard]] bool isSnapshotLatest(const MachineSnapshot& snapshot);
+
+    // Should be called between frames. New machine continues from the same state, like after loadSnapshot(),
+    // but ROM and RAM banks are shared with this machine until written (copy-on-write), so the cost doesn't depend
+    // on RAM size. Pointers in the scheduled events are copied as is. New machine may run on another thread.
+    std::unique_ptr<Machine> fork();
+
+    // Pass nullptr to detach. Stats are not measured when detached, so frame loop has no clock calls.
+    ZEMUX_FORCE_INLINE void setFrameStats(MachineFrameStats* stats) {
+        frameStats = stats;
+    }
+
+    ZEMUX_FORCE_INLINE TimingsKind getTimingsKind() {
+        return timingsKind;
+    }
+
+    ZEMUX_FORCE_INLINE uint32_t getFrameTicks() {
+        return frameTicks;
+    }
 
     void onBusReconfigure() override;
     void onBusReset() override;
@@ -61,42 +144,53 @@ private:
     std::map<int, std::unique_ptr<Device>> deviceMap;
     std::map<int, EventListener*> eventListenerMap;
     std::vector<Device*> attachedDevices;
-
-    // Pentagon:
-    uint32_t ulaLineTotalTicks = 224;
-    uint32_t ulaHBlankTicks = 32;
-    uint32_t ulaVBlankTicks = 16 * ulaLineTotalTicks;
-    uint32_t ulaFrameTicks = ulaVBlankTicks + (64 + 192 + 48) * ulaLineTotalTicks;
-    uint32_t ulaIntBeginTicks = 0;
-    uint32_t ulaIntEndTicks = ulaIntBeginTicks + 32;
-
-    // Scorpion:
-    // uint32_t ulaLineTotalTicks = 224;
-    // uint32_t ulaHBlankTicks = 40;
-    // uint32_t ulaVBlankTicks = 16 * ulaLineTotalTicks;
-    // uint32_t ulaFrameTicks = ulaVBlankTicks + (64 + 192 + 40) * ulaLineTotalTicks;
-    // uint32_t ulaIntBeginTicks = ulaVBlankTicks;
-    // uint32_t ulaIntEndTicks = ulaIntBeginTicks + 32;
-
-    // Spectrum48:
-    // uint32_t ulaLineTotalTicks = 224;
-    // uint32_t ulaHBlankTicks = 48;
-    // uint32_t ulaVBlankTicks = 16 * ulaLineTotalTicks;
-    // uint32_t ulaFrameTicks = ulaVBlankTicks + (48 + 192 + 56) * ulaLineTotalTicks;
-    // uint32_t ulaIntBeginTicks = 0;
-    // uint32_t ulaIntEndTicks = ulaIntBeginTicks + 32;
-
-    // Spectrum128:
-    // uint32_t ulaLineTotalTicks = 224;
-    // uint32_t ulaHBlankTicks = 48;
-    // uint32_t ulaVBlankTicks = 15 * ulaLineTotalTicks;
-    // uint32_t ulaFrameTicks = ulaVBlankTicks + (48 + 192 + 56) * ulaLineTotalTicks;
-    // uint32_t ulaIntBeginTicks = 0;
-    // uint32_t ulaIntEndTicks = ulaIntBeginTicks + 32;
-
-    uint32_t ulaLineVisibleTicks = ulaLineTotalTicks - ulaHBlankTicks;
+    MachineTimeline timeline;
+    bool isIntLineActive = false;
+
+    TimingsKind timingsKind;
+    uint32_t frameTicks;
+    void (Machine::* renderFrameFunc)();
+    MachineFrameStats* frameStats = nullptr;
+    MachineFrameStats::Clock::time_point frameStageTime;
+    MemoryDevice* memoryDevice;
+    uint64_t snapshotSerial = 0; // RAM is the same as in this snapshot, except dirty pages
+    int runAheadFrames = 0;
+    MachineState runAheadState {};
+    MachineTimeline runAheadTimeline;
+
+    // Memory and TR-DOS devices share ROM and RAM with the given machine (see fork()), when it is not nullptr.
+    Machine(TimingsKind timingsKind, Machine* sharedMachine);
 
     void brazeDevice(Device::DeviceKind kind, std::unique_ptr<Device> device);
+    void runCpuUntil(uint32_t ticks);
+
+    void saveState(MachineState& state);
+    void loadState(const MachineState& state);
+
+    // Starts tracking of RAM pages, written after the snapshot was saved or loaded.
+    void trackSnapshotRam();
+
+    // RAM is restored with the memory device journal, so only pages written by speculative frames are copied.
+    void runAhead();
+
+    // Adds time passed since the previous call to the given stage (nullptr only starts the measurement).
+    ZEMUX_FORCE_INLINE void trackFrameStage(MachineFrameStats::Clock::duration MachineFrameStats::* stage) {
+        if (frameStats != nullptr) {
+            auto now = MachineFrameStats::Clock::now();
+
+            if (stage != nullptr) {
+                frameStats->*stage += now - frameStageTime;
+            }
+
+            frameStageTime = now;
+        }
+    }
+
+    template <typename TimingsT>
+    void useTimings();
+
+    template <typename TimingsT>
+    void renderFrameImpl();
 };
 
 }
@@ -0,0 +1,122 @@
+#ifndef ZEMUX_MACHINE__MACHINE_FARM
+#define ZEMUX_MACHINE__MACHINE_FARM
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <zemux_core/non_copyable.h>
+#include "machine.h"
+
+namespace zemux {
+
+// Runs independent machines on a pool of threads. Work unit is the single frame of the single machine.
+// Every worker keeps its own queue of machines (usually machine stays on the same worker, so its memory stays
+// in the cache), idle worker steals machines from the others.
+class MachineFarm final : private NonCopyable {
+public:
+
+    using Clock = std::chrono::steady_clock;
+    using MachineFactory = std::function<std::unique_ptr<Machine>(size_t index)>;
+    using FrameCallback = std::function<void(Machine& machine, size_t index)>;
+
+    struct Stats {
+        uint64_t frames = 0;
+        uint64_t steals = 0;
+        Clock::duration time {};
+
+        [[nodiscard]] double getFramesPerSecond() const;
+    };
+
+    // Zero means std::thread::hardware_concurrency(). Pinning binds every worker to its own CPU of the affinity set
+    // of the calling thread, consecutive workers are bound to the same NUMA node when possible (Linux only).
+    explicit MachineFarm(unsigned int threadsCount = 0, bool isPinned = false);
+    ~MachineFarm();
+
+    // Machine is created by the worker it is assigned to, so with pinned workers
+    // its memory is allocated on the NUMA node of that worker (first touch).
+    void createMachines(size_t count, const MachineFactory& factory);
+
+    // Renders given number of frames on every machine. Callback (if any) is called after every frame,
+    // in the worker thread. Exception thrown by the machine or the callback is rethrown here.
+    Stats runFrames(uint32_t frames, const FrameCallback& callback = nullptr);
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE unsigned int getThreadsCount() const {
+        return static_cast<unsigned int>(workers.size());
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE size_t getMachinesCount() const {
+        return machines.size();
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE Machine& getMachine(size_t index) {
+        return *machines[index];
+    }
+
+private:
+
+    struct Worker {
+        unsigned int index;
+        std::thread thread;
+        std::mutex mutex;
+        std::deque<size_t> queue;
+    };
+
+    std::vector<int> pinnedCpus; // empty when workers are not pinned
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::unique_ptr<Machine>> machines;
+    std::vector<uint32_t> machineFramesLeft;
+
+    std::mutex controlMutex;
+    std::condition_variable controlCondition;
+    std::function<void(Worker&)> job;
+    uint64_t jobGeneration = 0;
+    unsigned int jobWorkersLeft = 0;
+    bool isStopping = false;
+
+    std::atomic<uint64_t> unitsLeft { 0 };
+    std::atomic<uint64_t> steals { 0 };
+    std::atomic<bool> isFailed { false };
+    std::exception_ptr failure;
+
+    void runWorker(Worker& worker);
+    void runJob(const std::function<void(Worker&)>& workerJob);
+    void renderFrames(Worker& worker, const FrameCallback& callback);
+    bool takeMachine(Worker& worker, size_t& machineIndex);
+    void fail(std::exception_ptr exception);
+};
+
+}
+
+#endif
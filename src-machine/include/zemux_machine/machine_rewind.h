@@ -0,0 +1,121 @@
+#ifndef ZEMUX_MACHINE__MACHINE_REWIND
+#define ZEMUX_MACHINE__MACHINE_REWIND
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <zemux_core/non_copyable.h>
+#include <zemux_core/force_inline.h>
+#include "machine.h"
+#include "machine_snapshot.h"
+#include "devices/memory_device.h"
+
+namespace zemux {
+
+// History of the recent frames to rewind the machine back. Every keyframeInterval frames the whole RAM is stored,
+// between keyframes only pages written during the frame, XORed with the previous content. Pages are RLE-packed,
+// records are stored in the ring arena, allocated in the constructor. When the memory budget is exhausted,
+// the oldest keyframe is evicted together with the frames that depend on it.
+class MachineRewind final : private NonCopyable {
+public:
+
+    static constexpr int DEFAULT_KEYFRAME_INTERVAL = 50;
+
+    // Memory budget covers the arena, it must hold at least one keyframe with fully filled RAM (about 1 MB).
+    // Two working snapshots and a buffer for the single record are allocated in addition.
+    MachineRewind(Machine* machine, size_t memoryBudget, int keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+    ~MachineRewind() = default;
+
+    // Should be called between frames, usually after every one.
+    void recordFrame();
+
+    // Restores the state, recorded given number of frames before the latest one (zero means the latest one).
+    // Frames after it are dropped from the history. Returns false (and does nothing) if history is not so long.
+    bool seek(int framesBack);
+
+    void clear();
+
+    // Seek accepts values from zero to frames count minus one.
+    [[nodiscard]] ZEMUX_FORCE_INLINE int getFramesCount() const {
+        return recordsCount;
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE size_t getUsedMemory() const {
+        return usedMemory;
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE size_t getMemoryBudget() const {
+        return memoryBudget;
+    }
+
+private:
+
+    struct Record {
+        size_t offset;
+        size_t size;
+        bool isKeyframe;
+    };
+
+    Machine* machine;
+    size_t memoryBudget;
+    int keyframeInterval;
+
+    std::unique_ptr<MachineSnapshot> liveSnapshot;
+    std::unique_ptr<MachineSnapshot> scratchSnapshot;
+    std::unique_ptr<uint8_t[]> packed;
+    std::unique_ptr<uint8_t[]> arena;
+
+    std::vector<Record> records;
+    int recordsHead = 0;
+    int recordsCount = 0;
+    size_t writeOffset = 0;
+    size_t usedMemory = 0;
+    int deltasSinceKeyframe = 0;
+
+    // Pages, which may be non-zero in the live snapshot (the others are known to be zero), to pack keyframes
+    // without scanning the whole RAM.
+    std::array<uint64_t, MemoryDevice::DIRTY_WORDS> usedPages {};
+    bool isUsedPagesKnown = false;
+
+    ZEMUX_FORCE_INLINE Record& getRecord(int index) {
+        return records[(recordsHead + index) % records.size()];
+    }
+
+    size_t packKeyframe(uint8_t* dst);
+    size_t packDelta(uint8_t* dst);
+    size_t findSpace(size_t size);
+    size_t allocateRecord(size_t size);
+    void evictOldestRecords();
+};
+
+}
+
+#endif
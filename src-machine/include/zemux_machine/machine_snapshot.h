@@ -0,0 +1,89 @@
+#ifndef ZEMUX_MACHINE__MACHINE_SNAPSHOT
+#define ZEMUX_MACHINE__MACHINE_SNAPSHOT
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <zemux_core/non_copyable.h>
+#include <zemux_core/force_inline.h>
+#include <zemux_integrated/z80_chip.h>
+#include "bus.h"
+#include "devices/device.h"
+#include "devices/memory_device.h"
+
+namespace zemux {
+
+// Everything, that is saved in the snapshot, except RAM.
+struct MachineState {
+    Z80ChipState cpuState;
+    BusState busState;
+    std::array<DeviceState, Device::KINDS_COUNT> deviceStates;
+};
+
+// State of the machine, saved by Machine::saveSnapshot(). All memory is allocated in the constructor,
+// so the same snapshot may be saved again and again without allocations.
+class MachineSnapshot final : private NonCopyable {
+public:
+
+    static constexpr int RAM_SIZE = MemoryDevice::SIZE_BANK * MemoryDevice::BANKS_RAM;
+
+    MachineSnapshot() : ram { new uint8_t[RAM_SIZE] } {
+    }
+
+    ~MachineSnapshot() = default;
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE bool isEmpty() const {
+        return serial == 0;
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE const Z80ChipState& getCpuState() const {
+        return state.cpuState;
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE const uint8_t* getRam() const {
+        return ram.get();
+    }
+
+private:
+
+    // Unique across all snapshots and changed on every save, so the machine can tell whether the snapshot
+    // still holds the same RAM, that it has saved (or loaded) the last time.
+    uint64_t serial = 0;
+
+    MachineState state {};
+    std::unique_ptr<uint8_t[]> ram;
+
+    // Called after the snapshot was changed.
+    void renewSerial();
+
+    friend class Machine;
+    friend class MachineRewind;
+};
+
+}
+
+#endif
@@ -83,8 +83,8 @@ public:
 
 private:
 
-    uint32_t ticksPerSecond_;
-    uint32_t samplesPerSecond_;
+    uint32_t ticksPerSecond_ = 0;
+    uint32_t samplesPerSecond_ = 0;
     uint32_t bufferSize = 0;
     uint32_t positionMask = 0;
     std::unique_ptr<Sample[]> samples;
@@ -0,0 +1,86 @@
+#ifndef ZEMUX_MACHINE__TIMELINE
+#define ZEMUX_MACHINE__TIMELINE
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <vector>
+#include <zemux_core/non_copyable.h>
+#include <zemux_core/force_inline.h>
+#include "event.h"
+
+namespace zemux {
+
+// Min-heap of deadlines in frame ticks. Entries with the same ticks are taken in order of scheduling.
+class MachineTimeline final : private NonCopyable {
+public:
+
+    enum Kind {
+        KindIntBegin = 0,
+        KindIntEnd = 1,
+        KindFrameEnd = 2,
+        KindEvent = 3, // event is passed to the device (see Machine::emitEvent())
+    };
+
+    struct Entry {
+        uint32_t ticks;
+        uint32_t sequence;
+        Kind kind;
+        uint32_t event;
+        EventInput input;
+    };
+
+    MachineTimeline() = default;
+    ~MachineTimeline() = default;
+
+    void schedule(uint32_t ticks, Kind kind, uint32_t event = 0, EventInput input = EventInput {});
+
+    // Moves remaining entries to the next frame.
+    void rebase(uint32_t frameTicks);
+
+    void clear();
+
+    // Doesn't allocate when the capacity is enough (e.g. to save and restore entries every frame).
+    void copyFrom(const MachineTimeline& other);
+
+    ZEMUX_FORCE_INLINE bool isEmpty() const {
+        return entries.empty();
+    }
+
+    ZEMUX_FORCE_INLINE const Entry& top() const {
+        return entries.front();
+    }
+
+    Entry pop();
+
+private:
+
+    std::vector<Entry> entries;
+    uint32_t nextSequence = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef ZEMUX_MACHINE__TIMINGS
+#define ZEMUX_MACHINE__TIMINGS
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+
+namespace zemux {
+
+// ULA timings of the model, in frame ticks (frame tick is equal to CPU T-state).
+// Machine instantiates the frame loop for each of them, so these values are immediate constants there.
+template <
+        uint32_t LineTotalTicks,
+        uint32_t HBlankTicks,
+        uint32_t VBlankLines,
+        uint32_t TopBorderLines,
+        uint32_t BottomBorderLines,
+        bool IsIntAfterVBlank>
+struct BasicMachineTimings {
+    static constexpr uint32_t SCREEN_LINES = 192;
+
+    static constexpr uint32_t LINE_TOTAL_TICKS = LineTotalTicks;
+    static constexpr uint32_t HBLANK_TICKS = HBlankTicks;
+    static constexpr uint32_t LINE_VISIBLE_TICKS = LINE_TOTAL_TICKS - HBLANK_TICKS;
+    static constexpr uint32_t VBLANK_TICKS = VBlankLines * LINE_TOTAL_TICKS;
+    static constexpr uint32_t TOP_BORDER_LINES = TopBorderLines;
+    static constexpr uint32_t BOTTOM_BORDER_LINES = BottomBorderLines;
+
+    static constexpr uint32_t FRAME_TICKS = VBLANK_TICKS
+            + (TOP_BORDER_LINES + SCREEN_LINES + BOTTOM_BORDER_LINES) * LINE_TOTAL_TICKS;
+
+    static constexpr uint32_t INT_BEGIN_TICKS = IsIntAfterVBlank ? VBLANK_TICKS : 0;
+    static constexpr uint32_t INT_END_TICKS = INT_BEGIN_TICKS + 32;
+
+    static_assert(INT_END_TICKS < FRAME_TICKS, "INT must be finished before the end of the frame");
+};
+
+struct PentagonTimings final : BasicMachineTimings<224, 32, 16, 64, 48, false> {
+};
+
+struct ScorpionTimings final : BasicMachineTimings<224, 40, 16, 64, 40, true> {
+};
+
+struct Spectrum48Timings final : BasicMachineTimings<224, 48, 16, 48, 56, false> {
+};
+
+struct Spectrum128Timings final : BasicMachineTimings<224, 48, 15, 48, 56, false> {
+};
+
+}
+
+#endif
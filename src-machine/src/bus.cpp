@@ -25,29 +25,20 @@
  * THE SOFTWARE.
  */
 
+
 #include "bus.h"
 #include "devices/device.h"
-#include <zemux_integrated/z80_chip.h>
+#include <algorithm>
 
 namespace zemux {
 
 Bus::Bus(BusOwner* owner, ChronometerNarrow* cpuChronometer) : owner { owner }, cpuChronometer { cpuChronometer } {
-    for (int i = 0; i < LAYERS_MREQ_RD; ++i) {
-        mreqRdMapLayers[i].reset(new BusMreqRdElement[ELEMENTS_MREQ_RD_FULL]);
-    }
-
-    for (int i = 0; i < LAYERS_MREQ_WR; ++i) {
-        mreqWrMapLayers[i].reset(new BusMreqWrElement[ELEMENTS_MREQ_WR]);
-    }
-
-    for (int i = 0; i < LAYERS_IORQ_RD; ++i) {
-        iorqRdMapLayers[i].reset(new BusIorqRdElement[ELEMENTS_IORQ_RD]);
-    }
-
-    for (int i = 0; i < LAYERS_IORQ_WR; ++i) {
-        iorqWrMapLayers[i].reset(new BusIorqWrElement[ELEMENTS_IORQ_WR]);
-    }
+    slotData.resize(2);
+    slotData[BusDecodeImage::SLOT_NULL] = nullptr;
+    slotData[BusDecodeImage::SLOT_BUS] = this;
+    slots = slotData.data();
 
+    configureDecodeImage(BusDecodeImage::Configuration {});
     onMachineReset();
 }
 
@@ -68,23 +59,29 @@ void Bus::requestReset() {
 }
 
 void Bus::toggleMreqRdOverlay(int mreqRdOverlay, bool isEnabled) {
+    int prevMreqRdLayer = mreqRdLayer;
+
     if (isEnabled) {
         mreqRdLayer |= mreqRdOverlay;
     } else {
         mreqRdLayer &= (~mreqRdOverlay);
     }
 
-    mreqRdMap = mreqRdMapLayers[mreqRdLayer].get();
+    mreqRdMap = decodeImage->mreqRdMapLayers[mreqRdLayer].data();
+    updateMemoryPagesAfterToggle(prevMreqRdLayer, mreqWrLayer);
 }
 
 void Bus::toggleMreqWrOverlay(int mreqWrOverlay, bool isEnabled) {
+    int prevMreqWrLayer = mreqWrLayer;
+
     if (isEnabled) {
         mreqWrLayer |= mreqWrOverlay;
     } else {
         mreqWrLayer &= (~mreqWrOverlay);
     }
 
-    mreqWrMap = mreqWrMapLayers[mreqWrLayer].get();
+    mreqWrMap = decodeImage->mreqWrMapLayers[mreqWrLayer].data();
+    updateMemoryPagesAfterToggle(mreqRdLayer, prevMreqWrLayer);
 }
 
 void Bus::toggleIorqRdOverlay(int iorqRdOverlay, bool isEnabled) {
@@ -94,7 +91,7 @@ void Bus::toggleIorqRdOverlay(int iorqRdOverlay, bool isEnabled) {
         iorqRdLayer &= (~iorqRdOverlay);
     }
 
-    iorqRdMap = iorqRdMapLayers[iorqRdOverlay].get();
+    iorqRdMap = decodeImage->iorqRdMapLayers[iorqRdLayer].get();
 }
 
 void Bus::toggleIorqWrOverlay(int iorqWrOverlay, bool isEnabled) {
@@ -104,139 +101,489 @@ void Bus::toggleIorqWrOverlay(int iorqWrOverlay, bool isEnabled) {
         iorqWrLayer &= (~iorqWrOverlay);
     }
 
-    iorqWrMap = iorqWrMapLayers[iorqWrOverlay].get();
+    iorqWrMap = decodeImage->iorqWrMapLayers[iorqWrLayer].get();
 }
 
-void Bus::onMachineReconfigure(std::vector<Device*>& devices) {
-    for (int layer = 0; layer < LAYERS_MREQ_RD; ++layer) {
-        auto layerMap = mreqRdMapLayers[layer].get();
+void Bus::setIorqDecoder(IorqDecoder decoder) {
+    flushReconfigure();
 
-        for (int index = 0; index < ELEMENTS_MREQ_RD_FULL; ++index) {
-            layerMap[index] = BusMreqRdElement { .callback = &Bus::onFallbackMreqRd, .data = nullptr };
-        }
+    if (iorqDecoder == decoder) {
+        return;
     }
 
-    for (int layer = 0; layer < LAYERS_MREQ_WR; ++layer) {
-        auto layerMap = mreqWrMapLayers[layer].get();
+    auto configuration = decodeImage->getConfiguration();
+    configuration.iorqDecoder = decoder;
+    configureDecodeImage(std::move(configuration));
+}
 
-        for (int index = 0; index < ELEMENTS_MREQ_WR; ++index) {
-            layerMap[index] = BusMreqWrElement { .callback = &Bus::onFallbackMreqWr, .data = nullptr };
-        }
+Bus::IorqDecoder Bus::getIorqDecoder() {
+    return iorqDecoder;
+}
+
+void Bus::setDecodeImageShared(bool isShared) {
+    flushReconfigure();
+
+    if (isDecodeImageShared == isShared) {
+        return;
+    }
+
+    isDecodeImageShared = isShared;
+    configureDecodeImage(decodeImage->getConfiguration());
+}
+
+const BusDecodeImage* Bus::getDecodeImage() {
+    return decodeImage.get();
+}
+
+void Bus::setReconfigureMode(ReconfigureMode mode) {
+    flushReconfigure();
+    reconfigureMode = mode;
+
+    if (reconfigureMode == ReconfigureImmediate) {
+        spareImage.reset();
+    }
+}
+
+Bus::ReconfigureMode Bus::getReconfigureMode() {
+    return reconfigureMode;
+}
+
+bool Bus::isReconfigurePending() {
+    return isPendingImage;
+}
+
+void Bus::flushReconfigure() {
+    if (!isPendingImage) {
+        return;
     }
 
-    for (int layer = 0; layer < LAYERS_IORQ_RD; ++layer) {
-        auto layerMap = iorqRdMapLayers[layer].get();
+    if (pendingJob) {
+        auto job = std::move(pendingJob);
+        pendingImage = BusDecodeImageWorker::getInstance().wait(*job);
+    }
+
+    usePendingImage();
+}
+
+void Bus::onMachineDeadline() {
+    if (reconfigureMode == ReconfigureBackground) {
+        flushReconfigure();
+    }
+}
 
-        for (int index = 0; index < ELEMENTS_IORQ_RD; ++index) {
-            layerMap[index] = BusIorqRdElement { .callback = &Bus::onFallbackIorqRd, .data = this };
+void Bus::registerMreqRdResolver(BusMreqRdElement::Callback callback, BusMreqRdResolver resolver) {
+    for (auto& entry : mreqRdResolvers) {
+        if (entry.first == callback) {
+            entry.second = resolver;
+            return;
         }
     }
 
-    for (int layer = 0; layer < LAYERS_IORQ_WR; ++layer) {
-        auto layerMap = iorqWrMapLayers[layer].get();
+    mreqRdResolvers.emplace_back(callback, resolver);
+}
 
-        for (int index = 0; index < ELEMENTS_IORQ_WR; ++index) {
-            layerMap[index] = BusIorqWrElement { .callback = &Bus::onFallbackIorqWr, .data = nullptr };
+void Bus::registerMreqWrResolver(BusMreqWrElement::Callback callback, BusMreqWrResolver resolver) {
+    for (auto& entry : mreqWrResolvers) {
+        if (entry.first == callback) {
+            entry.second = resolver;
+            return;
         }
     }
 
-    for (auto& device : devices) {
-        for (int layer = 0; layer < LAYERS_MREQ_RD; ++layer) {
-            auto layerMap = mreqRdMapLayers[layer].get();
+    mreqWrResolvers.emplace_back(callback, resolver);
+}
+
+void Bus::updateMemoryPages() {
+    updateMemoryPages(0, Z80ChipMemoryPages::PAGES);
+}
+
+void Bus::updateMemoryPages(int firstPage, int count) {
+    auto& mreqRdPages = decodeImage->mreqRdPageLayers[mreqRdLayer];
+    auto& mreqWrPages = decodeImage->mreqWrPageLayers[mreqWrLayer];
+
+    for (int page = firstPage; page < firstPage + count; ++page) {
+        auto address = static_cast<uint16_t>(page << Z80ChipMemoryPages::PAGE_BITS);
+
+        auto& rdPage = mreqRdPages[page];
+        auto& m1Page = mreqRdPages[page + PAGES_MREQ_RD_BASE];
+        auto& wrPage = mreqWrPages[page];
+
+        memoryPages.mreqRd[page] = rdPage.resolver
+                ? rdPage.resolver(slots[rdPage.slot], mreqRdLayer, address, false)
+                : nullptr;
+
+        memoryPages.mreqM1[page] = (m1Page.resolver && !(isPendingImage && reconfigureMode == ReconfigureDeferred))
+                ? m1Page.resolver(slots[m1Page.slot], mreqRdLayer, address, true)
+                : nullptr;
+
+        memoryPages.mreqWr[page] = wrPage.resolver
+                ? wrPage.resolver(slots[wrPage.slot], mreqWrLayer, address)
+                : nullptr;
+    }
+
+    if (cpu != nullptr) {
+        cpu->setMemoryPages(memoryPages, firstPage, count);
+    }
+}
+
+const Z80ChipMemoryPages& Bus::getMemoryPages() {
+    return memoryPages;
+}
+
+void Bus::updateMemoryWrPage(uint16_t address) {
+    auto page = address >> Z80ChipMemoryPages::PAGE_BITS;
+    auto& wrPage = decodeImage->mreqWrPageLayers[mreqWrLayer][page];
+    address &= ~Z80ChipMemoryPages::PAGE_MASK;
+
+    memoryPages.mreqWr[page] = wrPage.resolver
+            ? wrPage.resolver(slots[wrPage.slot], mreqWrLayer, address)
+            : nullptr;
+
+    if (cpu != nullptr) {
+        cpu->setMemoryWrPage(page, memoryPages.mreqWr[page]);
+    }
+}
+
+void Bus::updateMemoryWrPages() {
+    for (int page = 0; page < Z80ChipMemoryPages::PAGES; ++page) {
+        updateMemoryWrPage(static_cast<uint16_t>(page << Z80ChipMemoryPages::PAGE_BITS));
+    }
+}
 
-            for (int index = 0; index < ELEMENTS_MREQ_RD_FULL; ++index) {
-                layerMap[index] = device->onConfigureMreqRd(
-                        layerMap[index],
-                        layer,
-                        index & Bus::ELEMENTS_MREQ_RD_BASE_MASK,
-                        index >= Bus::ELEMENTS_MREQ_RD_BASE);
+void Bus::withdrawMemoryWrPages() {
+    for (int page = 0; page < Z80ChipMemoryPages::PAGES; ++page) {
+        if (memoryPages.mreqWr[page] != nullptr) {
+            memoryPages.mreqWr[page] = nullptr;
+
+            if (cpu != nullptr) {
+                cpu->setMemoryWrPage(page, nullptr);
             }
         }
+    }
+}
 
-        for (int layer = 0; layer < LAYERS_MREQ_WR; ++layer) {
-            auto layerMap = mreqWrMapLayers[layer].get();
+void Bus::releaseMemory([[maybe_unused]] const uint8_t* memory, [[maybe_unused]] size_t size) {
+#ifdef ZEMUX_Z80_CODE_CACHE
+    if (cpu != nullptr) {
+        cpu->forgetCodeCache(memory, size);
+    }
+#endif
+}
 
-            for (int index = 0; index < ELEMENTS_MREQ_WR; ++index) {
-                layerMap[index] = device->onConfigureMreqWr(layerMap[index], layer, index);
-            }
+BusState Bus::getState() {
+    return BusState {
+            .mreqRdLayer = mreqRdLayer & STATE_OVERLAYS_MREQ_RD,
+            .mreqWrLayer = mreqWrLayer & STATE_OVERLAYS_MREQ_WR,
+            .iorqRdLayer = iorqRdLayer & STATE_OVERLAYS_IORQ_RD,
+            .iorqWrLayer = iorqWrLayer & STATE_OVERLAYS_IORQ_WR,
+            .cpuClockRatio = cpuChronometer->getClockRatio(),
+            .cpuTstatesPassed = cpuChronometer->getDstTicksPassed() };
+}
+
+void Bus::setState(const BusState& state) {
+    mreqRdLayer = (mreqRdLayer & ~STATE_OVERLAYS_MREQ_RD) | (state.mreqRdLayer & STATE_OVERLAYS_MREQ_RD);
+    mreqWrLayer = (mreqWrLayer & ~STATE_OVERLAYS_MREQ_WR) | (state.mreqWrLayer & STATE_OVERLAYS_MREQ_WR);
+    iorqRdLayer = (iorqRdLayer & ~STATE_OVERLAYS_IORQ_RD) | (state.iorqRdLayer & STATE_OVERLAYS_IORQ_RD);
+    iorqWrLayer = (iorqWrLayer & ~STATE_OVERLAYS_IORQ_WR) | (state.iorqWrLayer & STATE_OVERLAYS_IORQ_WR);
+
+    updateMaps();
+    updateMemoryPages();
+
+    cpuChronometer->setClockRatioFixedSrc(state.cpuClockRatio);
+    cpuChronometer->setDstTicksPassed(state.cpuTstatesPassed);
+}
+
+void Bus::reconfigureDevice(Device* device) {
+    auto deviceIt = std::find(configuredDevices.begin(), configuredDevices.end(), device);
+
+    if (deviceIt == configuredDevices.end()) {
+        return;
+    }
+
+    auto deviceIndex = static_cast<std::size_t>(deviceIt - configuredDevices.begin());
+    BusDecodeImage::DeviceRules rules {};
+
+    if (reconfigureMode != ReconfigureImmediate) {
+        // Changes are accumulated over the latest (possibly pending) configuration.
+        auto configuration = isPendingImage ? pendingConfiguration : decodeImage->getConfiguration();
+        auto slotTable = isPendingImage ? pendingSlotData : slotData;
+        collectRules(device, rules, slotTable);
+
+        if (BusDecodeImage::isSameDeviceRules(configuration.deviceRules[deviceIndex], rules)) {
+            return;
         }
 
-        for (int layer = 0; layer < LAYERS_IORQ_RD; ++layer) {
-            auto layerMap = iorqRdMapLayers[layer].get();
+        configuration.deviceRules[deviceIndex] = std::move(rules);
+        scheduleDecodeImage(std::move(configuration), std::move(slotTable));
+        return;
+    }
+
+    collectRules(device, rules, slotData);
+    slots = slotData.data();
 
-            for (int index = 0; index < ELEMENTS_IORQ_RD; ++index) {
-                layerMap[index] = device->onConfigureIorqRd(layerMap[index], layer, index);
-            }
+    auto& configuration = decodeImage->getConfiguration();
+
+    if (decodeImage->isSameConfiguration(configuration, deviceIndex, &rules)) {
+        return;
+    }
+
+    if (isDecodeImageShared) {
+        if (auto image = BusDecodeImageCache::find(configuration, deviceIndex, &rules)) {
+            useDecodeImage(std::move(image));
+            return;
         }
 
-        for (int layer = 0; layer < LAYERS_IORQ_WR; ++layer) {
-            auto layerMap = iorqWrMapLayers[layer].get();
+        // Image used by other buses is copied (built again) before the change.
+        if (!BusDecodeImageCache::withdraw(decodeImage)) {
+            auto changedConfiguration = configuration;
+            changedConfiguration.deviceRules[deviceIndex] = std::move(rules);
+            configureDecodeImage(std::move(changedConfiguration));
+            return;
+        }
+    }
 
-            for (int index = 0; index < ELEMENTS_IORQ_WR; ++index) {
-                layerMap[index] = device->onConfigureIorqWr(layerMap[index], layer, index);
-            }
+    bool isMemoryChanged = decodeImage->reconfigureDevice(deviceIndex, rules);
+
+    if (isDecodeImageShared) {
+        auto image = BusDecodeImageCache::publish(decodeImage);
+
+        if (image != decodeImage) {
+            useDecodeImage(std::move(image));
+            return;
         }
     }
+
+    iorqRdCache.invalidate();
+    iorqWrCache.invalidate();
+
+    if (isMemoryChanged) {
+        updateMemoryPages();
+    }
+}
+
+void Bus::onMachineReconfigure(std::vector<Device*>& devices) {
+    BusDecodeImage::Configuration configuration {};
+    configuration.mreqRdResolvers = mreqRdResolvers;
+    configuration.mreqWrResolvers = mreqWrResolvers;
+    configuration.iorqDecoder = iorqDecoder;
+
+    std::vector<void*> slotTable { slotData.begin(), slotData.begin() + 2 };
+    configuredDevices = devices;
+
+    for (auto device : configuredDevices) {
+        collectRules(device, configuration.deviceRules.emplace_back(), slotTable);
+    }
+
+    if (reconfigureMode != ReconfigureImmediate) {
+        scheduleDecodeImage(std::move(configuration), std::move(slotTable));
+        return;
+    }
+
+    slotData = std::move(slotTable);
+    slots = slotData.data();
+    configureDecodeImage(std::move(configuration));
 }
 
 void Bus::onMachineReset() {
+    flushReconfigure();
+
     mreqRdLayer = 0;
     mreqWrLayer = 0;
     iorqRdLayer = 0;
     iorqWrLayer = 0;
 
-    mreqRdMap = mreqRdMapLayers[0].get();
-    mreqWrMap = mreqWrMapLayers[0].get();
-    iorqRdMap = iorqRdMapLayers[0].get();
-    iorqWrMap = iorqWrMapLayers[0].get();
+    updateMaps();
+    updateMemoryPages();
 }
 
-uint8_t Bus::onFallbackMreqRd(void* /* data */, int /* mreqRdLayer */, uint16_t /* address */, bool /* isM1 */) {
-    return 0xFF;
+template<typename ElementT>
+BusRule<BusSlotElement<typename ElementT::Callback>> Bus::toSlotRule(
+        const BusRule<ElementT>& rule,
+        std::vector<void*>& slotTable) {
+
+    return BusRule<BusSlotElement<typename ElementT::Callback>> {
+            .mask = rule.mask,
+            .value = rule.value,
+            .element = { .callback = rule.element.callback, .slot = acquireSlot(slotTable, rule.element.data) },
+            .layerMask = rule.layerMask,
+            .layerValue = rule.layerValue,
+            .isPassThrough = rule.isPassThrough };
 }
 
-void Bus::onFallbackMreqWr(void* /* data */, int /* mreqWrLayer */, uint16_t /* address */, uint8_t /* value */) {
+void Bus::collectRules(Device* device, BusDecodeImage::DeviceRules& rules, std::vector<void*>& slotTable) {
+    std::vector<BusMreqRdRule> mreqRdRules;
+    std::vector<BusMreqWrRule> mreqWrRules;
+    std::vector<BusIorqRdRule> iorqRdRules;
+    std::vector<BusIorqWrRule> iorqWrRules;
+
+    device->onConfigureMreqRd(mreqRdRules);
+    device->onConfigureMreqWr(mreqWrRules);
+    device->onConfigureIorqRd(iorqRdRules);
+    device->onConfigureIorqWr(iorqWrRules);
+
+    auto translate = [this, &slotTable](auto& fromRules, auto& toRules) {
+        for (auto& rule : fromRules) {
+            toRules.push_back(toSlotRule(rule, slotTable));
+        }
+    };
+
+    translate(mreqRdRules, rules.mreqRd);
+    translate(mreqWrRules, rules.mreqWr);
+    translate(iorqRdRules, rules.iorqRd);
+    translate(iorqWrRules, rules.iorqWr);
 }
 
-uint8_t Bus::onFallbackIorqRd(void* /* data */, int /* iorqRdLayer */, uint16_t /* port */) {
-    // TODO: port #FF
-    return 0xFF;
+void Bus::configureDecodeImage(BusDecodeImage::Configuration configuration) {
+    useDecodeImage(buildDecodeImage(std::move(configuration), nullptr, isDecodeImageShared));
 }
 
-void Bus::onFallbackIorqWr(void* /* data */, int /* iorqWrLayer */, uint16_t /* port */, uint8_t /* value */) {
+void Bus::scheduleDecodeImage(BusDecodeImage::Configuration configuration, std::vector<void*> slotTable) {
+    pendingConfiguration = configuration;
+    pendingSlotData = std::move(slotTable);
+
+    if (reconfigureMode == ReconfigureBackground) {
+        // Previous pending image is only one change behind, so it becomes the spare one. Jobs are built in order,
+        // so the worker takes it from the previous job by itself, and the bus doesn't wait here.
+        auto prevJob = std::move(pendingJob);
+        auto spare = prevJob ? nullptr : std::move(spareImage);
+
+        pendingJob = BusDecodeImageWorker::getInstance().submit(
+                [isShared = isDecodeImageShared,
+                        configuration = std::move(configuration),
+                        prevJob = std::move(prevJob),
+                        spare = std::move(spare)]() mutable {
+
+                    if (prevJob) {
+                        spare = std::move(prevJob->image);
+                        prevJob.reset();
+                    }
+
+                    return buildDecodeImage(std::move(configuration), std::move(spare), isShared);
+                });
+
+        isPendingImage = true;
+        return;
+    }
+
+    // Previous pending image is only one change behind, so it becomes the spare one.
+    if (pendingImage) {
+        spareImage = std::move(pendingImage);
+    }
+
+    pendingImage = buildDecodeImage(std::move(configuration), std::move(spareImage), isDecodeImageShared);
+
+    if (!isPendingImage) {
+        isPendingImage = true;
+
+        // Disable direct M1 pages, so the CPU will call onCpuMreqRd() at the next instruction boundary.
+        updateMemoryPages();
+    }
 }
 
-uint8_t Bus::onCpuMreqRd(void* data, uint16_t address, bool isM1) {
-    auto self = static_cast<Bus*>(data);
-    auto elem = self->mreqRdMap[address + (isM1 ? ELEMENTS_MREQ_RD_BASE : 0)];
-    return elem.callback(elem.data, self->mreqRdLayer, address, isM1);
+void Bus::onInstructionBoundary() {
+    // Swap point must not depend on the worker, otherwise snapshots, rewind and run-ahead won't be reproducible.
+    flushReconfigure();
 }
 
-void Bus::onCpuMreqWr(void* data, uint16_t address, uint8_t value) {
-    auto self = static_cast<Bus*>(data);
-    auto elem = self->mreqWrMap[address];
-    elem.callback(elem.data, self->mreqWrLayer, address, value);
+void Bus::usePendingImage() {
+    isPendingImage = false;
+    spareImage = std::move(decodeImage);
+
+    slotData.swap(pendingSlotData);
+    slots = slotData.data();
+    pendingSlotData.clear();
+    pendingConfiguration = BusDecodeImage::Configuration {};
+
+    useDecodeImage(std::move(pendingImage));
 }
 
-uint8_t Bus::onCpuIorqRd(void* data, uint16_t port) {
-    auto self = static_cast<Bus*>(data);
-    auto elem = self->iorqRdMap[port];
-    return elem.callback(elem.data, self->iorqRdLayer, port);
+void Bus::useDecodeImage(std::shared_ptr<BusDecodeImage> image) {
+    decodeImage = std::move(image);
+    iorqDecoder = decodeImage->getConfiguration().iorqDecoder;
+    iorqRdDecoder = &decodeImage->iorqRdDecoder;
+    iorqWrDecoder = &decodeImage->iorqWrDecoder;
+    iorqRdCache.invalidate();
+    iorqWrCache.invalidate();
+
+    updateMaps();
+    updateMemoryPages();
 }
 
-void Bus::onCpuIorqWr(void* data, uint16_t port, uint8_t value) {
-    auto self = static_cast<Bus*>(data);
-    auto elem = self->iorqWrMap[port];
-    elem.callback(elem.data, self->iorqWrLayer, port, value);
+void Bus::updateMaps() {
+    mreqRdMap = decodeImage->mreqRdMapLayers[mreqRdLayer].data();
+    mreqWrMap = decodeImage->mreqWrMapLayers[mreqWrLayer].data();
+    iorqRdMap = decodeImage->iorqRdMapLayers[iorqRdLayer].get();
+    iorqWrMap = decodeImage->iorqWrMapLayers[iorqWrLayer].get();
 }
 
-uint8_t Bus::onCpuIorqM1(void* /* data */) {
-    // TODO: unstable data bus
-    return 0xFF;
+void Bus::updateMemoryPagesAfterToggle(int prevMreqRdLayer, int prevMreqWrLayer) {
+    // Resolvers don't depend on the layer, so the page is resolved the same way, when it has the same resolver.
+    auto& mreqRdPages = decodeImage->mreqRdPageLayers[mreqRdLayer];
+    auto& mreqWrPages = decodeImage->mreqWrPageLayers[mreqWrLayer];
+    auto& prevMreqRdPages = decodeImage->mreqRdPageLayers[prevMreqRdLayer];
+    auto& prevMreqWrPages = decodeImage->mreqWrPageLayers[prevMreqWrLayer];
+
+    auto isSame = [](const auto& a, const auto& b) {
+        return a.resolver == b.resolver && a.slot == b.slot;
+    };
+
+    int firstPage = Z80ChipMemoryPages::PAGES;
+    int lastPage = -1;
+
+    for (int page = 0; page < Z80ChipMemoryPages::PAGES; ++page) {
+        if (!isSame(mreqRdPages[page], prevMreqRdPages[page])
+                || !isSame(mreqRdPages[page + PAGES_MREQ_RD_BASE], prevMreqRdPages[page + PAGES_MREQ_RD_BASE])
+                || !isSame(mreqWrPages[page], prevMreqWrPages[page])) {
+
+            firstPage = std::min(firstPage, page);
+            lastPage = page;
+        }
+    }
+
+    if (lastPage >= firstPage) {
+        updateMemoryPages(firstPage, lastPage - firstPage + 1);
+    }
 }
 
-void Bus::onCpuPutAddress(void* /* data */, uint16_t /* address */, uint_fast32_t /* cycles */) {
-    // TODO: slow memory
+int Bus::acquireSlot(std::vector<void*>& slotTable, void* data) {
+    auto slotIt = std::find(slotTable.begin(), slotTable.end(), data);
+
+    if (slotIt != slotTable.end()) {
+        return static_cast<int>(slotIt - slotTable.begin());
+    }
+
+    // Slots are assigned in the order of rules, so the same devices give the same slots in every bus.
+    slotTable.push_back(data);
+    return static_cast<int>(slotTable.size() - 1);
+}
+
+// Called from the worker thread in the background mode, so it must not touch the bus.
+std::shared_ptr<BusDecodeImage> Bus::buildDecodeImage(
+        BusDecodeImage::Configuration configuration,
+        std::shared_ptr<BusDecodeImage> spareImage,
+        bool isShared) {
+
+    if (isShared) {
+        if (auto image = BusDecodeImageCache::find(configuration, 0, nullptr)) {
+            return image;
+        }
+    }
+
+    std::shared_ptr<BusDecodeImage> image;
+
+    // Spare image is usually one or two device changes behind, so it is cheaper to update it than to build
+    // the new one. It could be changed only when nobody else uses it.
+    if (spareImage
+            && (!isShared || BusDecodeImageCache::withdraw(spareImage))
+            && spareImage->reconfigure(configuration)) {
+
+        image = std::move(spareImage);
+    } else {
+        spareImage.reset();
+        image = std::make_shared<BusDecodeImage>(std::move(configuration));
+    }
+
+    return isShared ? BusDecodeImageCache::publish(image) : image;
 }
 
 }
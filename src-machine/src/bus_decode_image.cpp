@@ -0,0 +1,919 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "bus.h"
+#include <algorithm>
+
+namespace zemux {
+
+static uint8_t onFallbackMreqRd(void* /* data */, int /* mreqRdLayer */, uint16_t /* address */, bool /* isM1 */) {
+    return 0xFF;
+}
+
+static void onFallbackMreqWr(void* /* data */, int /* mreqWrLayer */, uint16_t /* address */, uint8_t /* value */) {
+}
+
+static uint8_t onFallbackIorqRd(void* /* data */, int /* iorqRdLayer */, uint16_t /* port */) {
+    // TODO: port #FF (data is the Bus)
+    return 0xFF;
+}
+
+static void onFallbackIorqWr(void* /* data */, int /* iorqWrLayer */, uint16_t /* port */, uint8_t /* value */) {
+}
+
+static constexpr BusMreqRdSlotElement FALLBACK_MREQ_RD {
+        .callback = onFallbackMreqRd,
+        .slot = BusDecodeImage::SLOT_NULL };
+
+static constexpr BusMreqWrSlotElement FALLBACK_MREQ_WR {
+        .callback = onFallbackMreqWr,
+        .slot = BusDecodeImage::SLOT_NULL };
+
+static constexpr BusIorqRdSlotElement FALLBACK_IORQ_RD {
+        .callback = onFallbackIorqRd,
+        .slot = BusDecodeImage::SLOT_BUS };
+
+static constexpr BusIorqWrSlotElement FALLBACK_IORQ_WR {
+        .callback = onFallbackIorqWr,
+        .slot = BusDecodeImage::SLOT_NULL };
+
+template<typename CallbackT>
+static bool isSameElement(const BusSlotElement<CallbackT>& a, const BusSlotElement<CallbackT>& b) {
+    return a.callback == b.callback && a.slot == b.slot;
+}
+
+template<typename ElementT>
+static bool isSameRule(const BusRule<ElementT>& a, const BusRule<ElementT>& b) {
+    return a.mask == b.mask
+            && a.value == b.value
+            && isSameElement(a.element, b.element)
+            && a.layerMask == b.layerMask
+            && a.layerValue == b.layerValue
+            && a.isPassThrough == b.isPassThrough;
+}
+
+template<typename ElementT>
+static bool isSameRules(const std::vector<BusRule<ElementT>>& a, const std::vector<BusRule<ElementT>>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), isSameRule<ElementT>);
+}
+
+bool BusDecodeImage::isSameDeviceRules(const DeviceRules& a, const DeviceRules& b) {
+    return isSameRules(a.mreqRd, b.mreqRd)
+            && isSameRules(a.mreqWr, b.mreqWr)
+            && isSameRules(a.iorqRd, b.iorqRd)
+            && isSameRules(a.iorqWr, b.iorqWr);
+}
+
+template<typename ElementT>
+static bool isRuleLayer(const BusRule<ElementT>& rule, int layer) {
+    return (layer & rule.layerMask) == rule.layerValue;
+}
+
+template<typename ElementT>
+static bool isRuleIndex(const BusRule<ElementT>& rule, int index) {
+    return (index & rule.mask) == (rule.value & rule.mask);
+}
+
+template<typename ElementT>
+static bool isRulePage(const BusRule<ElementT>& rule, int page) {
+    return (((page << Z80ChipMemoryPages::PAGE_BITS) ^ rule.value) & rule.mask & ~Z80ChipMemoryPages::PAGE_MASK) == 0;
+}
+
+// Calls fn(begin, end) for every contiguous range of indices where (index & mask) == value.
+// Lowest bits not covered by the mask form the range, the rest of uncovered bits are enumerated.
+template<typename FnT>
+static void forEachMaskedRange(int mask, int value, int indexMask, FnT fn) {
+    int freeBits = ~mask & indexMask;
+    int rangeBits = freeBits & ~(freeBits + 1);
+    int stepBits = freeBits & ~rangeBits;
+    int base = value & mask & indexMask;
+    int step = 0;
+
+    do {
+        int begin = base | step;
+        fn(begin, begin + rangeBits + 1);
+        step = (step - stepBits) & stepBits;
+    } while (step != 0);
+}
+
+// Returns added and removed rules, or all new rules when only the order is changed.
+template<typename ElementT>
+static std::vector<BusRule<ElementT>> collectChangedRules(
+        const std::vector<BusRule<ElementT>>& prevRules,
+        const std::vector<BusRule<ElementT>>& rules) {
+
+    std::vector<BusRule<ElementT>> changedRules;
+
+    auto collect = [&changedRules](auto& fromRules, auto& toRules) {
+        for (auto& rule : fromRules) {
+            if (std::none_of(toRules.begin(), toRules.end(), [&rule](auto& other) {
+                return isSameRule(rule, other);
+            })) {
+                changedRules.push_back(rule);
+            }
+        }
+    };
+
+    collect(prevRules, rules);
+    collect(rules, prevRules);
+
+    if (changedRules.empty()) {
+        changedRules = rules;
+    }
+
+    return changedRules;
+}
+
+template<typename ElementT>
+BusMapPage<ElementT> BusMapPageStore<ElementT>::acquireUniform(ElementT element) {
+    for (auto& elements : uniformPages) {
+        if (isSameElement(elements[0], element)) {
+            return BusMapPage<ElementT> { .elements = elements.get(), .mask = 0 };
+        }
+    }
+
+    auto& elements = uniformPages.emplace_back(new ElementT[1]);
+    elements[0] = element;
+    return BusMapPage<ElementT> { .elements = elements.get(), .mask = 0 };
+}
+
+template<typename ElementT>
+BusMapPage<ElementT> BusMapPageStore<ElementT>::acquire(const ElementT* elements) {
+    auto elementsEnd = elements + Z80ChipMemoryPages::PAGE_SIZE;
+
+    if (std::all_of(elements + 1, elementsEnd, [elements](auto& element) {
+        return isSameElement(element, *elements);
+    })) {
+        return acquireUniform(*elements);
+    }
+
+    auto isSame = [](const ElementT& a, const ElementT& b) {
+        return isSameElement(a, b);
+    };
+
+    for (auto& pageElements : detailedPages) {
+        if (std::equal(elements, elementsEnd, pageElements.get(), isSame)) {
+            return BusMapPage<ElementT> { .elements = pageElements.get(), .mask = Z80ChipMemoryPages::PAGE_MASK };
+        }
+    }
+
+    auto& pageElements = detailedPages.emplace_back(new ElementT[Z80ChipMemoryPages::PAGE_SIZE]);
+    std::copy(elements, elementsEnd, pageElements.get());
+    return BusMapPage<ElementT> { .elements = pageElements.get(), .mask = Z80ChipMemoryPages::PAGE_MASK };
+}
+
+template<typename ElementT>
+void BusMapPageStore<ElementT>::clear() {
+    uniformPages.clear();
+    detailedPages.clear();
+    pagesAfterCollect = 0;
+}
+
+template<typename ElementT>
+bool BusMapPageStore<ElementT>::isGarbageExpected() {
+    // Garbage is collected in bulk, when number of stored pages has grown enough.
+    return uniformPages.size() + detailedPages.size() > pagesAfterCollect * 2 + 16;
+}
+
+template<typename ElementT>
+void BusMapPageStore<ElementT>::collectGarbage(std::vector<const ElementT*>& usedElements) {
+    std::sort(usedElements.begin(), usedElements.end());
+
+    auto isUnused = [&usedElements](auto& elements) {
+        return !std::binary_search(usedElements.begin(), usedElements.end(), elements.get());
+    };
+
+    uniformPages.erase(std::remove_if(uniformPages.begin(), uniformPages.end(), isUnused), uniformPages.end());
+    detailedPages.erase(std::remove_if(detailedPages.begin(), detailedPages.end(), isUnused), detailedPages.end());
+    pagesAfterCollect = uniformPages.size() + detailedPages.size();
+}
+
+template class BusMapPageStore<BusMreqRdSlotElement>;
+template class BusMapPageStore<BusMreqWrSlotElement>;
+
+template<typename ElementT, std::size_t LAYERS>
+void BusPortDecoder<ElementT, LAYERS>::compile(
+        int layer,
+        const std::vector<BusRule<ElementT>>& rules,
+        ElementT fallback) {
+
+    entries[layer].clear();
+    ranges[layer].clear();
+
+    for (int lower = 0; lower < BUCKETS; ++lower) {
+        compileBucket(layer, lower, rules, fallback);
+    }
+
+    entriesAfterCompile[layer] = entries[layer].size();
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusPortDecoder<ElementT, LAYERS>::recompile(
+        int layer,
+        int lowerMask,
+        int lowerValue,
+        const std::vector<BusRule<ElementT>>& rules,
+        ElementT fallback) {
+
+    // Entries of the replaced buckets are not freed, so layer is compiled entirely when enough of them is left.
+    if (entries[layer].size() > entriesAfterCompile[layer] * 2 + BUCKETS) {
+        compile(layer, rules, fallback);
+        return;
+    }
+
+    for (int lower = 0; lower < BUCKETS; ++lower) {
+        if ((lower & lowerMask) == (lowerValue & lowerMask)) {
+            compileBucket(layer, lower, rules, fallback);
+        }
+    }
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusPortDecoder<ElementT, LAYERS>::compileBucket(
+        int layer,
+        int lower,
+        const std::vector<BusRule<ElementT>>& rules,
+        ElementT fallback) {
+
+    auto& layerEntries = entries[layer];
+    auto& layerRanges = ranges[layer];
+    bucketEntries.clear();
+
+    // Later rules override earlier ones, so they are checked first.
+    for (auto rule = rules.rbegin(); rule != rules.rend(); ++rule) {
+        if (((lower ^ rule->value) & rule->mask & 0xFF) != 0) {
+            continue;
+        }
+
+        int upperMask = (rule->mask >> 8) & 0xFF;
+
+        bucketEntries.push_back(Entry {
+                .mask = upperMask,
+                .value = (rule->value >> 8) & upperMask,
+                .element = rule->element });
+
+        if (upperMask == 0) {
+            break;
+        }
+    }
+
+    if (bucketEntries.empty() || bucketEntries.back().mask != 0) {
+        bucketEntries.push_back(Entry { .mask = 0, .value = 0, .element = fallback });
+    }
+
+    auto isSameEntry = [](const Entry& a, const Entry& b) {
+        return a.mask == b.mask && a.value == b.value && isSameElement(a.element, b.element);
+    };
+
+    // Most of buckets have the same rules (e.g. every even port for the keyboard), they are stored only once.
+    auto range = std::find_if(layerRanges.begin(), layerRanges.end(), [&](auto& range) {
+        return std::equal(bucketEntries.begin(),
+                bucketEntries.end(),
+                layerEntries.begin() + range.first,
+                layerEntries.begin() + range.second,
+                isSameEntry);
+    });
+
+    if (range != layerRanges.end()) {
+        buckets[layer][lower] = static_cast<uint32_t>(range->first);
+        return;
+    }
+
+    buckets[layer][lower] = static_cast<uint32_t>(layerEntries.size());
+    layerRanges.emplace_back(layerEntries.size(), layerEntries.size() + bucketEntries.size());
+    layerEntries.insert(layerEntries.end(), bucketEntries.begin(), bucketEntries.end());
+}
+
+template class BusPortDecoder<BusIorqRdSlotElement, BusDecodeImage::LAYERS_IORQ_RD>;
+template class BusPortDecoder<BusIorqWrSlotElement, BusDecodeImage::LAYERS_IORQ_WR>;
+
+std::mutex BusDecodeImageCache::mutex;
+std::vector<std::weak_ptr<BusDecodeImage>> BusDecodeImageCache::images;
+
+BusDecodeImage::BusDecodeImage(Configuration configuration) : configuration { std::move(configuration) } {
+    configurePagedMap(mreqRdMapLayers, mreqRdPassLayers, mreqRdPageStore, FALLBACK_MREQ_RD, &DeviceRules::mreqRd);
+    configurePagedMap(mreqWrMapLayers, mreqWrPassLayers, mreqWrPageStore, FALLBACK_MREQ_WR, &DeviceRules::mreqWr);
+    configureIorqMaps();
+
+    for (int layer = 0; layer < LAYERS_MREQ_RD; ++layer) {
+        for (int page = 0; page < PAGES_MREQ_RD_FULL; ++page) {
+            configureMreqRdPage(layer, page);
+        }
+    }
+
+    for (int layer = 0; layer < LAYERS_MREQ_WR; ++layer) {
+        for (int page = 0; page < PAGES_MREQ_WR; ++page) {
+            configureMreqWrPage(layer, page);
+        }
+    }
+}
+
+const BusDecodeImage::Configuration& BusDecodeImage::getConfiguration() {
+    return configuration;
+}
+
+bool BusDecodeImage::isSameConfiguration(
+        const Configuration& other,
+        std::size_t deviceIndex,
+        const DeviceRules* rules) {
+
+    if (configuration.iorqDecoder != other.iorqDecoder
+            || configuration.mreqRdResolvers != other.mreqRdResolvers
+            || configuration.mreqWrResolvers != other.mreqWrResolvers
+            || configuration.deviceRules.size() != other.deviceRules.size()) {
+
+        return false;
+    }
+
+    for (std::size_t i = 0; i < other.deviceRules.size(); ++i) {
+        auto& otherRules = (rules != nullptr && i == deviceIndex) ? *rules : other.deviceRules[i];
+
+        if (!isSameDeviceRules(configuration.deviceRules[i], otherRules)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool BusDecodeImage::reconfigureDevice(std::size_t deviceIndex, DeviceRules& rules) {
+    auto& deviceEntry = configuration.deviceRules[deviceIndex];
+    std::array<std::array<bool, PAGES_MREQ_RD_FULL>, LAYERS_MREQ_RD> changedMreqRdPages {};
+    std::array<std::array<bool, PAGES_MREQ_WR>, LAYERS_MREQ_WR> changedMreqWrPages {};
+
+    reconfigurePagedMap(mreqRdMapLayers,
+            mreqRdPassLayers,
+            mreqRdPageStore,
+            FALLBACK_MREQ_RD,
+            &DeviceRules::mreqRd,
+            deviceEntry,
+            rules.mreqRd,
+            [&changedMreqRdPages](int layer, int page) {
+                changedMreqRdPages[layer][page] = true;
+            });
+
+    reconfigurePagedMap(mreqWrMapLayers,
+            mreqWrPassLayers,
+            mreqWrPageStore,
+            FALLBACK_MREQ_WR,
+            &DeviceRules::mreqWr,
+            deviceEntry,
+            rules.mreqWr,
+            [&changedMreqWrPages](int layer, int page) {
+                changedMreqWrPages[layer][page] = true;
+            });
+
+    if (configuration.iorqDecoder == IorqDecoderMaps) {
+        reconfigureMap(iorqRdMapLayers,
+                ELEMENTS_IORQ_RD,
+                FALLBACK_IORQ_RD,
+                &DeviceRules::iorqRd,
+                deviceEntry,
+                rules.iorqRd);
+
+        reconfigureMap(iorqWrMapLayers,
+                ELEMENTS_IORQ_WR,
+                FALLBACK_IORQ_WR,
+                &DeviceRules::iorqWr,
+                deviceEntry,
+                rules.iorqWr);
+    } else {
+        reconfigurePortDecoder(iorqRdDecoder, FALLBACK_IORQ_RD, &DeviceRules::iorqRd, deviceEntry, rules.iorqRd);
+        reconfigurePortDecoder(iorqWrDecoder, FALLBACK_IORQ_WR, &DeviceRules::iorqWr, deviceEntry, rules.iorqWr);
+    }
+
+    bool isMemoryChanged = false;
+
+    for (int layer = 0; layer < LAYERS_MREQ_RD; ++layer) {
+        for (int page = 0; page < PAGES_MREQ_RD_FULL; ++page) {
+            if (changedMreqRdPages[layer][page]) {
+                configureMreqRdPage(layer, page);
+                isMemoryChanged = true;
+            }
+        }
+    }
+
+    for (int layer = 0; layer < LAYERS_MREQ_WR; ++layer) {
+        for (int page = 0; page < PAGES_MREQ_WR; ++page) {
+            if (changedMreqWrPages[layer][page]) {
+                configureMreqWrPage(layer, page);
+                isMemoryChanged = true;
+            }
+        }
+    }
+
+    return isMemoryChanged;
+}
+
+bool BusDecodeImage::reconfigure(const Configuration& other) {
+    if (configuration.iorqDecoder != other.iorqDecoder
+            || configuration.mreqRdResolvers != other.mreqRdResolvers
+            || configuration.mreqWrResolvers != other.mreqWrResolvers
+            || configuration.deviceRules.size() != other.deviceRules.size()) {
+
+        return false;
+    }
+
+    for (std::size_t i = 0; i < other.deviceRules.size(); ++i) {
+        if (!isSameDeviceRules(configuration.deviceRules[i], other.deviceRules[i])) {
+            auto rules = other.deviceRules[i];
+            reconfigureDevice(i, rules);
+        }
+    }
+
+    return true;
+}
+
+void BusDecodeImage::configureIorqMaps() {
+    if (configuration.iorqDecoder != IorqDecoderMaps) {
+        configurePortDecoder(iorqRdDecoder, FALLBACK_IORQ_RD, &DeviceRules::iorqRd);
+        configurePortDecoder(iorqWrDecoder, FALLBACK_IORQ_WR, &DeviceRules::iorqWr);
+        return;
+    }
+
+    for (auto& layerMap : iorqRdMapLayers) {
+        layerMap.reset(new BusIorqRdSlotElement[ELEMENTS_IORQ_RD]);
+    }
+
+    for (auto& layerMap : iorqWrMapLayers) {
+        layerMap.reset(new BusIorqWrSlotElement[ELEMENTS_IORQ_WR]);
+    }
+
+    configureMap(iorqRdMapLayers, ELEMENTS_IORQ_RD, FALLBACK_IORQ_RD, &DeviceRules::iorqRd);
+    configureMap(iorqWrMapLayers, ELEMENTS_IORQ_WR, FALLBACK_IORQ_WR, &DeviceRules::iorqWr);
+}
+
+void BusDecodeImage::configureMreqRdPage(int layer, int page) {
+    auto& mapPage = mreqRdMapLayers[layer][page];
+    auto& pageElement = mreqRdPageLayers[layer][page];
+    pageElement = BusMreqRdPage { .resolver = nullptr, .slot = SLOT_NULL };
+
+    // Only uniform pages may be plain memory.
+    if (mapPage.mask) {
+        return;
+    }
+
+    for (auto& entry : configuration.mreqRdResolvers) {
+        if (entry.first == mapPage.elements->callback) {
+            pageElement = BusMreqRdPage { .resolver = entry.second, .slot = mapPage.elements->slot };
+            break;
+        }
+    }
+}
+
+void BusDecodeImage::configureMreqWrPage(int layer, int page) {
+    auto& mapPage = mreqWrMapLayers[layer][page];
+    auto& pageElement = mreqWrPageLayers[layer][page];
+    pageElement = BusMreqWrPage { .resolver = nullptr, .slot = SLOT_NULL };
+
+    if (mapPage.mask) {
+        return;
+    }
+
+    for (auto& entry : configuration.mreqWrResolvers) {
+        if (entry.first == mapPage.elements->callback) {
+            pageElement = BusMreqWrPage { .resolver = entry.second, .slot = mapPage.elements->slot };
+            break;
+        }
+    }
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusDecodeImage::configureMap(
+        std::array<std::unique_ptr<ElementT[]>, LAYERS>& mapLayers,
+        int elements,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember) {
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        auto layerMap = mapLayers[layer].get();
+        std::fill(layerMap, layerMap + elements, fallback);
+
+        for (auto& entry : configuration.deviceRules) {
+            for (auto& rule : entry.*rulesMember) {
+                if (isRuleLayer(rule, layer)) {
+                    forEachMaskedRange(rule.mask, rule.value, elements - 1, [layerMap, &rule](int begin, int end) {
+                        std::fill(layerMap + begin, layerMap + end, rule.element);
+                    });
+                }
+            }
+        }
+    }
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusDecodeImage::reconfigureMap(
+        std::array<std::unique_ptr<ElementT[]>, LAYERS>& mapLayers,
+        int elements,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+        DeviceRules& deviceEntry,
+        std::vector<BusRule<ElementT>>& rules) {
+
+    auto& prevRules = deviceEntry.*rulesMember;
+
+    if (isSameRules(prevRules, rules)) {
+        return;
+    }
+
+    // Only elements covered by added or removed rules may change.
+    auto changedRules = collectChangedRules(prevRules, rules);
+    prevRules.swap(rules);
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        auto layerMap = mapLayers[layer].get();
+
+        for (auto& changedRule : changedRules) {
+            if (!isRuleLayer(changedRule, layer)) {
+                continue;
+            }
+
+            forEachMaskedRange(changedRule.mask, changedRule.value, elements - 1, [&](int begin, int end) {
+                for (int index = begin; index < end; ++index) {
+                    auto element = fallback;
+
+                    for (auto& entry : configuration.deviceRules) {
+                        for (auto& rule : entry.*rulesMember) {
+                            if (isRuleLayer(rule, layer) && isRuleIndex(rule, index)) {
+                                element = rule.element;
+                            }
+                        }
+                    }
+
+                    layerMap[index] = element;
+                }
+            });
+        }
+    }
+}
+
+template<typename ElementT>
+void BusDecodeImage::collectLayerRules(
+        std::vector<BusRule<ElementT>>& layerRules,
+        int layer,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember) {
+
+    layerRules.clear();
+
+    for (auto& entry : configuration.deviceRules) {
+        for (auto& rule : entry.*rulesMember) {
+            if (isRuleLayer(rule, layer)) {
+                layerRules.push_back(rule);
+            }
+        }
+    }
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusDecodeImage::configurePortDecoder(
+        BusPortDecoder<ElementT, LAYERS>& decoder,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember) {
+
+    std::vector<BusRule<ElementT>> layerRules;
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        collectLayerRules(layerRules, layer, rulesMember);
+        decoder.compile(layer, layerRules, fallback);
+    }
+}
+
+template<typename ElementT, std::size_t LAYERS>
+void BusDecodeImage::reconfigurePortDecoder(
+        BusPortDecoder<ElementT, LAYERS>& decoder,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+        DeviceRules& deviceEntry,
+        std::vector<BusRule<ElementT>>& rules) {
+
+    auto& prevRules = deviceEntry.*rulesMember;
+
+    if (isSameRules(prevRules, rules)) {
+        return;
+    }
+
+    // Only buckets of lower port bytes covered by added or removed rules may change.
+    auto changedRules = collectChangedRules(prevRules, rules);
+    prevRules.swap(rules);
+
+    std::vector<BusRule<ElementT>> layerRules;
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        if (std::none_of(changedRules.begin(), changedRules.end(), [layer](auto& rule) {
+            return isRuleLayer(rule, layer);
+        })) {
+            continue;
+        }
+
+        collectLayerRules(layerRules, layer, rulesMember);
+
+        for (auto& changedRule : changedRules) {
+            if (isRuleLayer(changedRule, layer)) {
+                decoder.recompile(layer, changedRule.mask & 0xFF, changedRule.value & 0xFF, layerRules, fallback);
+            }
+        }
+    }
+}
+
+template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+BusMapPage<ElementT> BusDecodeImage::resolvePage(
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+        BusMapPageStore<ElementT>& store,
+        int layer,
+        int page,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember) {
+
+    // Page stays uniform (only elements[0] is valid) until the first rule which covers it partially.
+    ElementT elements[Z80ChipMemoryPages::PAGE_SIZE];
+    elements[0] = fallback;
+    bool isUniform = true;
+
+    for (auto& entry : configuration.deviceRules) {
+        for (auto& rule : entry.*rulesMember) {
+            if (!isRuleLayer(rule, layer) || !isRulePage(rule, page)) {
+                continue;
+            }
+
+            if (rule.isPassThrough) {
+                passLayers[layer][page] = isUniform ? store.acquireUniform(elements[0]) : store.acquire(elements);
+            }
+
+            if ((rule.mask & Z80ChipMemoryPages::PAGE_MASK) == 0) {
+                elements[0] = rule.element;
+                isUniform = true;
+                continue;
+            }
+
+            if (isUniform) {
+                std::fill(elements + 1, elements + Z80ChipMemoryPages::PAGE_SIZE, elements[0]);
+                isUniform = false;
+            }
+
+            forEachMaskedRange(rule.mask,
+                    rule.value,
+                    Z80ChipMemoryPages::PAGE_MASK,
+                    [&elements, &rule](int begin, int end) {
+                        std::fill(elements + begin, elements + end, rule.element);
+                    });
+        }
+    }
+
+    return isUniform ? store.acquireUniform(elements[0]) : store.acquire(elements);
+}
+
+template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+void BusDecodeImage::configurePagedMap(
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+        BusMapPageStore<ElementT>& store,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember) {
+
+    store.clear();
+
+    // Pass-through pages are never empty, so devices could use them regardless of the rules.
+    auto fallbackPage = store.acquireUniform(fallback);
+
+    for (auto& passPages : passLayers) {
+        passPages.fill(fallbackPage);
+    }
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        for (int page = 0; page < static_cast<int>(PAGES); ++page) {
+            mapLayers[layer][page] = resolvePage(passLayers, store, layer, page, fallback, rulesMember);
+        }
+    }
+}
+
+template<typename ElementT, std::size_t PAGES, std::size_t LAYERS, typename OnChangedT>
+void BusDecodeImage::reconfigurePagedMap(
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+        BusMapPageStore<ElementT>& store,
+        ElementT fallback,
+        std::vector<BusRule<ElementT>> DeviceRules::* rulesMember,
+        DeviceRules& deviceEntry,
+        std::vector<BusRule<ElementT>>& rules,
+        OnChangedT onChanged) {
+
+    auto& prevRules = deviceEntry.*rulesMember;
+
+    if (isSameRules(prevRules, rules)) {
+        return;
+    }
+
+    // Only pages covered by added or removed rules may change.
+    auto changedRules = collectChangedRules(prevRules, rules);
+    prevRules.swap(rules);
+
+    for (int layer = 0; layer < static_cast<int>(LAYERS); ++layer) {
+        for (auto& changedRule : changedRules) {
+            if (!isRuleLayer(changedRule, layer)) {
+                continue;
+            }
+
+            forEachMaskedRange(changedRule.mask >> Z80ChipMemoryPages::PAGE_BITS,
+                    changedRule.value >> Z80ChipMemoryPages::PAGE_BITS,
+                    static_cast<int>(PAGES) - 1,
+                    [&](int begin, int end) {
+                        for (int page = begin; page < end; ++page) {
+                            mapLayers[layer][page] = resolvePage(passLayers,
+                                    store,
+                                    layer,
+                                    page,
+                                    fallback,
+                                    rulesMember);
+
+                            onChanged(layer, page);
+                        }
+                    });
+        }
+    }
+
+    if (store.isGarbageExpected()) {
+        collectPageGarbage(mapLayers, passLayers, store);
+    }
+}
+
+template<typename ElementT, std::size_t PAGES, std::size_t LAYERS>
+void BusDecodeImage::collectPageGarbage(
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& mapLayers,
+        std::array<std::array<BusMapPage<ElementT>, PAGES>, LAYERS>& passLayers,
+        BusMapPageStore<ElementT>& store) {
+
+    std::vector<const ElementT*> usedElements;
+
+    for (auto layers : { &mapLayers, &passLayers }) {
+        for (auto& mapPages : *layers) {
+            for (auto& mapPage : mapPages) {
+                usedElements.push_back(mapPage.elements);
+            }
+        }
+    }
+
+    store.collectGarbage(usedElements);
+}
+
+std::shared_ptr<BusDecodeImage> BusDecodeImageCache::find(
+        const BusDecodeImage::Configuration& configuration,
+        std::size_t deviceIndex,
+        const BusDecodeImage::DeviceRules* rules) {
+
+    std::lock_guard lock { mutex };
+
+    for (auto& entry : images) {
+        auto image = entry.lock();
+
+        if (image && image->isSameConfiguration(configuration, deviceIndex, rules)) {
+            return image;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<BusDecodeImage> BusDecodeImageCache::publish(const std::shared_ptr<BusDecodeImage>& image) {
+    std::lock_guard lock { mutex };
+
+    images.erase(std::remove_if(images.begin(), images.end(), [](auto& entry) {
+        return entry.expired();
+    }), images.end());
+
+    // The same image could be published by another bus in the meantime.
+    for (auto& entry : images) {
+        auto other = entry.lock();
+
+        if (other && other->isSameConfiguration(image->getConfiguration(), 0, nullptr)) {
+            return other;
+        }
+    }
+
+    images.emplace_back(image);
+    return image;
+}
+
+bool BusDecodeImageCache::withdraw(const std::shared_ptr<BusDecodeImage>& image) {
+    std::lock_guard lock { mutex };
+
+    // Other users could acquire the published image only under the lock.
+    if (image.use_count() != 1) {
+        return false;
+    }
+
+    images.erase(std::remove_if(images.begin(), images.end(), [&image](auto& entry) {
+        return entry.expired() || entry.lock() == image;
+    }), images.end());
+
+    return true;
+}
+
+BusDecodeImageWorker& BusDecodeImageWorker::getInstance() {
+    static BusDecodeImageWorker instance;
+    return instance;
+}
+
+BusDecodeImageWorker::BusDecodeImageWorker() {
+    thread = std::thread(&BusDecodeImageWorker::run, this);
+}
+
+BusDecodeImageWorker::~BusDecodeImageWorker() {
+    {
+        std::lock_guard lock { mutex };
+        isStopping = true;
+    }
+
+    condition.notify_all();
+    thread.join();
+}
+
+std::shared_ptr<BusDecodeImageWorker::Job> BusDecodeImageWorker::submit(BuildFunc build) {
+    auto job = std::make_shared<Job>();
+    job->build = std::move(build);
+
+    {
+        std::lock_guard lock { mutex };
+        queue.push_back(job);
+    }
+
+    condition.notify_all();
+    return job;
+}
+
+std::shared_ptr<BusDecodeImage> BusDecodeImageWorker::wait(Job& job) {
+    std::unique_lock lock { mutex };
+    condition.wait(lock, [&job] { return job.isDone; });
+
+    if (job.failure) {
+        std::rethrow_exception(job.failure);
+    }
+
+    return std::move(job.image);
+}
+
+void BusDecodeImageWorker::run() {
+    for (;;) {
+        std::shared_ptr<Job> job;
+
+        {
+            std::unique_lock lock { mutex };
+            condition.wait(lock, [this] { return isStopping || !queue.empty(); });
+
+            // Nobody waits for the rest of the jobs at exit.
+            if (isStopping) {
+                return;
+            }
+
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        std::shared_ptr<BusDecodeImage> image;
+        std::exception_ptr failure;
+
+        try {
+            image = job->build();
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        // Captured images are released here, not by the bus.
+        job->build = nullptr;
+
+        {
+            std::lock_guard lock { mutex };
+            job->image = std::move(image);
+            job->failure = std::move(failure);
+            job->isDone = true;
+        }
+
+        condition.notify_all();
+    }
+}
+
+}
@@ -42,8 +42,16 @@ void BorderDevice::onDetach() {
     Device::onDetach();
 }
 
-BusIorqWrElement BorderDevice::onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) {
-    return (port & 1) ? prev : BusIorqWrElement { .callback = onIorqWr, .data = this };
+void BorderDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    rules.push_back(BusIorqWrRule { .mask = 0x0001, .value = 0x0000, .element = { .callback = onIorqWr, .data = this } });
+}
+
+void BorderDevice::onSaveState(DeviceState& state) {
+    state.store(portFB);
+}
+
+void BorderDevice::onLoadState(const DeviceState& state) {
+    state.load(portFB);
 }
 
 void BorderDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value) {
@@ -60,7 +68,9 @@ void BorderDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t /* port
         volume += VOLUME_SPEAKER;
     }
 
-    self->soundResampler.sinkForwardTo(volume, volume, ticks);
+    if (!self->bus->isSpeculative) {
+        self->soundResampler.sinkForwardTo(volume, volume, ticks);
+    }
 
     if ((value & MASK_COLOR) != (self->portFB & MASK_COLOR)) {
         // videoDevice->renderStepTo(ticks);
@@ -42,8 +42,8 @@ void CovoxDevice::onDetach() {
     Device::onDetach();
 }
 
-BusIorqWrElement CovoxDevice::onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) {
-    return ((port & 0x07) == 0x03) ? BusIorqWrElement { .callback = onIorqWr, .data = this } : prev;
+void CovoxDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    rules.push_back(BusIorqWrRule { .mask = 0x0007, .value = 0x0003, .element = { .callback = onIorqWr, .data = this } });
 }
 
 void CovoxDevice::onReset() {
@@ -53,6 +53,10 @@ void CovoxDevice::onReset() {
 void CovoxDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value) {
     auto self = static_cast<CovoxDevice*>(data);
 
+    if (self->bus->isSpeculative) {
+        return;
+    }
+
     uint16_t volume = static_cast<uint16_t>(value) << 8;
     self->soundResampler.sinkForwardTo(volume, volume, self->bus->getFrameTicksPassed());
 }
@@ -0,0 +1,233 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "devices/debugger_device.h"
+#include "host.h"
+#include <algorithm>
+#include <cstring>
+
+namespace zemux {
+
+DebuggerDevice::DebuggerDevice(Bus* bus) : Device(bus) {
+    watchFlags.reset(new uint8_t[0x10000]);
+    memset(watchFlags.get(), 0, 0x10000);
+}
+
+uint32_t DebuggerDevice::getEventCategory() {
+    return Event::CategoryDebugger;
+}
+
+EventOutput DebuggerDevice::onEvent(uint32_t type, EventInput input) {
+    switch (type) {
+        case EventSetEnabled:
+            setEnabled(input.value);
+            return EventOutput { .isHandled = true };
+
+        case EventIsEnabled:
+            return EventOutput { .isHandled = true, .value = isEnabled_ };
+
+        case EventAddWatchpoint:
+            addWatchpoint(static_cast<WatchKind>(input.value >> SHIFT_EVENT_KIND),
+                    static_cast<uint16_t>(input.value & MASK_EVENT_ADDRESS));
+
+            return EventOutput { .isHandled = true };
+
+        case EventRemoveWatchpoint:
+            removeWatchpoint(static_cast<WatchKind>(input.value >> SHIFT_EVENT_KIND),
+                    static_cast<uint16_t>(input.value & MASK_EVENT_ADDRESS));
+
+            return EventOutput { .isHandled = true };
+
+        case EventRemoveAllWatchpoints:
+            removeAllWatchpoints();
+            return EventOutput { .isHandled = true };
+
+        default:
+            return EventOutput {};
+    }
+}
+
+void DebuggerDevice::onDetach() {
+    if (isEnabled_) {
+        setEnabled(false);
+    }
+
+    Device::onDetach();
+}
+
+void DebuggerDevice::onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) {
+    for (auto watchpoint : watchpoints) {
+        auto kind = watchpoint >> SHIFT_EVENT_KIND;
+        auto address = watchpoint & MASK_EVENT_ADDRESS;
+
+        if (kind == WatchExec || kind == WatchMreqRd) {
+            rules.push_back(BusMreqRdRule {
+                    .mask = Bus::ELEMENTS_MREQ_RD_BASE | Bus::MASK_ADDRESS,
+                    .value = address + (kind == WatchExec ? Bus::ELEMENTS_MREQ_RD_BASE : 0),
+                    .element = { .callback = onMreqRd, .data = this },
+                    .layerMask = Bus::OVERLAY_MREQ_RD_DEBUGGER,
+                    .layerValue = Bus::OVERLAY_MREQ_RD_DEBUGGER });
+        }
+    }
+}
+
+void DebuggerDevice::onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) {
+    for (auto watchpoint : watchpoints) {
+        if ((watchpoint >> SHIFT_EVENT_KIND) == WatchMreqWr) {
+            rules.push_back(BusMreqWrRule {
+                    .mask = Bus::MASK_ADDRESS,
+                    .value = watchpoint & MASK_EVENT_ADDRESS,
+                    .element = { .callback = onMreqWr, .data = this },
+                    .layerMask = Bus::OVERLAY_MREQ_WR_DEBUGGER,
+                    .layerValue = Bus::OVERLAY_MREQ_WR_DEBUGGER });
+        }
+    }
+}
+
+void DebuggerDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    for (auto watchpoint : watchpoints) {
+        if ((watchpoint >> SHIFT_EVENT_KIND) == WatchIorqRd) {
+            rules.push_back(BusIorqRdRule {
+                    .mask = Bus::MASK_PORT,
+                    .value = watchpoint & MASK_EVENT_ADDRESS,
+                    .element = { .callback = onIorqRd, .data = this },
+                    .layerMask = Bus::OVERLAY_IORQ_RD_DEBUGGER,
+                    .layerValue = Bus::OVERLAY_IORQ_RD_DEBUGGER });
+        }
+    }
+}
+
+void DebuggerDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    for (auto watchpoint : watchpoints) {
+        if ((watchpoint >> SHIFT_EVENT_KIND) == WatchIorqWr) {
+            rules.push_back(BusIorqWrRule {
+                    .mask = Bus::MASK_PORT,
+                    .value = watchpoint & MASK_EVENT_ADDRESS,
+                    .element = { .callback = onIorqWr, .data = this },
+                    .layerMask = Bus::OVERLAY_IORQ_WR_DEBUGGER,
+                    .layerValue = Bus::OVERLAY_IORQ_WR_DEBUGGER });
+        }
+    }
+}
+
+void DebuggerDevice::onReset() {
+    // Bus resets all overlays.
+    if (isEnabled_) {
+        setEnabled(true);
+    }
+}
+
+void DebuggerDevice::setEnabled(bool isEnabled) {
+    isEnabled_ = isEnabled;
+
+    bus->toggleMreqRdOverlay(Bus::OVERLAY_MREQ_RD_DEBUGGER, isEnabled);
+    bus->toggleMreqWrOverlay(Bus::OVERLAY_MREQ_WR_DEBUGGER, isEnabled);
+    bus->toggleIorqRdOverlay(Bus::OVERLAY_IORQ_RD_DEBUGGER, isEnabled);
+    bus->toggleIorqWrOverlay(Bus::OVERLAY_IORQ_WR_DEBUGGER, isEnabled);
+}
+
+void DebuggerDevice::addWatchpoint(WatchKind kind, uint16_t address) {
+    if (!hasWatchpoint(kind, address)) {
+        watchFlags[address] |= (1 << kind);
+        watchpoints.push_back(watchpointEventValue(kind, address));
+        patch();
+    }
+}
+
+void DebuggerDevice::removeWatchpoint(WatchKind kind, uint16_t address) {
+    if (hasWatchpoint(kind, address)) {
+        watchFlags[address] &= ~(1 << kind);
+        watchpoints.erase(std::find(watchpoints.begin(), watchpoints.end(), watchpointEventValue(kind, address)));
+        patch();
+    }
+}
+
+void DebuggerDevice::removeAllWatchpoints() {
+    for (auto watchpoint : watchpoints) {
+        watchFlags[watchpoint & MASK_EVENT_ADDRESS] = 0;
+    }
+
+    watchpoints.clear();
+    patch();
+}
+
+void DebuggerDevice::patch() {
+    // When device is not attached, watchpoints will be applied during next reconfiguration.
+    // Debugger is configured after all other devices, so only elements of watchpoints are changed.
+    if (isAttached()) {
+        bus->reconfigureDevice(this);
+    }
+}
+
+void DebuggerDevice::onHit(WatchKind kind, uint16_t address, uint8_t value) {
+    // Speculative frames are discarded (see Machine::setRunAheadFrames()).
+    if (bus->hostEmitter != nullptr && !bus->isSpeculative) {
+        HostDebuggerHit hit { .kind = kind, .address = address, .value = value };
+        bus->hostEmitter->emitEvent(Host::EventDebuggerHit, EventInput { .pointer = &hit });
+    }
+}
+
+uint8_t DebuggerDevice::onMreqRd(void* data, int mreqRdLayer, uint16_t address, bool isM1) {
+    auto self = static_cast<DebuggerDevice*>(data);
+    auto layer = mreqRdLayer & ~Bus::OVERLAY_MREQ_RD_DEBUGGER;
+    auto element = self->bus->getMreqRdElement(layer, address, isM1);
+
+    uint8_t value = element.callback(element.data, layer, address, isM1);
+    self->onHit(isM1 ? WatchExec : WatchMreqRd, address, value);
+    return value;
+}
+
+void DebuggerDevice::onMreqWr(void* data, int mreqWrLayer, uint16_t address, uint8_t value) {
+    auto self = static_cast<DebuggerDevice*>(data);
+    auto layer = mreqWrLayer & ~Bus::OVERLAY_MREQ_WR_DEBUGGER;
+    auto element = self->bus->getMreqWrElement(layer, address);
+
+    element.callback(element.data, layer, address, value);
+    self->onHit(WatchMreqWr, address, value);
+}
+
+uint8_t DebuggerDevice::onIorqRd(void* data, int iorqRdLayer, uint16_t port) {
+    auto self = static_cast<DebuggerDevice*>(data);
+    auto layer = iorqRdLayer & ~Bus::OVERLAY_IORQ_RD_DEBUGGER;
+    auto element = self->bus->getIorqRdElement(layer, port);
+
+    uint8_t value = element.callback(element.data, layer, port);
+    self->onHit(WatchIorqRd, port, value);
+    return value;
+}
+
+void DebuggerDevice::onIorqWr(void* data, int iorqWrLayer, uint16_t port, uint8_t value) {
+    auto self = static_cast<DebuggerDevice*>(data);
+    auto layer = iorqWrLayer & ~Bus::OVERLAY_IORQ_WR_DEBUGGER;
+    auto element = self->bus->getIorqWrElement(layer, port);
+
+    element.callback(element.data, layer, port, value);
+    self->onHit(WatchIorqWr, port, value);
+}
+
+}
@@ -93,8 +93,11 @@ void ExtPortDevice::onDetach() {
     Device::onDetach();
 }
 
-BusIorqWrElement ExtPortDevice::onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) {
-    return (port == PORT_EFF7) ? BusIorqWrElement { .callback = onIorqWr, .data = this } : prev;
+void ExtPortDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    rules.push_back(BusIorqWrRule {
+            .mask = Bus::MASK_PORT,
+            .value = PORT_EFF7,
+            .element = { .callback = onIorqWr, .data = this } });
 }
 
 void ExtPortDevice::onReset() {
@@ -112,6 +115,17 @@ void ExtPortDevice::onReset() {
     }
 }
 
+void ExtPortDevice::onSaveState(DeviceState& state) {
+    state.store(portEFF7);
+}
+
+void ExtPortDevice::onLoadState(const DeviceState& state) {
+    // CPU clock ratio is restored with the bus state.
+    if (state.load(portEFF7) && bus->memoryDevice != nullptr) {
+        bus->memoryDevice->remap();
+    }
+}
+
 void ExtPortDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value) {
     auto self = static_cast<ExtPortDevice*>(data);
 
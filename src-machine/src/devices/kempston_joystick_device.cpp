@@ -58,8 +58,8 @@ EventOutput KempstonJoystickDevice::onEvent(uint32_t type, EventInput input) {
     }
 }
 
-BusIorqRdElement KempstonJoystickDevice::onConfigureIorqRd(BusIorqRdElement prev, int, uint16_t port) {
-    return (port & 0x20) ? prev : BusIorqRdElement { .callback = onIorqRd, .data = this };
+void KempstonJoystickDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    rules.push_back(BusIorqRdRule { .mask = 0x0020, .value = 0x0000, .element = { .callback = onIorqRd, .data = this } });
 }
 
 uint8_t KempstonJoystickDevice::onIorqRd(void* data, int /* iorqRdLayer */, uint16_t /* port */) {
@@ -135,20 +135,21 @@ EventOutput KempstonMouseDevice::onEvent(uint32_t type, EventInput input) {
     }
 }
 
-BusIorqRdElement KempstonMouseDevice::onConfigureIorqRd(BusIorqRdElement prev, int /* iorqRdLayer */, uint16_t port) {
-    if (port == PORT_FBDF) {
-        return BusIorqRdElement { .callback = onIorqRdFBDF, .data = this };
-    }
-
-    if (port == PORT_FFDF) {
-        return BusIorqRdElement { .callback = onIorqRdFFDF, .data = this };
-    }
-
-    if (port == PORT_FADF) {
-        return BusIorqRdElement { .callback = onIorqRdFADF, .data = this };
-    }
-
-    return prev;
+void KempstonMouseDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    rules.push_back(BusIorqRdRule {
+            .mask = Bus::MASK_PORT,
+            .value = PORT_FBDF,
+            .element = { .callback = onIorqRdFBDF, .data = this } });
+
+    rules.push_back(BusIorqRdRule {
+            .mask = Bus::MASK_PORT,
+            .value = PORT_FFDF,
+            .element = { .callback = onIorqRdFFDF, .data = this } });
+
+    rules.push_back(BusIorqRdRule {
+            .mask = Bus::MASK_PORT,
+            .value = PORT_FADF,
+            .element = { .callback = onIorqRdFADF, .data = this } });
 }
 
 void KempstonMouseDevice::update() {
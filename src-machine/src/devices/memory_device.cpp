@@ -28,15 +28,43 @@
 #include "devices/memory_device.h"
 #include "devices/extport_device.h"
 #include <zemux_core/data_io.h>
+#include <cstring>
 
 namespace zemux {
 
+static_assert(MemoryDevice::BANKS_RAM <= 64, "Shared RAM banks must fit into 64 bits");
+
+struct MemoryDeviceState {
+    MemoryDevice::Mode mode;
+    uint8_t port7FFD;
+};
+
 MemoryDevice::MemoryDevice(Bus* bus) : Device { bus } {
     rom.reset(new uint8_t[SIZE_BANK * BANKS_ROM]);
-    ram.reset(new uint8_t[SIZE_BANK * BANKS_RAM]);
+
+    for (int bank = 0; bank < BANKS_RAM; ++bank) {
+        ramBanks[bank].reset(new uint8_t[SIZE_BANK]);
+        ramBankPtrs[bank] = ramBanks[bank].get();
+    }
+
     remap();
 }
 
+MemoryDevice::MemoryDevice(Bus* bus, MemoryDevice* sharedDevice) : Device { bus },
+        rom { sharedDevice->rom },
+        ramBanks { sharedDevice->ramBanks },
+        ramBankPtrs { sharedDevice->ramBankPtrs },
+        isRomShared { true },
+        sharedRamBanks { ~static_cast<uint64_t>(0) >> (64 - BANKS_RAM) } {
+
+    sharedDevice->isRomShared = true;
+    sharedDevice->sharedRamBanks = sharedRamBanks;
+
+    // Direct writes to the shared banks are withdrawn.
+    remap();
+    sharedDevice->bus->updateMemoryWrPages();
+}
+
 uint32_t MemoryDevice::getEventCategory() {
     return Event::CategoryMemory;
 }
@@ -52,14 +80,17 @@ EventOutput MemoryDevice::onEvent(uint32_t type, EventInput input) {
             return EventOutput { .isHandled = true, .value = mode };
 
         case EventLoadRomFull:
+            unshareRom();
             static_cast<DataReader*>(input.pointer)->readBlock(&rom[0], SIZE_BANK * 2);
             return EventOutput { .isHandled = true };
 
         case EventLoadRomBank0:
+            unshareRom();
             static_cast<DataReader*>(input.pointer)->readBlock(&rom[0], SIZE_BANK);
             return EventOutput { .isHandled = true };
 
         case EventLoadRomBank1:
+            unshareRom();
             static_cast<DataReader*>(input.pointer)->readBlock(&rom[SIZE_BANK], SIZE_BANK);
             return EventOutput { .isHandled = true };
 
@@ -71,6 +102,15 @@ EventOutput MemoryDevice::onEvent(uint32_t type, EventInput input) {
 void MemoryDevice::onAttach() {
     Device::onAttach();
     bus->memoryDevice = this;
+
+    bus->registerMreqRdResolver(onMreqRdRom, onResolveMreqRdRom);
+    bus->registerMreqRdResolver(onMreqRdRamBank2, onResolveMreqRdRamBank2);
+    bus->registerMreqRdResolver(onMreqRdRamBank5, onResolveMreqRdRamBank5);
+    bus->registerMreqRdResolver(onMreqRdRamBankSel, onResolveMreqRdRamBankSel);
+    bus->registerMreqWrResolver(onMreqWrRom, onResolveMreqWrRom);
+    bus->registerMreqWrResolver(onMreqWrRamBank2, onResolveMreqWrRamBank2);
+    bus->registerMreqWrResolver(onMreqWrRamBank5, onResolveMreqWrRamBank5);
+    bus->registerMreqWrResolver(onMreqWrRamBankSel, onResolveMreqWrRamBankSel);
 }
 
 void MemoryDevice::onDetach() {
@@ -78,49 +118,52 @@ void MemoryDevice::onDetach() {
     Device::onDetach();
 }
 
-BusMreqRdElement MemoryDevice::onConfigureMreqRd(
-        BusMreqRdElement /* prev */,
-        int /* mreqRdLayer */,
-        uint16_t address,
-        bool /* isM1 */) {
-
-    if (address < SIZE_BANK) {
-        return BusMreqRdElement { .callback = onMreqRdRom, .data = this };
-    }
-
-    if (address < SIZE_BANK * 2) {
-        return BusMreqRdElement { .callback = onMreqRdRamBank2, .data = this };
-    }
-
-    if (address < SIZE_BANK * 3) {
-        return BusMreqRdElement { .callback = onMreqRdRamBank5, .data = this };
-    }
-
-    return BusMreqRdElement { .callback = onMreqRdRamBankSel, .data = this };
+void MemoryDevice::onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) {
+    rules.push_back(BusMreqRdRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = 0,
+            .element = { .callback = onMreqRdRom, .data = this } });
+
+    rules.push_back(BusMreqRdRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK,
+            .element = { .callback = onMreqRdRamBank5, .data = this } });
+
+    rules.push_back(BusMreqRdRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK * 2,
+            .element = { .callback = onMreqRdRamBank2, .data = this } });
+
+    rules.push_back(BusMreqRdRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK * 3,
+            .element = { .callback = onMreqRdRamBankSel, .data = this } });
 }
 
-BusMreqWrElement MemoryDevice::onConfigureMreqWr(
-        BusMreqWrElement /* prev */,
-        int /* mreqWrLayer */,
-        uint16_t address) {
-
-    if (address < SIZE_BANK) {
-        return BusMreqWrElement { .callback = onMreqWrRom, .data = this };
-    }
-
-    if (address < SIZE_BANK * 2) {
-        return BusMreqWrElement { .callback = onMreqWrRamBank2, .data = this };
-    }
-
-    if (address < SIZE_BANK * 3) {
-        return BusMreqWrElement { .callback = onMreqWrRamBank5, .data = this };
-    }
-
-    return BusMreqWrElement { .callback = onMreqWrRamBankSel, .data = this };
+void MemoryDevice::onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) {
+    rules.push_back(BusMreqWrRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = 0,
+            .element = { .callback = onMreqWrRom, .data = this } });
+
+    rules.push_back(BusMreqWrRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK,
+            .element = { .callback = onMreqWrRamBank5, .data = this } });
+
+    rules.push_back(BusMreqWrRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK * 2,
+            .element = { .callback = onMreqWrRamBank2, .data = this } });
+
+    rules.push_back(BusMreqWrRule {
+            .mask = MASK_BANK_ADDRESS,
+            .value = SIZE_BANK * 3,
+            .element = { .callback = onMreqWrRamBankSel, .data = this } });
 }
 
-BusIorqWrElement MemoryDevice::onConfigureIorqWr(BusIorqWrElement prev, int /* iorqWrLayer */, uint16_t port) {
-    return ((port & 0x8003) == 0x0001) ? BusIorqWrElement { .callback = onIorqWr, .data = this } : prev;
+void MemoryDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    rules.push_back(BusIorqWrRule { .mask = 0x8003, .value = 0x0001, .element = { .callback = onIorqWr, .data = this } });
 }
 
 void MemoryDevice::onReset() {
@@ -128,9 +171,23 @@ void MemoryDevice::onReset() {
     remap();
 }
 
+void MemoryDevice::onSaveState(DeviceState& state) {
+    state.store(MemoryDeviceState { .mode = mode, .port7FFD = port7FFD });
+}
+
+void MemoryDevice::onLoadState(const DeviceState& state) {
+    MemoryDeviceState memoryState {};
+
+    if (state.load(memoryState)) {
+        mode = memoryState.mode;
+        port7FFD = memoryState.port7FFD;
+        remap();
+    }
+}
+
 void MemoryDevice::remap() {
     if (bus->extPortDevice != nullptr && bus->extPortDevice->isRamMapRom()) {
-        romBankPtr = &ram[0];
+        romBankPtr = ramBankPtrs[0];
         onMreqWrRomPtr = &MemoryDevice::onMreqWrRomRam;
     } else {
         romBankPtr = &rom[(mode == Mode48 || port7FFD & BIT_ROM_BANK_1) ? SIZE_BANK : 0];
@@ -139,23 +196,32 @@ void MemoryDevice::remap() {
 
     switch (mode) {
         case Mode128:
-            ramBankPtr = &ram[(port7FFD & MASK_BANK_128) * SIZE_BANK];
+            ramBankSel = port7FFD & MASK_BANK_128;
             break;
 
         case Mode512:
-            ramBankPtr = &ram[
-                    (((port7FFD & MASK_BANK_512) >> SHIFT_BANK_512) | (port7FFD & MASK_BANK_128)) * SIZE_BANK];
-
+            ramBankSel = ((port7FFD & MASK_BANK_512) >> SHIFT_BANK_512) | (port7FFD & MASK_BANK_128);
             break;
 
         case Mode1024:
-            ramBankPtr = &ram[
-                    (((port7FFD & MASK_BANK_1024) >> SHIFT_BANK_1024) | (port7FFD & MASK_BANK_128)) * SIZE_BANK];
-
+            ramBankSel = ((port7FFD & MASK_BANK_1024) >> SHIFT_BANK_1024) | (port7FFD & MASK_BANK_128);
             break;
 
         default: // Mode48
-            ramBankPtr = &ram[0];
+            ramBankSel = 0;
+    }
+
+    ramBankPtr = ramBankPtrs[ramBankSel];
+
+    // Bank is copied on the first write, so the window is published again every time when its memory
+    // or write trapping is changed (except for the start of sharing, see the sharing constructor).
+    std::array<uint8_t*, WINDOWS> ptrs { romBankPtr, ramBankPtrs[5], ramBankPtrs[2], ramBankPtr };
+
+    for (int window = 0; window < WINDOWS; ++window) {
+        if (windowPtrs[window] != ptrs[window]) {
+            windowPtrs[window] = ptrs[window];
+            bus->updateMemoryPages(window * PAGES_PER_BANK, PAGES_PER_BANK);
+        }
     }
 }
 
@@ -164,11 +230,118 @@ void MemoryDevice::enableBasic48Rom() {
     remap();
 }
 
+uint8_t* MemoryDevice::getRamPageForWrite(int page) {
+    auto bank = static_cast<uint32_t>(page / PAGES_PER_BANK);
+
+    if (isRamBankShared(bank)) {
+        unshareRamBank(bank);
+        remap();
+    }
+
+    return ramBankPtrs[bank] + (page % PAGES_PER_BANK) * PAGE_SIZE;
+}
+
+void MemoryDevice::copyRamTo(uint8_t* dst) {
+    for (int bank = 0; bank < BANKS_RAM; ++bank) {
+        std::memcpy(dst + bank * SIZE_BANK, ramBankPtrs[bank], SIZE_BANK);
+    }
+}
+
+void MemoryDevice::copyRamFrom(const uint8_t* src) {
+    // Shared banks are overwritten anyway, so they are not copied.
+    for (int bank = 0; bank < BANKS_RAM; ++bank) {
+        if (isRamBankShared(bank)) {
+            bus->releaseMemory(ramBankPtrs[bank], SIZE_BANK);
+            ramBanks[bank].reset(new uint8_t[SIZE_BANK]);
+            ramBankPtrs[bank] = ramBanks[bank].get();
+        }
+
+        std::memcpy(ramBankPtrs[bank], src + bank * SIZE_BANK, SIZE_BANK);
+    }
+
+    if (sharedRamBanks != 0) {
+        sharedRamBanks = 0;
+        remap();
+    }
+}
+
+void MemoryDevice::setDirtyTracking(bool isEnabled) {
+    isDirtyTracking_ = isEnabled;
+    dirtyPages.fill(0);
+    bus->updateMemoryWrPages();
+}
+
+void MemoryDevice::clearDirtyPages() {
+    dirtyPages.fill(0);
+
+    // Clean pages are not published for writes while tracking, and now every page is clean.
+    if (isDirtyTracking_) {
+        bus->withdrawMemoryWrPages();
+    }
+}
+
+void MemoryDevice::beginJournal() {
+    if (!journalRam) {
+        journalRam.reset(new uint8_t[SIZE_RAM]);
+        journalPages.reset(new uint16_t[PAGES_RAM]);
+    }
+
+    // Journal uses the same trap as dirty tracking, so tracked pages are restored by revertJournal().
+    isJournalDirtyTracking = isDirtyTracking_;
+    journalDirtyPages = dirtyPages;
+    journalPagesCount = 0;
+    isJournalRecording = true;
+
+    isDirtyTracking_ = true;
+    dirtyPages.fill(0);
+    bus->withdrawMemoryWrPages();
+}
+
+int MemoryDevice::revertJournal() {
+    for (int i = 0; i < journalPagesCount; ++i) {
+        std::memcpy(getRamPageForWrite(journalPages[i]), &journalRam[i * PAGE_SIZE], PAGE_SIZE);
+    }
+
+    isJournalRecording = false;
+    isDirtyTracking_ = isJournalDirtyTracking;
+    dirtyPages = journalDirtyPages;
+    bus->updateMemoryWrPages();
+
+    return journalPagesCount;
+}
+
+void MemoryDevice::recordJournalPage(uint32_t page) {
+    std::memcpy(&journalRam[journalPagesCount * PAGE_SIZE], getRamPage(static_cast<int>(page)), PAGE_SIZE);
+    journalPages[journalPagesCount++] = static_cast<uint16_t>(page);
+}
+
+void MemoryDevice::unshareRamBank(uint32_t bank) {
+    std::shared_ptr<uint8_t[]> copy { new uint8_t[SIZE_BANK] };
+    std::memcpy(copy.get(), ramBankPtrs[bank], SIZE_BANK);
+    bus->releaseMemory(ramBankPtrs[bank], SIZE_BANK);
+
+    ramBanks[bank] = std::move(copy);
+    ramBankPtrs[bank] = ramBanks[bank].get();
+    sharedRamBanks &= ~(static_cast<uint64_t>(1) << bank);
+}
+
+void MemoryDevice::unshareRom() {
+    if (isRomShared) {
+        std::shared_ptr<uint8_t[]> copy { new uint8_t[SIZE_BANK * BANKS_ROM] };
+        std::memcpy(copy.get(), rom.get(), SIZE_BANK * BANKS_ROM);
+        bus->releaseMemory(rom.get(), SIZE_BANK * BANKS_ROM);
+
+        rom = std::move(copy);
+        isRomShared = false;
+        remap();
+    }
+}
+
 void MemoryDevice::onMreqWrRomNone(uint16_t /* address */, uint8_t /* value */) {
 }
 
 void MemoryDevice::onMreqWrRomRam(uint16_t address, uint8_t value) {
-    ram[address] = value;
+    writeRam(address, address, value);
 }
 
 uint8_t MemoryDevice::onMreqRdRom(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
@@ -177,17 +350,13 @@ uint8_t MemoryDevice::onMreqRdRom(void* data, int /* mreqRdLayer */, uint16_t ad
 }
 
 uint8_t MemoryDevice::onMreqRdRamBank2(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
-    // address - 0x8000 + SIZE_BANK * 2 === address
-
     auto self = static_cast<MemoryDevice*>(data);
-    return self->ram[address];
+    return self->ramBankPtrs[2][address - SIZE_BANK * 2];
 }
 
 uint8_t MemoryDevice::onMreqRdRamBank5(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
-    // address - 0x4000 + SIZE_BANK * 5 === address + SIZE_BANK * 4
-
     auto self = static_cast<MemoryDevice*>(data);
-    return self->ram[address + SIZE_BANK * 4];
+    return self->ramBankPtrs[5][address - SIZE_BANK];
 }
 
 uint8_t MemoryDevice::onMreqRdRamBankSel(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
@@ -204,19 +373,19 @@ void MemoryDevice::onMreqWrRamBank2(void* data, int /* mreqWrLayer */, uint16_t
     // address - 0x8000 + SIZE_BANK * 2 === address
 
     auto self = static_cast<MemoryDevice*>(data);
-    self->ram[address] = value;
+    self->writeRam(address, address, value);
 }
 
 void MemoryDevice::onMreqWrRamBank5(void* data, int /* mreqWrLayer */, uint16_t address, uint8_t value) {
     // address - 0x4000 + SIZE_BANK * 5 === address + SIZE_BANK * 4
 
     auto self = static_cast<MemoryDevice*>(data);
-    self->ram[address + SIZE_BANK * 4] = value;
+    self->writeRam(address, address + SIZE_BANK * 4, value);
 }
 
 void MemoryDevice::onMreqWrRamBankSel(void* data, int /* mreqWrLayer */, uint16_t address, uint8_t value) {
     auto self = static_cast<MemoryDevice*>(data);
-    self->ram[address - SIZE_BANK * 3] = value;
+    self->writeRam(address, self->ramBankSel * SIZE_BANK + address - SIZE_BANK * 3, value);
 }
 
 void MemoryDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t port, uint8_t value) {
@@ -247,4 +416,44 @@ void MemoryDevice::onIorqWr(void* data, int /* iorqWrLayer */, uint16_t port, ui
     self->remap();
 }
 
+uint8_t* MemoryDevice::onResolveMreqRdRom(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return &self->romBankPtr[address];
+}
+
+uint8_t* MemoryDevice::onResolveMreqRdRamBank2(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return &self->ramBankPtrs[2][address - SIZE_BANK * 2];
+}
+
+uint8_t* MemoryDevice::onResolveMreqRdRamBank5(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return &self->ramBankPtrs[5][address - SIZE_BANK];
+}
+
+uint8_t* MemoryDevice::onResolveMreqRdRamBankSel(void* data, int /* mreqRdLayer */, uint16_t address, bool /* isM1 */) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return &self->ramBankPtr[address - SIZE_BANK * 3];
+}
+
+uint8_t* MemoryDevice::onResolveMreqWrRom(void* data, int /* mreqWrLayer */, uint16_t address) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return (self->onMreqWrRomPtr == &MemoryDevice::onMreqWrRomRam) ? self->resolveRamWrPage(address) : nullptr;
+}
+
+uint8_t* MemoryDevice::onResolveMreqWrRamBank2(void* data, int /* mreqWrLayer */, uint16_t address) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return self->resolveRamWrPage(address);
+}
+
+uint8_t* MemoryDevice::onResolveMreqWrRamBank5(void* data, int /* mreqWrLayer */, uint16_t address) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return self->resolveRamWrPage(address + SIZE_BANK * 4);
+}
+
+uint8_t* MemoryDevice::onResolveMreqWrRamBankSel(void* data, int /* mreqWrLayer */, uint16_t address) {
+    auto self = static_cast<MemoryDevice*>(data);
+    return self->resolveRamWrPage(self->ramBankSel * SIZE_BANK + address - SIZE_BANK * 3);
+}
+
 }
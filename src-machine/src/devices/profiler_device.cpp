@@ -0,0 +1,214 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "devices/profiler_device.h"
+#include <algorithm>
+
+namespace zemux {
+
+static_assert(ProfilerDevice::LAYERS_MREQ_RD * 2 == Bus::LAYERS_MREQ_RD, "Profiler overlay must be the highest bit");
+static_assert(ProfilerDevice::LAYERS_MREQ_WR * 2 == Bus::LAYERS_MREQ_WR, "Profiler overlay must be the highest bit");
+static_assert(ProfilerDevice::LAYERS_IORQ_RD * 2 == Bus::LAYERS_IORQ_RD, "Profiler overlay must be the highest bit");
+static_assert(ProfilerDevice::LAYERS_IORQ_WR * 2 == Bus::LAYERS_IORQ_WR, "Profiler overlay must be the highest bit");
+
+void ProfilerDevice::Profile::clear() {
+    for (auto& counters : mreqRd) {
+        counters.fill(0);
+    }
+
+    for (auto& counters : mreqM1) {
+        counters.fill(0);
+    }
+
+    for (auto& counters : mreqWr) {
+        counters.fill(0);
+    }
+
+    iorqRd.fill(0);
+    iorqWr.fill(0);
+    std::fill(iorqRdPorts.begin(), iorqRdPorts.end(), 0);
+    std::fill(iorqWrPorts.begin(), iorqWrPorts.end(), 0);
+}
+
+void ProfilerDevice::Profile::allocatePorts() {
+    iorqRdPorts.assign(PORTS, 0);
+    iorqWrPorts.assign(PORTS, 0);
+}
+
+void ProfilerDevice::Profile::freePorts() {
+    std::vector<uint32_t>().swap(iorqRdPorts);
+    std::vector<uint32_t>().swap(iorqWrPorts);
+}
+
+ProfilerDevice::ProfilerDevice(Bus* bus) : Device(bus) {
+}
+
+uint32_t ProfilerDevice::getEventCategory() {
+    return Event::CategoryProfiler;
+}
+
+EventOutput ProfilerDevice::onEvent(uint32_t type, EventInput input) {
+    switch (type) {
+        case EventSetEnabled:
+            setEnabled(input.value);
+            return EventOutput { .isHandled = true };
+
+        case EventIsEnabled:
+            return EventOutput { .isHandled = true, .value = isEnabled_ };
+
+        case EventGetFrameProfile:
+            *static_cast<const Profile**>(input.pointer) = &frameProfile;
+            return EventOutput { .isHandled = true };
+
+        default:
+            return EventOutput {};
+    }
+}
+
+void ProfilerDevice::onDetach() {
+    if (isEnabled_) {
+        setEnabled(false);
+    }
+
+    Device::onDetach();
+}
+
+void ProfilerDevice::onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) {
+    rules.push_back(BusMreqRdRule {
+            .mask = 0,
+            .value = 0,
+            .element = { .callback = onMreqRd, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_RD_PROFILER,
+            .layerValue = Bus::OVERLAY_MREQ_RD_PROFILER });
+}
+
+void ProfilerDevice::onConfigureMreqWr(std::vector<BusMreqWrRule>& rules) {
+    rules.push_back(BusMreqWrRule {
+            .mask = 0,
+            .value = 0,
+            .element = { .callback = onMreqWr, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_WR_PROFILER,
+            .layerValue = Bus::OVERLAY_MREQ_WR_PROFILER });
+}
+
+void ProfilerDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    rules.push_back(BusIorqRdRule {
+            .mask = 0,
+            .value = 0,
+            .element = { .callback = onIorqRd, .data = this },
+            .layerMask = Bus::OVERLAY_IORQ_RD_PROFILER,
+            .layerValue = Bus::OVERLAY_IORQ_RD_PROFILER });
+}
+
+void ProfilerDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    rules.push_back(BusIorqWrRule {
+            .mask = 0,
+            .value = 0,
+            .element = { .callback = onIorqWr, .data = this },
+            .layerMask = Bus::OVERLAY_IORQ_WR_PROFILER,
+            .layerValue = Bus::OVERLAY_IORQ_WR_PROFILER });
+}
+
+void ProfilerDevice::onFrameFinished(uint32_t /* ticks */) {
+    if (isEnabled_) {
+        // Profile of the last real frame is kept, speculative ones are discarded.
+        if (!bus->isSpeculative) {
+            std::swap(profile, frameProfile);
+        }
+
+        profile.clear();
+    }
+}
+
+void ProfilerDevice::onReset() {
+    // Bus resets all overlays.
+    if (isEnabled_) {
+        setEnabled(true);
+    }
+}
+
+void ProfilerDevice::setEnabled(bool isEnabled) {
+    // Port counters take 512K per profile, so they are allocated only while profiler is enabled.
+    if (isEnabled && !isEnabled_) {
+        profile.clear();
+        profile.allocatePorts();
+        frameProfile.clear();
+        frameProfile.allocatePorts();
+    } else if (!isEnabled && isEnabled_) {
+        profile.freePorts();
+        frameProfile.freePorts();
+    }
+
+    isEnabled_ = isEnabled;
+
+    bus->toggleMreqRdOverlay(Bus::OVERLAY_MREQ_RD_PROFILER, isEnabled);
+    bus->toggleMreqWrOverlay(Bus::OVERLAY_MREQ_WR_PROFILER, isEnabled);
+    bus->toggleIorqRdOverlay(Bus::OVERLAY_IORQ_RD_PROFILER, isEnabled);
+    bus->toggleIorqWrOverlay(Bus::OVERLAY_IORQ_WR_PROFILER, isEnabled);
+}
+
+uint8_t ProfilerDevice::onMreqRd(void* data, int mreqRdLayer, uint16_t address, bool isM1) {
+    auto self = static_cast<ProfilerDevice*>(data);
+    auto layer = mreqRdLayer & ~Bus::OVERLAY_MREQ_RD_PROFILER;
+    auto& counters = isM1 ? self->profile.mreqM1 : self->profile.mreqRd;
+    ++counters[layer][address >> PAGE_BITS];
+
+    auto element = self->bus->getMreqRdElement(layer, address, isM1);
+    return element.callback(element.data, layer, address, isM1);
+}
+
+void ProfilerDevice::onMreqWr(void* data, int mreqWrLayer, uint16_t address, uint8_t value) {
+    auto self = static_cast<ProfilerDevice*>(data);
+    auto layer = mreqWrLayer & ~Bus::OVERLAY_MREQ_WR_PROFILER;
+    ++self->profile.mreqWr[layer][address >> PAGE_BITS];
+
+    auto element = self->bus->getMreqWrElement(layer, address);
+    element.callback(element.data, layer, address, value);
+}
+
+uint8_t ProfilerDevice::onIorqRd(void* data, int iorqRdLayer, uint16_t port) {
+    auto self = static_cast<ProfilerDevice*>(data);
+    auto layer = iorqRdLayer & ~Bus::OVERLAY_IORQ_RD_PROFILER;
+    ++self->profile.iorqRd[layer];
+    ++self->profile.iorqRdPorts[port];
+
+    auto element = self->bus->getIorqRdElement(layer, port);
+    return element.callback(element.data, layer, port);
+}
+
+void ProfilerDevice::onIorqWr(void* data, int iorqWrLayer, uint16_t port, uint8_t value) {
+    auto self = static_cast<ProfilerDevice*>(data);
+    auto layer = iorqWrLayer & ~Bus::OVERLAY_IORQ_WR_PROFILER;
+    ++self->profile.iorqWr[layer];
+    ++self->profile.iorqWrPorts[port];
+
+    auto element = self->bus->getIorqWrElement(layer, port);
+    element.callback(element.data, layer, port, value);
+}
+
+}
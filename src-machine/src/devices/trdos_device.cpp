@@ -35,6 +35,9 @@ TrDosDevice::TrDosDevice(Bus* bus) : Device(bus) {
     rom.reset(new uint8_t[MemoryDevice::SIZE_BANK]);
 }
 
+TrDosDevice::TrDosDevice(Bus* bus, TrDosDevice* sharedDevice) : Device(bus), rom { sharedDevice->rom } {
+}
+
 uint32_t TrDosDevice::getEventCategory() {
     return Event::CategoryTrDos;
 }
@@ -42,6 +45,13 @@ uint32_t TrDosDevice::getEventCategory() {
 EventOutput TrDosDevice::onEvent(uint32_t type, EventInput input) {
     switch (type) {
         case EventLoadRom:
+            // Shared ROM is left to the other devices. Use count can only decrease concurrently, so it is safe.
+            if (rom.use_count() > 1) {
+                bus->releaseMemory(rom.get(), MemoryDevice::SIZE_BANK);
+                rom.reset(new uint8_t[MemoryDevice::SIZE_BANK]);
+                bus->updateMemoryPages();
+            }
+
             static_cast<DataReader*>(input.pointer)->readBlock(&rom[0], MemoryDevice::SIZE_BANK);
             return EventOutput { .isHandled = true };
 
@@ -62,107 +72,83 @@ EventOutput TrDosDevice::onEvent(uint32_t type, EventInput input) {
 
 void TrDosDevice::onAttach() {
     Device::onAttach();
-
-    for (int i = 0; i < Bus::LAYERS_MREQ_RD - 1; ++i) {
-        prevMreqRdMapLayers[i].reset(new BusMreqRdElement[Bus::ELEMENTS_MREQ_RD_BASE]);
-    }
+    bus->registerMreqRdResolver(onMreqRdRomOverlay, onResolveMreqRdRomOverlay);
 }
 
-void TrDosDevice::onDetach() {
-    for (int i = 0; i < Bus::LAYERS_MREQ_RD - 1; ++i) {
-        prevMreqRdMapLayers[i].reset(nullptr);
-    }
-
-    Device::onDetach();
-}
-
-BusMreqRdElement TrDosDevice::onConfigureMreqRd(BusMreqRdElement prev, int mreqRdLayer, uint16_t address, bool isM1) {
-    // prevMreqRdMapLayers:
+void TrDosDevice::onConfigureMreqRd(std::vector<BusMreqRdRule>& rules) {
+    // Pass-through (M1 pages):
     //
     // 0x0000 ... 0x3CFF -- unused
-    // 0x3D00 ... 0x3DFF -- onMreqRdRamM1Overlay (isM1 && !isOverlay)
+    // 0x3D00 ... 0x3DFF -- onMreqRdRom3DxxM1 (isM1 && !isOverlay)
     // 0x3E00 ... 0x3FFF -- unused
-    // 0x4000 ... 0xFFFF -- onMreqRdRom3DxxM1 (isM1 && isOverlay)
-
-    if (mreqRdLayer & Bus::OVERLAY_MREQ_RD_TRDOS) {
-        if (address < MemoryDevice::SIZE_BANK) {
-            return BusMreqRdElement { .callback = onMreqRdRomOverlay, .data = this };
-        }
-
-        if (isM1) {
-            auto layer = busLayerWithoutOverlay(mreqRdLayer,
-                    Bus::OVERLAY_MREQ_RD_TRDOS_LMASK,
-                    Bus::OVERLAY_MREQ_RD_TRDOS_UMASK);
-
-            prevMreqRdMapLayers[layer][address] = prev;
-            return BusMreqRdElement { .callback = onMreqRdRamM1Overlay, .data = this };
-        }
-
-        return prev;
-    }
-
-    if (isM1 && (address & 0xFF00) == 0x3D00) {
-        auto layer = busLayerWithoutOverlay(mreqRdLayer,
-                Bus::OVERLAY_MREQ_RD_TRDOS_LMASK,
-                Bus::OVERLAY_MREQ_RD_TRDOS_UMASK);
-
-        prevMreqRdMapLayers[layer][address] = prev;
-        return BusMreqRdElement { .callback = onMreqRdRom3DxxM1, .data = this };
-    }
-
-    return prev;
-}
-
-BusIorqRdElement TrDosDevice::onConfigureIorqRd(BusIorqRdElement prev, int iorqRdLayer, uint16_t port) {
-    if (!(iorqRdLayer & Bus::OVERLAY_IORQ_RD_TRDOS)) {
-        return prev;
-    }
-
-    switch (port) {
-        case PORT_COMMAND_STATUS:
-            return BusIorqRdElement { .callback = onIorqRdStatus, .data = this };
-
-        case PORT_TRACK:
-            return BusIorqRdElement { .callback = onIorqRdTrack, .data = this };
-
-        case PORT_SECTOR:
-            return BusIorqRdElement { .callback = onIorqRdSector, .data = this };
-
-        case PORT_DATA:
-            return BusIorqRdElement { .callback = onIorqRdData, .data = this };
-
-        case PORT_BDI_RQS:
-            return BusIorqRdElement { .callback = onIorqRdRqs, .data = this };
-
-        default:
-            return prev;
-    }
-}
-
-BusIorqWrElement TrDosDevice::onConfigureIorqWr(BusIorqWrElement prev, int iorqWrLayer, uint16_t port) {
-    if (!(iorqWrLayer & Bus::OVERLAY_IORQ_WR_TRDOS)) {
-        return prev;
-    }
-
-    switch (port) {
-        case PORT_COMMAND_STATUS:
-            return BusIorqWrElement { .callback = onIorqWrCommand, .data = this };
-
-        case PORT_TRACK:
-            return BusIorqWrElement { .callback = onIorqWrTrack, .data = this };
-
-        case PORT_SECTOR:
-            return BusIorqWrElement { .callback = onIorqWrSector, .data = this };
-
-        case PORT_DATA:
-            return BusIorqWrElement { .callback = onIorqWrData, .data = this };
-
-        case PORT_BDI_RQS:
-            return BusIorqWrElement { .callback = onIorqWrBdi, .data = this };
-
-        default:
-            return prev;
-    }
+    // 0x4000 ... 0xFFFF -- onMreqRdRamM1Overlay (isM1 && isOverlay)
+
+    rules.push_back(BusMreqRdRule {
+            .mask = MemoryDevice::MASK_BANK_ADDRESS,
+            .value = 0,
+            .element = { .callback = onMreqRdRomOverlay, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .layerValue = Bus::OVERLAY_MREQ_RD_TRDOS });
+
+    // 0x4000 ... 0x7FFF
+    rules.push_back(BusMreqRdRule {
+            .mask = Bus::ELEMENTS_MREQ_RD_BASE | 0xC000,
+            .value = Bus::ELEMENTS_MREQ_RD_BASE | 0x4000,
+            .element = { .callback = onMreqRdRamM1Overlay, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .layerValue = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .isPassThrough = true });
+
+    // 0x8000 ... 0xFFFF
+    rules.push_back(BusMreqRdRule {
+            .mask = Bus::ELEMENTS_MREQ_RD_BASE | 0x8000,
+            .value = Bus::ELEMENTS_MREQ_RD_BASE | 0x8000,
+            .element = { .callback = onMreqRdRamM1Overlay, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .layerValue = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .isPassThrough = true });
+
+    rules.push_back(BusMreqRdRule {
+            .mask = Bus::ELEMENTS_MREQ_RD_BASE | 0xFF00,
+            .value = Bus::ELEMENTS_MREQ_RD_BASE | 0x3D00,
+            .element = { .callback = onMreqRdRom3DxxM1, .data = this },
+            .layerMask = Bus::OVERLAY_MREQ_RD_TRDOS,
+            .layerValue = 0,
+            .isPassThrough = true });
+}
+
+void TrDosDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    auto addRule = [this, &rules](uint16_t port, decltype(BusIorqRdElement::callback) callback) {
+        rules.push_back(BusIorqRdRule {
+                .mask = Bus::MASK_PORT,
+                .value = port,
+                .element = { .callback = callback, .data = this },
+                .layerMask = Bus::OVERLAY_IORQ_RD_TRDOS,
+                .layerValue = Bus::OVERLAY_IORQ_RD_TRDOS });
+    };
+
+    addRule(PORT_COMMAND_STATUS, onIorqRdStatus);
+    addRule(PORT_TRACK, onIorqRdTrack);
+    addRule(PORT_SECTOR, onIorqRdSector);
+    addRule(PORT_DATA, onIorqRdData);
+    addRule(PORT_BDI_RQS, onIorqRdRqs);
+}
+
+void TrDosDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    auto addRule = [this, &rules](uint16_t port, decltype(BusIorqWrElement::callback) callback) {
+        rules.push_back(BusIorqWrRule {
+                .mask = Bus::MASK_PORT,
+                .value = port,
+                .element = { .callback = callback, .data = this },
+                .layerMask = Bus::OVERLAY_IORQ_WR_TRDOS,
+                .layerValue = Bus::OVERLAY_IORQ_WR_TRDOS });
+    };
+
+    addRule(PORT_COMMAND_STATUS, onIorqWrCommand);
+    addRule(PORT_TRACK, onIorqWrTrack);
+    addRule(PORT_SECTOR, onIorqWrSector);
+    addRule(PORT_DATA, onIorqWrData);
+    addRule(PORT_BDI_RQS, onIorqWrBdi);
 }
 
 void TrDosDevice::toggle(bool isEnabled) {
@@ -180,11 +166,8 @@ uint8_t TrDosDevice::onMreqRdRom3DxxM1(void* data, int mreqRdLayer, uint16_t add
         return self->rom[address];
     }
 
-    auto layer = busLayerWithoutOverlay(mreqRdLayer,
-            Bus::OVERLAY_MREQ_RD_TRDOS_LMASK,
-            Bus::OVERLAY_MREQ_RD_TRDOS_UMASK);
+    auto element = self->bus->getMreqRdPassElement(mreqRdLayer, address, true);
 
-    auto& element = self->prevMreqRdMapLayers[layer][address];
     return element.callback(element.data, mreqRdLayer, address, true);
 }
 
@@ -197,11 +180,8 @@ uint8_t TrDosDevice::onMreqRdRamM1Overlay(void* data, int mreqRdLayer, uint16_t
     auto self = static_cast<TrDosDevice*>(data);
     self->toggle(false);
 
-    auto layer = busLayerWithoutOverlay(mreqRdLayer,
-            Bus::OVERLAY_MREQ_RD_TRDOS_LMASK,
-            Bus::OVERLAY_MREQ_RD_TRDOS_UMASK);
+    auto element = self->bus->getMreqRdPassElement(mreqRdLayer, address, true);
 
-    auto& element = self->prevMreqRdMapLayers[layer][address];
     return element.callback(element.data, mreqRdLayer, address, true);
 }
 
@@ -240,4 +220,14 @@ void TrDosDevice::onIorqWrData(void* /* data */, int /* iorqWrLayer */, uint16_t
 void TrDosDevice::onIorqWrBdi(void* /* data */, int /* iorqWrLayer */, uint16_t /* port */, uint8_t /* value */) {
 }
 
+uint8_t* TrDosDevice::onResolveMreqRdRomOverlay(
+        void* data,
+        int /* mreqRdLayer */,
+        uint16_t address,
+        bool /* isM1 */) {
+
+    auto self = static_cast<TrDosDevice*>(data);
+    return &self->rom[address];
+}
+
 }
@@ -65,8 +65,8 @@ EventOutput ZxKeyboardDevice::onEvent(uint32_t type, EventInput input) {
     }
 }
 
-BusIorqRdElement ZxKeyboardDevice::onConfigureIorqRd(BusIorqRdElement prev, int /* iorqRdLayer */, uint16_t port) {
-    return (port & 1) ? prev : BusIorqRdElement { .callback = onIorqRd, .data = this };
+void ZxKeyboardDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
+    rules.push_back(BusIorqRdRule { .mask = 0x0001, .value = 0x0000, .element = { .callback = onIorqRd, .data = this } });
 }
 
 void ZxKeyboardDevice::resetKeys() {
@@ -26,11 +26,19 @@
  */
 
 #include "devices/zxm_device.h"
+#include <zemux_core/core.h>
 #include <zemux_vendor/ym2203_chip.h>
 #include <zemux_vendor/saa1099_chip.h>
 
 namespace zemux {
 
+struct ZxmDeviceState {
+    uint8_t selectedReg;
+    uint8_t pseudoReg;
+    uint8_t aySelectedRegs[ZxmDevice::TSFM_CHIPS_COUNT];
+    uint8_t ayRegs[ZxmDevice::TSFM_CHIPS_COUNT][0x10];
+};
+
 ZxmDevice::ZxmDevice(Bus* bus, SoundDesk* soundDesk) : Device { bus },
         soundDesk { soundDesk },
         ym2203Chronometer { 1, Ym2203Chip::SAMPLING_RATE },
@@ -90,7 +98,10 @@ EventOutput ZxmDevice::onEvent(uint32_t type, EventInput input) {
 
             if ((updateMask & Configuration::UpdateMode) && config->mode != mode) {
                 mode = config->mode;
-                bus->requestReconfigure();
+
+                // Chips of the new mode were not reset yet (and YM2203 hangs if not reset).
+                onReset();
+                bus->reconfigureDevice(this);
             }
 
             return EventOutput { .isHandled = true };
@@ -159,42 +170,55 @@ void ZxmDevice::onDetach() {
     Device::onDetach();
 }
 
-BusIorqRdElement ZxmDevice::onConfigureIorqRd(BusIorqRdElement prev, int /* iorqRdLayer */, uint16_t port) {
+void ZxmDevice::onConfigureIorqRd(std::vector<BusIorqRdRule>& rules) {
     // 0xFFFD
-    return ((port & 0b11000000'00000010) == 0b11000000'00000000)
-            ? BusIorqRdElement { .callback = onIorqRd, .data = this }
-            : prev;
+    rules.push_back(BusIorqRdRule {
+            .mask = 0b11000000'00000010,
+            .value = 0b11000000'00000000,
+            .element = { .callback = onIorqRd, .data = this } });
 }
 
-BusIorqWrElement ZxmDevice::onConfigureIorqWr(BusIorqWrElement prev, int /* iorqRdLayer */, uint16_t port) {
-    if (port == PORT_00FF) {
-        return (mode == ModeZxm) ? BusIorqWrElement { .callback = onIorqWr00FF, .data = this } : prev;
-    }
-
-    if (port == PORT_01FF) {
-        return (mode == ModeZxm) ? BusIorqWrElement { .callback = onIorqWr01FF, .data = this } : prev;
+void ZxmDevice::onConfigureIorqWr(std::vector<BusIorqWrRule>& rules) {
+    if (mode == ModeZxm) {
+        rules.push_back(BusIorqWrRule {
+                .mask = Bus::MASK_PORT,
+                .value = PORT_00FF,
+                .element = { .callback = onIorqWr00FF, .data = this } });
+
+        rules.push_back(BusIorqWrRule {
+                .mask = Bus::MASK_PORT,
+                .value = PORT_01FF,
+                .element = { .callback = onIorqWr01FF, .data = this } });
     }
 
     // 0xBFFD
-    if ((port & 0b11000000'00000010) == 0b10000000'00000000) {
-        return BusIorqWrElement { .callback = onIorqWrBFFD, .data = this };
-    }
+    rules.push_back(BusIorqWrRule {
+            .mask = 0b11000000'00000010,
+            .value = 0b10000000'00000000,
+            .element = { .callback = onIorqWrBFFD, .data = this } });
 
     // 0xFFFD
-    if ((port & 0b11000000'00000010) == 0b11000000'00000000) {
-        return BusIorqWrElement { .callback = onIorqWrFFFD, .data = this };
-    }
-
-    return prev;
+    rules.push_back(BusIorqWrRule {
+            .mask = 0b11000000'00000010,
+            .value = 0b11000000'00000000,
+            .element = { .callback = onIorqWrFFFD, .data = this } });
 }
 
 void ZxmDevice::onConfigureTimings(uint32_t ticksPerFrame) {
-    ayChronometer.setSrcClockRateFixedDst(ticksPerFrame);
-    ym2203Chronometer.setSrcClockRateFixedDst(ticksPerFrame);
-    saa1099Chronometer.setSrcClockRateFixedDst(ticksPerFrame);
+    // Chip rates are per second.
+    auto ticksPerSecond = ticksPerFrame * Core::FRAMES_PER_SECOND;
+
+    ayChronometer.setSrcClockRateFixedDst(ticksPerSecond);
+    ym2203Chronometer.setSrcClockRateFixedDst(ticksPerSecond);
+    saa1099Chronometer.setSrcClockRateFixedDst(ticksPerSecond);
 }
 
 void ZxmDevice::onFrameFinished(uint32_t ticks) {
+    // Internal state of chips is not saved, so they are not emulated in speculative frames.
+    if (bus->isSpeculative) {
+        return;
+    }
+
     auto ayTicks = ayChronometer.srcForwardToDelta(ticks);
     auto ym2203Ticks = ym2203Chronometer.srcForwardToDelta(ticks);
     auto saa1099Ticks = saa1099Chronometer.srcForwardToDelta(ticks);
@@ -245,6 +269,51 @@ void ZxmDevice::onReset() {
     }
 }
 
+// Only AY registers are saved. YM2203 and SAA1099 are vendor chips without access to their internal state,
+// they affect the sound only (except the YM2203 status, which depends on its timers).
+void ZxmDevice::onSaveState(DeviceState& state) {
+    ZxmDeviceState zxmState {};
+
+    zxmState.selectedReg = selectedReg;
+    zxmState.pseudoReg = pseudoReg;
+
+    for (int chipNum = 0; chipNum < TSFM_CHIPS_COUNT; ++chipNum) {
+        auto& ayChip = ayChips[chipNum];
+        zxmState.aySelectedRegs[chipNum] = ayChip.getSelectedReg();
+
+        for (uint8_t reg = 0; reg < 0x10; ++reg) {
+            zxmState.ayRegs[chipNum][reg] = ayChip.getRegValue(reg);
+        }
+    }
+
+    state.store(zxmState);
+}
+
+void ZxmDevice::onLoadState(const DeviceState& state) {
+    ZxmDeviceState zxmState {};
+
+    if (!state.load(zxmState)) {
+        return;
+    }
+
+    selectedReg = zxmState.selectedReg;
+    pseudoReg = zxmState.pseudoReg;
+
+    for (int chipNum = 0; chipNum < TSFM_CHIPS_COUNT; ++chipNum) {
+        auto& ayChip = ayChips[chipNum];
+
+        for (uint8_t reg = 0; reg < 0x10; ++reg) {
+            // Writing to the envelope shape restarts the envelope, even when the value is the same.
+            if (reg != AyChip::RegEnvShape || ayChip.getRegValue(reg) != zxmState.ayRegs[chipNum][reg]) {
+                ayChip.select(reg);
+                ayChip.write(zxmState.ayRegs[chipNum][reg]);
+            }
+        }
+
+        ayChip.select(zxmState.aySelectedRegs[chipNum]);
+    }
+}
+
 uint8_t ZxmDevice::onIorqRd(void* data, int /* iorqRdLayer */, uint16_t /* port */) {
     auto self = static_cast<ZxmDevice*>(data);
     auto mode = self->mode;
@@ -268,6 +337,10 @@ void ZxmDevice::onIorqWr00FF(void* data, int /* iorqWrLayer */, uint16_t /* port
     auto self = static_cast<ZxmDevice*>(data);
     auto& saa1099Chip = self->saa1099Chip;
 
+    if (self->bus->isSpeculative) {
+        return;
+    }
+
     saa1099Chip->step(self->saa1099Chronometer.srcForwardToDelta(self->bus->getFrameTicksPassed()));
     saa1099Chip->writeData(value);
 }
@@ -276,12 +349,21 @@ void ZxmDevice::onIorqWr01FF(void* data, int /* iorqWrLayer */, uint16_t /* port
     auto self = static_cast<ZxmDevice*>(data);
     auto& saa1099Chip = self->saa1099Chip;
 
+    if (self->bus->isSpeculative) {
+        return;
+    }
+
     saa1099Chip->step(self->saa1099Chronometer.srcForwardToDelta(self->bus->getFrameTicksPassed()));
     saa1099Chip->writeAddress(value);
 }
 
 void ZxmDevice::onIorqWrBFFD(void* data, int /* iorqWrLayer */, uint16_t /* port */, uint8_t value) {
     auto self = static_cast<ZxmDevice*>(data);
+
+    if (self->bus->isSpeculative) {
+        return;
+    }
+
     auto mode = self->mode;
     auto chipNum = (mode >= ModeTs ? self->getChipNum() : 0);
 
@@ -308,6 +390,12 @@ void ZxmDevice::onIorqWrFFFD(void* data, int /* iorqWrLayer */, uint16_t /* port
     }
 
     self->selectedReg = value;
+
+    // Selected register is restored with the device state.
+    if (self->bus->isSpeculative) {
+        return;
+    }
+
     auto chipNum = (mode >= ModeTs ? self->getChipNum() : 0);
 
     if (mode >= ModeTsFm && value >= SELECTED_REG_FM) {
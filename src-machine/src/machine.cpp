@@ -28,33 +28,93 @@
 #include "machine.h"
 #include "devices/border_device.h"
 #include "devices/covox_device.h"
+#include "devices/debugger_device.h"
 #include "devices/extport_device.h"
 #include "devices/kempston_joystick_device.h"
 #include "devices/kempston_mouse_device.h"
 #include "devices/zx_keyboard_device.h"
 #include "devices/memory_device.h"
+#include "devices/profiler_device.h"
 #include "devices/trdos_device.h"
 #include "devices/zxm_device.h"
+#include "host.h"
+#include <zemux_core/core.h>
+#include <cstring>
+#include <stdexcept>
 
 namespace zemux {
 
-Machine::Machine() : bus { this, &cpuChronometer }, cpu { &bus,
-        &Bus::onCpuMreqRd,
-        &Bus::onCpuMreqWr,
-        &Bus::onCpuIorqRd,
-        &Bus::onCpuIorqWr,
-        &Bus::onCpuIorqM1,
-        &Bus::onCpuPutAddress } {
+template <typename CallbackT>
+static int forEachDirtyRamPage(const uint64_t* dirtyPages, CallbackT callback) {
+    int pagesCount = 0;
+
+    for (int word = 0; word < MemoryDevice::DIRTY_WORDS; ++word) {
+        auto bits = dirtyPages[word];
+
+        for (int bit = 0; bits != 0; ++bit, bits >>= 1) {
+            if (bits & 1) {
+                callback(word * MemoryDevice::DIRTY_WORD_BITS + bit);
+                ++pagesCount;
+            }
+        }
+    }
+
+    return pagesCount;
+}
+
+Machine::Machine(TimingsKind timingsKind) : Machine { timingsKind, nullptr } {
+}
+
+Machine::Machine(TimingsKind timingsKind, Machine* sharedMachine) : bus { this, &cpuChronometer },
+        cpu { &bus },
+        timingsKind { timingsKind } {
+
+    switch (timingsKind) {
+        case TimingsScorpion:
+            useTimings<ScorpionTimings>();
+            break;
+
+        case TimingsSpectrum48:
+            useTimings<Spectrum48Timings>();
+            break;
+
+        case TimingsSpectrum128:
+            useTimings<Spectrum128Timings>();
+            break;
+
+        default:
+            useTimings<PentagonTimings>();
+            break;
+    }
+
+    bus.cpu = &cpu;
+    bus.setReconfigureMode(Bus::ReconfigureDeferred);
+
+    if (sharedMachine != nullptr) {
+        brazeDevice(Device::KindMemory, std::make_unique<MemoryDevice>(&bus, sharedMachine->memoryDevice));
+    } else {
+        brazeDevice(Device::KindMemory, std::make_unique<MemoryDevice>(&bus));
+    }
 
-    brazeDevice(Device::KindMemory, std::make_unique<MemoryDevice>(&bus));
     brazeDevice(Device::KindBorder, std::make_unique<BorderDevice>(&bus, &soundDesk));
     brazeDevice(Device::KindZxKeyboard, std::make_unique<ZxKeyboardDevice>(&bus));
     brazeDevice(Device::KindKempstonJoystick, std::make_unique<KempstonJoystickDevice>(&bus));
     brazeDevice(Device::KindKempstonMouse, std::make_unique<KempstonMouseDevice>(&bus));
     brazeDevice(Device::KindCovox, std::make_unique<CovoxDevice>(&bus, &soundDesk));
     brazeDevice(Device::KindZxm, std::make_unique<ZxmDevice>(&bus, &soundDesk));
-    brazeDevice(Device::KindTrDos, std::make_unique<TrDosDevice>(&bus));
+
+    if (sharedMachine != nullptr) {
+        brazeDevice(Device::KindTrDos, std::make_unique<TrDosDevice>(&bus,
+                static_cast<TrDosDevice*>(sharedMachine->deviceMap[Device::KindTrDos].get())));
+    } else {
+        brazeDevice(Device::KindTrDos, std::make_unique<TrDosDevice>(&bus));
+    }
+
     brazeDevice(Device::KindExtPort, std::make_unique<ExtPortDevice>(&bus));
+    brazeDevice(Device::KindDebugger, std::make_unique<DebuggerDevice>(&bus));
+    brazeDevice(Device::KindProfiler, std::make_unique<ProfilerDevice>(&bus));
+
+    memoryDevice = static_cast<MemoryDevice*>(deviceMap[Device::KindMemory].get());
 
     deviceMap[Device::KindMemory]->onAttach();
     deviceMap[Device::KindBorder]->onAttach();
@@ -65,29 +125,281 @@ Machine::Machine() : bus { this, &cpuChronometer }, cpu { &bus,
     deviceMap[Device::KindZxm]->onAttach();
     deviceMap[Device::KindTrDos]->onAttach();
     deviceMap[Device::KindExtPort]->onAttach();
+    deviceMap[Device::KindDebugger]->onAttach();
+    deviceMap[Device::KindProfiler]->onAttach();
 
     onBusReconfigure();
     onBusReset();
+
+    // Cables are reconfigured too, after devices have configured their timings.
+    soundDesk.onReconfigure(frameTicks * Core::FRAMES_PER_SECOND, SOUND_SAMPLES_PER_SECOND);
 }
 
-void Machine::renderFrame() {
-    // TODO: ...
+Machine::~Machine() {
+    // Sound cables must be detached from the sound desk while devices are alive.
+    for (auto& entry : deviceMap) {
+        if (entry.second->isAttached()) {
+            entry.second->onDetach();
+        }
+    }
+}
+
+template <typename TimingsT>
+void Machine::useTimings() {
+    frameTicks = TimingsT::FRAME_TICKS;
+    renderFrameFunc = &Machine::renderFrameImpl<TimingsT>;
+}
+
+template <typename TimingsT>
+void Machine::renderFrameImpl() {
+    // Devices don't produce sound in speculative frames.
+    bool isSoundFrame = !bus.isSpeculative;
+
+    trackFrameStage(nullptr);
 
-    auto frameTicks = cpuChronometer.getSrcTicksPassed();
+    if (isSoundFrame) {
+        soundDesk.onFrameStarted();
+    }
+
+    trackFrameStage(&MachineFrameStats::soundDeskTime);
+
+    timeline.schedule(TimingsT::INT_BEGIN_TICKS, MachineTimeline::KindIntBegin);
+    timeline.schedule(TimingsT::INT_END_TICKS, MachineTimeline::KindIntEnd);
+    timeline.schedule(TimingsT::FRAME_TICKS, MachineTimeline::KindFrameEnd);
+
+    for (bool isFrameEnd = false; !isFrameEnd;) {
+        runCpuUntil(timeline.top().ticks);
+        bus.onMachineDeadline();
+
+        // CPU usually overshoots the deadline by a few ticks, so several entries may be due.
+        while (!isFrameEnd && !timeline.isEmpty() && timeline.top().ticks <= cpuChronometer.getSrcTicksPassed()) {
+            auto entry = timeline.pop();
+
+            switch (entry.kind) {
+                case MachineTimeline::KindIntBegin:
+                    isIntLineActive = true;
+                    break;
+
+                case MachineTimeline::KindIntEnd:
+                    isIntLineActive = false;
+                    break;
+
+                case MachineTimeline::KindFrameEnd:
+                    isFrameEnd = true;
+                    break;
+
+                case MachineTimeline::KindEvent:
+                    // Timeline is restored after the run-ahead, so the event will be emitted in the real frame.
+                    if (!bus.isSpeculative) {
+                        emitEvent(entry.event, entry.input);
+                    }
+
+                    break;
+            }
+        }
+    }
+
+    isIntLineActive = false;
+    trackFrameStage(&MachineFrameStats::cpuTime);
 
     for (auto& device : attachedDevices) {
-        device->onFrameFinished(frameTicks);
+        device->onFrameFinished(TimingsT::FRAME_TICKS);
+    }
+
+    trackFrameStage(&MachineFrameStats::devicesTime);
+
+    if (isSoundFrame) {
+        soundDesk.onFrameFinished(TimingsT::FRAME_TICKS);
     }
 
-    cpuChronometer.srcConsume(frameTicks);
+    trackFrameStage(&MachineFrameStats::soundDeskTime);
+
+    // Ticks passed beyond the end of the frame are left for the next one.
+    cpuChronometer.srcConsume(TimingsT::FRAME_TICKS);
+    timeline.rebase(TimingsT::FRAME_TICKS);
+
+    if (frameStats != nullptr) {
+        ++frameStats->frames;
+    }
 }
 
-void Machine::brazeDevice(Device::DeviceKind kind, std::unique_ptr<Device> device) {
-    deviceMap[kind] = std::move(device);
+EventOutput Machine::emitEvent(uint32_t event, EventInput input) {
+    auto listenerIt = eventListenerMap.find(static_cast<int>(event & Event::MASK_CATEGORY));
+    return (listenerIt == eventListenerMap.end()) ? EventOutput {} : listenerIt->second->onEvent(event, input);
+}
 
+void Machine::scheduleEvent(uint32_t ticks, uint32_t event, EventInput input) {
+    timeline.schedule(ticks, MachineTimeline::KindEvent, event, input);
+}
+
+void Machine::setRunAheadFrames(int frames) {
+    if (frames < 0) {
+        throw std::invalid_argument("Run-ahead frames must not be negative");
+    }
+
+    runAheadFrames = frames;
+}
+
+int Machine::saveSnapshot(MachineSnapshot* snapshot) {
+    int copiedPages;
+
+    if (isSnapshotLatest(*snapshot)) {
+        copiedPages = forEachDirtyRamPage(memoryDevice->getDirtyPages(), [&](int page) {
+            std::memcpy(&snapshot->ram[page * MemoryDevice::PAGE_SIZE],
+                    memoryDevice->getRamPage(page),
+                    MemoryDevice::PAGE_SIZE);
+        });
+    } else {
+        memoryDevice->copyRamTo(snapshot->ram.get());
+        copiedPages = MemoryDevice::PAGES_RAM;
+    }
+
+    saveState(snapshot->state);
+    snapshot->renewSerial();
+    snapshotSerial = snapshot->serial;
+    trackSnapshotRam();
+
+    return copiedPages;
+}
+
+int Machine::loadSnapshot(const MachineSnapshot& snapshot) {
+    if (snapshot.isEmpty()) {
+        return 0;
+    }
+
+    int copiedPages;
+
+    if (isSnapshotLatest(snapshot)) {
+        copiedPages = forEachDirtyRamPage(memoryDevice->getDirtyPages(), [&](int page) {
+            std::memcpy(memoryDevice->getRamPageForWrite(page),
+                    &snapshot.ram[page * MemoryDevice::PAGE_SIZE],
+                    MemoryDevice::PAGE_SIZE);
+        });
+    } else {
+        memoryDevice->copyRamFrom(snapshot.ram.get());
+        copiedPages = MemoryDevice::PAGES_RAM;
+    }
+
+    loadState(snapshot.state);
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    if (copiedPages != 0) {
+        cpu.flushCodeCache();
+    }
+#endif
+
+    snapshotSerial = snapshot.serial;
+    trackSnapshotRam();
+
+    return copiedPages;
+}
+
+std::unique_ptr<Machine> Machine::fork() {
+    std::unique_ptr<Machine> machine { new Machine(timingsKind, this) };
+    MachineState state;
+
+    saveState(state);
+    machine->loadState(state);
+    machine->timeline.copyFrom(timeline);
+
+    return machine;
+}
+
+bool Machine::isSnapshotLatest(const MachineSnapshot& snapshot) {
+    return !snapshot.isEmpty() && snapshot.serial == snapshotSerial && memoryDevice->isDirtyTracking();
+}
+
+void Machine::saveState(MachineState& state) {
+    state.cpuState = cpu.getState();
+    state.busState = bus.getState();
+
+    for (auto& entry : deviceMap) {
+        entry.second->onSaveState(state.deviceStates[entry.first]);
+    }
+}
+
+void Machine::loadState(const MachineState& state) {
+    // Memory is remapped by devices, so bus state is restored after them.
+    for (auto& entry : deviceMap) {
+        entry.second->onLoadState(state.deviceStates[entry.first]);
+    }
+
+    bus.setState(state.busState);
+    cpu.setState(state.cpuState);
+}
+
+void Machine::runAhead() {
+    auto* stats = frameStats;
+    MachineFrameStats::Clock::time_point startTime;
+
+    if (stats != nullptr) {
+        startTime = MachineFrameStats::Clock::now();
+    }
+
+    // Speculative frames are not mixed with the real ones in the stats.
+    frameStats = nullptr;
+
+    saveState(runAheadState);
+    runAheadTimeline.copyFrom(timeline);
+    memoryDevice->beginJournal();
+    bus.isSpeculative = true;
+
+    for (int i = 0; i < runAheadFrames; ++i) {
+        (this->*renderFrameFunc)();
+    }
+
+    if (bus.hostEmitter != nullptr) {
+        bus.hostEmitter->emitEvent(Host::EventRunAheadFrame, EventInput {});
+    }
+
+    bus.isSpeculative = false;
+    [[maybe_unused]] auto restoredPages = memoryDevice->revertJournal();
+    loadState(runAheadState);
+    timeline.copyFrom(runAheadTimeline);
+
+#ifdef ZEMUX_Z80_CODE_CACHE
+    if (restoredPages != 0) {
+        cpu.flushCodeCache();
+    }
+#endif
+
+    frameStats = stats;
+
+    if (stats != nullptr) {
+        stats->runAheadFrames += runAheadFrames;
+        stats->runAheadTime += MachineFrameStats::Clock::now() - startTime;
+    }
+}
+
+void Machine::trackSnapshotRam() {
+    if (memoryDevice->isDirtyTracking()) {
+        memoryDevice->clearDirtyPages();
+    } else {
+        memoryDevice->setDirtyTracking(true);
+    }
+}
+
+void Machine::brazeDevice(Device::DeviceKind kind, std::unique_ptr<Device> device) {
     if (device->getEventCategory()) {
         eventListenerMap[device->getEventCategory()] = device.get();
     }
+
+    deviceMap[kind] = std::move(device);
+}
+
+void Machine::runCpuUntil(uint32_t ticks) {
+    auto tstatesPassed = cpuChronometer.getDstTicksPassed();
+    auto tstatesDeadline = cpuChronometer.srcToDstCeil(ticks);
+
+    if (tstatesDeadline <= tstatesPassed) {
+        return;
+    }
+
+    // INT end is a deadline too, so the line is either active or not for the whole burst.
+    auto tstateBudget = tstatesDeadline - tstatesPassed;
+    auto tstates = isIntLineActive ? cpu.run(tstateBudget, tstateBudget) : cpu.run(tstateBudget);
+
+    cpuChronometer.dstAdvanceBy(tstates);
 }
 
 void Machine::onBusReconfigure() {
@@ -102,7 +414,7 @@ void Machine::onBusReconfigure() {
     }
 
     for (auto& device : attachedDevices) {
-        device->onConfigureTimings(ulaFrameTicks);
+        device->onConfigureTimings(frameTicks);
     }
 
     bus.onMachineReconfigure(attachedDevices);
@@ -0,0 +1,330 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "machine_farm.h"
+#include <algorithm>
+
+#ifdef __linux__
+    #include <cstdio>
+    #include <fstream>
+    #include <string>
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace zemux {
+
+#ifdef __linux__
+// Reads the list in the sysfs format (e.g. "0-3,8-11"), missing file is the empty list.
+static std::vector<int> readSysfsList(const std::string& path) {
+    std::vector<int> result;
+    std::ifstream stream { path };
+    std::string range;
+
+    while (std::getline(stream, range, ',')) {
+        int first;
+        int last;
+        int count = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+
+        if (count < 1) {
+            continue;
+        }
+
+        for (int value = first; value <= (count == 2 ? last : first); ++value) {
+            result.push_back(value);
+        }
+    }
+
+    return result;
+}
+
+// CPUs of the inherited affinity set, ordered by NUMA node (so consecutive workers share the node).
+static std::vector<int> getPinnedCpus() {
+    cpu_set_t allowedSet;
+    CPU_ZERO(&allowedSet);
+
+    if (sched_getaffinity(0, sizeof(allowedSet), &allowedSet) != 0) {
+        return {};
+    }
+
+    std::vector<int> result;
+
+    auto addCpu = [&](int cpu) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowedSet)) {
+            CPU_CLR(cpu, &allowedSet);
+            result.push_back(cpu);
+        }
+    };
+
+    for (auto node : readSysfsList("/sys/devices/system/node/online")) {
+        for (auto cpu : readSysfsList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")) {
+            addCpu(cpu);
+        }
+    }
+
+    // The rest are CPUs without NUMA information (e.g. when sysfs is not available).
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        addCpu(cpu);
+    }
+
+    return result;
+}
+#endif
+
+double MachineFarm::Stats::getFramesPerSecond() const {
+    auto seconds = std::chrono::duration<double>(time).count();
+    return (seconds > 0.0) ? static_cast<double>(frames) / seconds : 0.0;
+}
+
+MachineFarm::MachineFarm(unsigned int threadsCount, [[maybe_unused]] bool isPinned) {
+    if (!threadsCount) {
+        threadsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+#ifdef __linux__
+    // Taken in the calling thread, workers are pinned to the CPUs it is allowed to run on.
+    if (isPinned) {
+        pinnedCpus = getPinnedCpus();
+    }
+#endif
+
+    for (unsigned int i = 0; i < threadsCount; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->index = i;
+        workers.push_back(std::move(worker));
+    }
+
+    for (auto& worker : workers) {
+        worker->thread = std::thread(&MachineFarm::runWorker, this, std::ref(*worker));
+    }
+}
+
+MachineFarm::~MachineFarm() {
+    {
+        std::lock_guard lock { controlMutex };
+        isStopping = true;
+    }
+
+    controlCondition.notify_all();
+
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+
+    // Machines are destroyed in the calling thread, after all workers are stopped.
+    machines.clear();
+}
+
+void MachineFarm::createMachines(size_t count, const MachineFactory& factory) {
+    auto firstIndex = machines.size();
+    machines.resize(firstIndex + count);
+    machineFramesLeft.resize(machines.size(), 0);
+
+    try {
+        runJob([&](Worker& worker) {
+            for (auto i = firstIndex; i < machines.size(); ++i) {
+                if (i % workers.size() == worker.index && !isFailed) {
+                    try {
+                        machines[i] = factory(i);
+                    } catch (...) {
+                        fail(std::current_exception());
+                    }
+                }
+            }
+        });
+    } catch (...) {
+        machines.resize(firstIndex);
+        machineFramesLeft.resize(firstIndex);
+        throw;
+    }
+}
+
+MachineFarm::Stats MachineFarm::runFrames(uint32_t frames, const FrameCallback& callback) {
+    Stats stats;
+
+    if (!frames || machines.empty()) {
+        return stats;
+    }
+
+    // Queues may be left non-empty by the failed run.
+    for (auto& worker : workers) {
+        worker->queue.clear();
+    }
+
+    for (size_t i = 0; i < machines.size(); ++i) {
+        machineFramesLeft[i] = frames;
+        workers[i % workers.size()]->queue.push_back(i);
+    }
+
+    unitsLeft = static_cast<uint64_t>(frames) * machines.size();
+    steals = 0;
+
+    auto startTime = Clock::now();
+
+    runJob([&](Worker& worker) {
+        renderFrames(worker, callback);
+    });
+
+    stats.time = Clock::now() - startTime;
+    stats.frames = static_cast<uint64_t>(frames) * machines.size() - unitsLeft;
+    stats.steals = steals;
+
+    return stats;
+}
+
+void MachineFarm::runWorker(Worker& worker) {
+#ifdef __linux__
+    if (!pinnedCpus.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(pinnedCpus[worker.index % pinnedCpus.size()], &cpuSet);
+
+        // Pinning is just a hint, farm works without it.
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    }
+#endif
+
+    uint64_t seenGeneration = 0;
+
+    for (;;) {
+        std::function<void(Worker&)> currentJob;
+
+        {
+            std::unique_lock lock { controlMutex };
+            controlCondition.wait(lock, [&] { return isStopping || jobGeneration != seenGeneration; });
+
+            if (isStopping) {
+                return;
+            }
+
+            seenGeneration = jobGeneration;
+            currentJob = job;
+        }
+
+        currentJob(worker);
+
+        {
+            std::lock_guard lock { controlMutex };
+            --jobWorkersLeft;
+        }
+
+        controlCondition.notify_all();
+    }
+}
+
+void MachineFarm::runJob(const std::function<void(Worker&)>& workerJob) {
+    isFailed = false;
+    failure = nullptr;
+
+    {
+        std::unique_lock lock { controlMutex };
+
+        job = workerJob;
+        jobWorkersLeft = static_cast<unsigned int>(workers.size());
+        ++jobGeneration;
+
+        controlCondition.notify_all();
+        controlCondition.wait(lock, [&] { return jobWorkersLeft == 0; });
+
+        job = nullptr;
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+void MachineFarm::renderFrames(Worker& worker, const FrameCallback& callback) {
+    size_t machineIndex;
+
+    while (unitsLeft && !isFailed) {
+        if (!takeMachine(worker, machineIndex)) {
+            // Every machine is busy in some other worker (only one frame of the machine may be in progress).
+            std::this_thread::yield();
+            continue;
+        }
+
+        try {
+            machines[machineIndex]->renderFrame();
+
+            if (callback) {
+                callback(*machines[machineIndex], machineIndex);
+            }
+        } catch (...) {
+            fail(std::current_exception());
+            return;
+        }
+
+        if (--machineFramesLeft[machineIndex]) {
+            std::lock_guard lock { worker.mutex };
+            worker.queue.push_back(machineIndex);
+        }
+
+        --unitsLeft;
+    }
+}
+
+bool MachineFarm::takeMachine(Worker& worker, size_t& machineIndex) {
+    {
+        // Own queue is taken from the back, so the machine that was just rendered goes on (its data is in the cache).
+        std::lock_guard lock { worker.mutex };
+
+        if (!worker.queue.empty()) {
+            machineIndex = worker.queue.back();
+            worker.queue.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t i = 1, len = workers.size(); i < len; ++i) {
+        auto& victim = *workers[(worker.index + i) % len];
+
+        // Others are stolen from the front, i.e. machines that waited the longest.
+        std::lock_guard lock { victim.mutex };
+
+        if (!victim.queue.empty()) {
+            machineIndex = victim.queue.front();
+            victim.queue.pop_front();
+            ++steals;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void MachineFarm::fail(std::exception_ptr exception) {
+    std::lock_guard lock { controlMutex };
+
+    if (!failure) {
+        failure = std::move(exception);
+    }
+
+    isFailed = true;
+}
+
+}
@@ -0,0 +1,411 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "machine_rewind.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "devices/memory_device.h"
+
+namespace zemux {
+
+// Header byte of the packed page: run of (header + 1) zero bytes if the highest bit is reset,
+// otherwise it is followed by ((header & RUN_MASK) + 1) literal bytes.
+static constexpr int RUN_MAX = 0x80;
+static constexpr uint8_t RUN_MASK = 0x7F;
+static constexpr uint8_t RUN_LITERAL = 0x80;
+
+// Page index followed by the packed page. Worst case is two literal runs of the full page.
+static constexpr size_t PAGE_HEADER_SIZE = sizeof(uint16_t);
+static constexpr size_t MAX_PACKED_PAGE_SIZE = PAGE_HEADER_SIZE + MemoryDevice::PAGE_SIZE / RUN_MAX
+        + MemoryDevice::PAGE_SIZE;
+static constexpr size_t MAX_PACKED_SIZE = MAX_PACKED_PAGE_SIZE * MemoryDevice::PAGES_RAM;
+static constexpr size_t NO_SPACE = SIZE_MAX;
+
+static bool isZeroPage(const uint8_t* page) {
+    uint8_t result = 0;
+
+    for (int i = 0; i < MemoryDevice::PAGE_SIZE; ++i) {
+        result |= page[i];
+    }
+
+    return result == 0;
+}
+
+static constexpr uint64_t WORD_LOW_BITS = 0x0101010101010101ULL;
+static constexpr uint64_t WORD_HIGH_BITS = 0x8080808080808080ULL;
+
+static ZEMUX_FORCE_INLINE uint64_t loadWord(const uint8_t* src) {
+    uint64_t result;
+    std::memcpy(&result, src, sizeof(result));
+    return result;
+}
+
+static ZEMUX_FORCE_INLINE bool hasZeroByte(uint64_t word) {
+    return ((word - WORD_LOW_BITS) & ~word & WORD_HIGH_BITS) != 0;
+}
+
+// Bytes to pack: the page itself for keyframes, XOR of the previous and the current page for deltas.
+struct PlainPageSource {
+    const uint8_t* page;
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint8_t byte(int position) const {
+        return page[position];
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint64_t word(int position) const {
+        return loadWord(page + position);
+    }
+};
+
+struct XorPageSource {
+    const uint8_t* page;
+    const uint8_t* otherPage;
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint8_t byte(int position) const {
+        return page[position] ^ otherPage[position];
+    }
+
+    [[nodiscard]] ZEMUX_FORCE_INLINE uint64_t word(int position) const {
+        return loadWord(page + position) ^ loadWord(otherPage + position);
+    }
+};
+
+template<typename SourceT>
+static ZEMUX_FORCE_INLINE bool isZeroPair(SourceT source, int position) {
+    return source.byte(position) == 0 && position + 1 < MemoryDevice::PAGE_SIZE && source.byte(position + 1) == 0;
+}
+
+// Zero runs shorter than two bytes are packed as literals. Runs are scanned and copied by words where possible.
+template<typename SourceT>
+static uint8_t* packPage(uint8_t* dst, int pageIndex, SourceT source) {
+    auto index = static_cast<uint16_t>(pageIndex);
+    std::memcpy(dst, &index, PAGE_HEADER_SIZE);
+    dst += PAGE_HEADER_SIZE;
+
+    int position = 0;
+
+    while (position < MemoryDevice::PAGE_SIZE) {
+        int start = position;
+        int limit = std::min(start + RUN_MAX, MemoryDevice::PAGE_SIZE);
+
+        if (isZeroPair(source, position)) {
+            while (position < limit) {
+                if (position + static_cast<int>(sizeof(uint64_t)) <= limit && source.word(position) == 0) {
+                    position += sizeof(uint64_t);
+                } else if (source.byte(position) == 0) {
+                    ++position;
+                } else {
+                    break;
+                }
+            }
+
+            *(dst++) = static_cast<uint8_t>(position - start - 1);
+        } else {
+            // Literals are copied while the run is scanned, header is written after the run.
+            uint8_t* header = dst++;
+
+            while (position < limit) {
+                for (; position + static_cast<int>(sizeof(uint64_t)) <= limit; position += sizeof(uint64_t)) {
+                    uint64_t word = source.word(position);
+
+                    if (hasZeroByte(word)) {
+                        break;
+                    }
+
+                    std::memcpy(dst, &word, sizeof(word));
+                    dst += sizeof(word);
+                }
+
+                if (position == limit || isZeroPair(source, position)) {
+                    break;
+                }
+
+                *(dst++) = source.byte(position++);
+            }
+
+            *header = static_cast<uint8_t>(RUN_LITERAL | (position - start - 1));
+        }
+    }
+
+    return dst;
+}
+
+// XORs pages of the record into the RAM.
+static void unpackPages(uint8_t* ram, const uint8_t* src, const uint8_t* srcEnd) {
+    while (src < srcEnd) {
+        uint16_t index;
+        std::memcpy(&index, src, PAGE_HEADER_SIZE);
+        src += PAGE_HEADER_SIZE;
+
+        uint8_t* page = ram + index * MemoryDevice::PAGE_SIZE;
+        int position = 0;
+
+        while (position < MemoryDevice::PAGE_SIZE) {
+            uint8_t header = *(src++);
+            int length = (header & RUN_MASK) + 1;
+
+            if (header & RUN_LITERAL) {
+                for (int i = 0; i < length; ++i) {
+                    page[position + i] ^= src[i];
+                }
+
+                src += length;
+            }
+
+            position += length;
+        }
+    }
+}
+
+MachineRewind::MachineRewind(Machine* machine, size_t memoryBudget, int keyframeInterval) : machine { machine },
+        memoryBudget { memoryBudget },
+        keyframeInterval { keyframeInterval },
+        liveSnapshot { std::make_unique<MachineSnapshot>() },
+        scratchSnapshot { std::make_unique<MachineSnapshot>() },
+        packed { new uint8_t[MAX_PACKED_SIZE] } {
+
+    if (memoryBudget < sizeof(MachineState) + MAX_PACKED_SIZE) {
+        throw std::invalid_argument("Memory budget is too small for the rewind");
+    }
+
+    if (keyframeInterval < 1) {
+        throw std::invalid_argument("Keyframe interval must be positive");
+    }
+
+    // Memory is touched in advance, so the system doesn't map its pages during recording.
+    arena.reset(new uint8_t[memoryBudget]);
+    std::memset(arena.get(), 0, memoryBudget);
+
+    // Every record holds at least its state.
+    records.resize(memoryBudget / sizeof(MachineState) + 1);
+}
+
+void MachineRewind::recordFrame() {
+    // Delta is packed before the live snapshot is updated, since it contains the previous RAM.
+    bool isLatest = machine->isSnapshotLatest(*liveSnapshot);
+    bool isKeyframe = (!isLatest || recordsCount == 0 || deltasSinceKeyframe + 1 >= keyframeInterval);
+
+    if (isLatest) {
+        const uint64_t* dirtyPages = machine->bus.memoryDevice->getDirtyPages();
+
+        for (int word = 0; word < MemoryDevice::DIRTY_WORDS; ++word) {
+            usedPages[word] |= dirtyPages[word];
+        }
+    } else {
+        // Whole RAM is copied to the live snapshot.
+        isUsedPagesKnown = false;
+    }
+
+    // Record is packed right into the arena, when the largest one fits there without eviction (it usually does),
+    // otherwise it is packed into the buffer and copied after the allocation.
+    size_t offset = findSpace(sizeof(MachineState) + MAX_PACKED_SIZE);
+    uint8_t* dst = (offset == NO_SPACE) ? packed.get() : arena.get() + offset + sizeof(MachineState);
+
+    size_t packedSize = isKeyframe ? 0 : packDelta(dst);
+    machine->saveSnapshot(liveSnapshot.get());
+
+    if (isKeyframe) {
+        packedSize = packKeyframe(dst);
+    }
+
+    if (offset == NO_SPACE) {
+        offset = allocateRecord(sizeof(MachineState) + packedSize);
+
+        // Everything was evicted (budget is too small for the keyframe interval), so delta has nothing to apply to.
+        if (recordsCount == 0 && !isKeyframe) {
+            isKeyframe = true;
+            packedSize = packKeyframe(dst);
+            offset = allocateRecord(sizeof(MachineState) + packedSize);
+        }
+
+        std::memcpy(arena.get() + offset + sizeof(MachineState), packed.get(), packedSize);
+    }
+
+    std::memcpy(arena.get() + offset, &liveSnapshot->state, sizeof(MachineState));
+
+    auto& record = getRecord(recordsCount++);
+    record.offset = offset;
+    record.size = sizeof(MachineState) + packedSize;
+    record.isKeyframe = isKeyframe;
+
+    writeOffset = offset + record.size;
+    usedMemory += record.size;
+    deltasSinceKeyframe = isKeyframe ? 0 : deltasSinceKeyframe + 1;
+}
+
+bool MachineRewind::seek(int framesBack) {
+    if (framesBack < 0 || framesBack >= recordsCount) {
+        return false;
+    }
+
+    int target = recordsCount - 1 - framesBack;
+    int keyframe = target;
+
+    // The oldest record is always a keyframe.
+    while (!getRecord(keyframe).isKeyframe) {
+        --keyframe;
+    }
+
+    uint8_t* ram = scratchSnapshot->ram.get();
+    std::memset(ram, 0, MachineSnapshot::RAM_SIZE);
+
+    for (int i = keyframe; i <= target; ++i) {
+        auto& record = getRecord(i);
+        const uint8_t* data = arena.get() + record.offset;
+        unpackPages(ram, data + sizeof(MachineState), data + record.size);
+    }
+
+    auto& record = getRecord(target);
+    std::memcpy(&scratchSnapshot->state, arena.get() + record.offset, sizeof(MachineState));
+    scratchSnapshot->renewSerial();
+
+    // After the load RAM of the machine is the same as in the scratch snapshot, so it becomes the live one.
+    machine->loadSnapshot(*scratchSnapshot);
+    std::swap(liveSnapshot, scratchSnapshot);
+    isUsedPagesKnown = false;
+
+    for (int i = target + 1; i < recordsCount; ++i) {
+        usedMemory -= getRecord(i).size;
+    }
+
+    recordsCount = target + 1;
+    writeOffset = record.offset + record.size;
+    deltasSinceKeyframe = target - keyframe;
+
+    return true;
+}
+
+void MachineRewind::clear() {
+    recordsHead = 0;
+    recordsCount = 0;
+    writeOffset = 0;
+    usedMemory = 0;
+    deltasSinceKeyframe = 0;
+}
+
+size_t MachineRewind::packKeyframe(uint8_t* dst) {
+    const uint8_t* ram = liveSnapshot->ram.get();
+    uint8_t* start = dst;
+
+    // XOR with zeros is the page itself, and zero pages are skipped (RAM is zeroed before unpacking of the keyframe).
+    for (int word = 0; word < MemoryDevice::DIRTY_WORDS; ++word) {
+        uint64_t bits = isUsedPagesKnown ? usedPages[word] : ~static_cast<uint64_t>(0);
+        uint64_t nonZeroBits = 0;
+
+        for (int bit = 0; bits != 0; ++bit, bits >>= 1) {
+            if (!(bits & 1)) {
+                continue;
+            }
+
+            int pageIndex = word * MemoryDevice::DIRTY_WORD_BITS + bit;
+            const uint8_t* page = ram + pageIndex * MemoryDevice::PAGE_SIZE;
+
+            if (!isZeroPage(page)) {
+                dst = packPage(dst, pageIndex, PlainPageSource { page });
+                nonZeroBits |= static_cast<uint64_t>(1) << bit;
+            }
+        }
+
+        usedPages[word] = nonZeroBits;
+    }
+
+    isUsedPagesKnown = true;
+    return static_cast<size_t>(dst - start);
+}
+
+size_t MachineRewind::packDelta(uint8_t* dst) {
+    auto* memoryDevice = machine->bus.memoryDevice;
+    const uint8_t* previousRam = liveSnapshot->ram.get();
+    const uint64_t* dirtyPages = memoryDevice->getDirtyPages();
+    uint8_t* start = dst;
+
+    for (int word = 0; word < MemoryDevice::DIRTY_WORDS; ++word) {
+        auto bits = dirtyPages[word];
+
+        for (int bit = 0; bits != 0; ++bit, bits >>= 1) {
+            if (!(bits & 1)) {
+                continue;
+            }
+
+            int pageIndex = word * MemoryDevice::DIRTY_WORD_BITS + bit;
+            const uint8_t* previousPage = previousRam + pageIndex * MemoryDevice::PAGE_SIZE;
+            const uint8_t* currentPage = memoryDevice->getRamPage(pageIndex);
+
+            // Page may be written with the same values. XOR is not stored anywhere, it is packed on the fly.
+            if (std::memcmp(previousPage, currentPage, MemoryDevice::PAGE_SIZE) != 0) {
+                dst = packPage(dst, pageIndex, XorPageSource { currentPage, previousPage });
+            }
+        }
+    }
+
+    return static_cast<size_t>(dst - start);
+}
+
+// Records are contiguous, so when there is not enough space at the end of the arena, the record goes to the start.
+// Returns NO_SPACE when the oldest records should be evicted first.
+size_t MachineRewind::findSpace(size_t size) {
+    if (recordsCount == 0) {
+        return 0;
+    }
+
+    size_t headOffset = getRecord(0).offset;
+
+    if (writeOffset > headOffset) {
+        if (memoryBudget - writeOffset >= size) {
+            return writeOffset;
+        }
+
+        if (headOffset >= size) {
+            return 0;
+        }
+    } else if (headOffset - writeOffset >= size) {
+        return writeOffset;
+    }
+
+    return NO_SPACE;
+}
+
+size_t MachineRewind::allocateRecord(size_t size) {
+    size_t offset;
+
+    while ((offset = findSpace(size)) == NO_SPACE) {
+        evictOldestRecords();
+    }
+
+    return offset;
+}
+
+void MachineRewind::evictOldestRecords() {
+    do {
+        usedMemory -= getRecord(0).size;
+        recordsHead = (recordsHead + 1) % static_cast<int>(records.size());
+        --recordsCount;
+    } while (recordsCount != 0 && !getRecord(0).isKeyframe);
+}
+
+}
@@ -120,8 +120,11 @@ void SoundDesk::onFrameFinished(uint32_t ticks) {
     for (uint32_t i = frameMinPosition; i--; ++samplePtr, ++ratioPtr) {
         uint32_t ratio = std::min(SoundDeskJack::VOLUME_MAX, *ratioPtr);
 
-        samplePtr->left /= ratio;
-        samplePtr->right /= ratio;
+        // Zero volume means that every jack has faded out, so the sample is zero too.
+        if (ratio) {
+            samplePtr->left /= ratio;
+            samplePtr->right /= ratio;
+        }
     }
 }
 
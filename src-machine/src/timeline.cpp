@@ -0,0 +1,74 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "timeline.h"
+#include <algorithm>
+
+namespace zemux {
+
+static bool isLaterEntry(const MachineTimeline::Entry& a, const MachineTimeline::Entry& b) {
+    return (a.ticks != b.ticks) ? (a.ticks > b.ticks) : (a.sequence > b.sequence);
+}
+
+void MachineTimeline::schedule(uint32_t ticks, Kind kind, uint32_t event, EventInput input) {
+    entries.push_back(Entry {
+            .ticks = ticks,
+            .sequence = nextSequence++,
+            .kind = kind,
+            .event = event,
+            .input = input });
+
+    std::push_heap(entries.begin(), entries.end(), isLaterEntry);
+}
+
+void MachineTimeline::rebase(uint32_t frameTicks) {
+    for (auto& entry : entries) {
+        entry.ticks = (entry.ticks > frameTicks) ? (entry.ticks - frameTicks) : 0;
+    }
+
+    // Entries clamped to zero are ordered by sequence now.
+    std::make_heap(entries.begin(), entries.end(), isLaterEntry);
+}
+
+void MachineTimeline::clear() {
+    entries.clear();
+}
+
+void MachineTimeline::copyFrom(const MachineTimeline& other) {
+    entries.assign(other.entries.begin(), other.entries.end());
+    nextSequence = other.nextSequence;
+}
+
+MachineTimeline::Entry MachineTimeline::pop() {
+    std::pop_heap(entries.begin(), entries.end(), isLaterEntry);
+    auto entry = entries.back();
+    entries.pop_back();
+    return entry;
+}
+
+}
@@ -1,58 +1,411 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Headless runner: runs the machine as fast as possible and reports throughput.
+// Used for capacity planning and for catching performance regressions on real software.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <zemux_core/core.h>
 #include <zemux_core/non_copyable.h>
 #include <zemux_core/sound.h>
-#include <zemux_integrated/z80_chip.h>
-#include <zemux_integrated/ay_chip.h>
-#include <cstdint>
+#include <zemux_integrated/tape_tap.h>
+#include <zemux_integrated/tape_wav.h>
+#include <zemux_machine/machine.h>
+#include <zemux_machine/devices/memory_device.h>
+#include "file_data_reader.h"
 
 namespace zemux {
 
-static uint8_t onStubMreqRd(void* /* data */, uint16_t /* address */, bool /* isM1 */) {
-    return 0x00;
+struct RunnerOptions {
+    static constexpr int DEFAULT_FRAMES = 1000;
+
+    Machine::TimingsKind timingsKind = Machine::TimingsPentagon;
+    int frames = DEFAULT_FRAMES;
+    int runAheadFrames = 0;
+    std::string romPath;
+    std::string snapshotPath;
+    std::string tapePath;
+    std::string soundPath;
+    std::string z80ProfilePath;
+};
+
+struct RunnerStats {
+    using Clock = std::chrono::steady_clock;
+
+    MachineFrameStats machine;
+    Clock::duration tapeTime {};
+    Clock::duration soundOutputTime {};
+    Clock::duration totalTime {};
+};
+
+// Tape input is not mixed into the sound desk yet, only its volume bit is read (see ZxKeyboardDevice).
+class NullSoundSink final : public SoundSink, private NonCopyable {
+public:
+
+    void sinkForwardTo(uint16_t /* left */, uint16_t /* right */, uint32_t /* ticks */) override {
+    }
+
+    void sinkAdvanceBy(uint16_t /* left */, uint16_t /* right */, uint32_t /* ticksDelta */) override {
+    }
+};
+
+static constexpr uintmax_t SIZE_ROM_BANK = MemoryDevice::SIZE_BANK;
+static constexpr uintmax_t SIZE_ROM_FULL = MemoryDevice::SIZE_BANK * MemoryDevice::BANKS_ROM;
+static constexpr uintmax_t SIZE_SNA_HEADER = 27;
+static constexpr uintmax_t SIZE_SNA_48 = SIZE_SNA_HEADER + 0xC000;
+static constexpr uint16_t ADDRESS_SNA_RAM = 0x4000;
+static constexpr uint16_t PORT_BORDER = 0xFE;
+static constexpr uint8_t BIT_SNA_IFF2 = 0b0000'0100;
+
+static void printUsage(const char* name) {
+    std::cout << "Usage: " << name << " [options]\n"
+            << "  --frames N            frames to run (default " << RunnerOptions::DEFAULT_FRAMES << ")\n"
+            << "  --timings MODEL       pentagon (default), scorpion, 48 or 128\n"
+            << "  --run-ahead N         speculative frames after every frame (default 0)\n"
+            << "  --rom FILE            16K (48 BASIC) or 32K (128 menu and 48 BASIC) ROM image\n"
+            << "  --sna FILE            48K SNA snapshot\n"
+            << "  --tape FILE           TAP or WAV tape, played from the first frame\n"
+            << "  --sound FILE          write raw stereo 16-bit PCM (" << Machine::SOUND_SAMPLES_PER_SECOND
+            << " Hz)\n"
+            << "  --z80-profile FILE    write Z80 opcode profile as CSV (requires USE_Z80_PROFILER)\n";
 }
 
-static void onStubMreqWr(void* /* data */, uint16_t /* address */, uint8_t /* value */) {
+static Machine::TimingsKind parseTimingsKind(const std::string& value) {
+    if (value == "pentagon") {
+        return Machine::TimingsPentagon;
+    }
+
+    if (value == "scorpion") {
+        return Machine::TimingsScorpion;
+    }
+
+    if (value == "48") {
+        return Machine::TimingsSpectrum48;
+    }
+
+    if (value == "128") {
+        return Machine::TimingsSpectrum128;
+    }
+
+    throw std::invalid_argument("Unknown timings \"" + value + "\"");
 }
 
-static uint8_t onStubIorqRd(void* /* data */, uint16_t /* port */) {
-    return 0x00;
+static const char* getTimingsName(Machine::TimingsKind timingsKind) {
+    switch (timingsKind) {
+        case Machine::TimingsScorpion:
+            return "Scorpion";
+
+        case Machine::TimingsSpectrum48:
+            return "Spectrum 48";
+
+        case Machine::TimingsSpectrum128:
+            return "Spectrum 128";
+
+        default:
+            return "Pentagon";
+    }
 }
 
-static void onStubIorqWr(void* /* data */, uint16_t /* port */, uint8_t /* value */) {
+static RunnerOptions parseOptions(int argc, char** argv) {
+    RunnerOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string name = argv[i];
+
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for \"" + name + "\"");
+        }
+
+        std::string value = argv[++i];
+
+        if (name == "--frames") {
+            options.frames = std::stoi(value);
+
+            if (options.frames <= 0) {
+                throw std::invalid_argument("Frames must be positive");
+            }
+        } else if (name == "--run-ahead") {
+            options.runAheadFrames = std::stoi(value);
+
+            if (options.runAheadFrames < 0) {
+                throw std::invalid_argument("Run-ahead frames must not be negative");
+            }
+        } else if (name == "--timings") {
+            options.timingsKind = parseTimingsKind(value);
+        } else if (name == "--rom") {
+            options.romPath = value;
+        } else if (name == "--sna") {
+            options.snapshotPath = value;
+        } else if (name == "--tape") {
+            options.tapePath = value;
+        } else if (name == "--sound") {
+            options.soundPath = value;
+        } else if (name == "--z80-profile") {
+            options.z80ProfilePath = value;
+        } else {
+            throw std::invalid_argument("Unknown option \"" + name + "\"");
+        }
+    }
+
+#ifndef ZEMUX_Z80_PROFILER
+    if (!options.z80ProfilePath.empty()) {
+        throw std::invalid_argument("Z80 profile requires build with USE_Z80_PROFILER");
+    }
+#endif
+
+    return options;
 }
 
-static uint8_t onStubIorqM1(void* /* data */) {
-    return 0xFF;
+static bool hasSuffixIgnoreCase(const std::string& value, const std::string& suffix) {
+    if (value.size() < suffix.size()) {
+        return false;
+    }
+
+    return std::equal(suffix.begin(), suffix.end(), value.end() - suffix.size(), [](char a, char b) -> bool {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
 }
 
-static void onStubPutAddress(void* /* data */, uint16_t /* address */, uint_fast32_t /* cycles */) {
+static void loadRom(Machine& machine, DataReader& reader) {
+    auto size = reader.totalSize();
+
+    if (size == SIZE_ROM_FULL) {
+        machine.emitEvent(MemoryDevice::EventLoadRomFull, { .pointer = &reader });
+    } else if (size == SIZE_ROM_BANK) {
+        machine.emitEvent(MemoryDevice::EventLoadRomBank1, { .pointer = &reader });
+    } else {
+        throw std::invalid_argument("ROM must be 16K or 32K, got " + std::to_string(size) + " bytes");
+    }
 }
 
-class ZemuXStub : public SoundSink, private NonCopyable {
-public:
+static void loadSna48(Machine& machine, DataReader& reader) {
+    if (reader.totalSize() != SIZE_SNA_48) {
+        throw std::invalid_argument("Only 48K SNA snapshots are supported");
+    }
 
-    void sinkForwardTo(uint16_t /* left */, uint16_t /* right */, uint32_t /* ticks */) override {
+    auto& regs = machine.cpu.regs;
+
+    regs.I = reader.readUInt8();
+    regs.HL_ = reader.readUInt16();
+    regs.DE_ = reader.readUInt16();
+    regs.BC_ = reader.readUInt16();
+    regs.AF_ = reader.readUInt16();
+    regs.HL = reader.readUInt16();
+    regs.DE = reader.readUInt16();
+    regs.BC = reader.readUInt16();
+    regs.IY = reader.readUInt16();
+    regs.IX = reader.readUInt16();
+    regs.IFF2 = (reader.readUInt8() & BIT_SNA_IFF2) != 0;
+    regs.IFF1 = regs.IFF2;
+    regs.R = reader.readUInt8();
+    regs.AF = reader.readUInt16();
+    regs.SP = reader.readUInt16();
+    regs.IM = reader.readUInt8();
+    machine.bus.onCpuIorqWr(PORT_BORDER, reader.readUInt8());
+
+    for (uint32_t address = ADDRESS_SNA_RAM; address <= 0xFFFF; ++address) {
+        machine.bus.onCpuMreqWr(static_cast<uint16_t>(address), reader.readUInt8());
     }
 
-    void sinkAdvanceBy(uint16_t /* left */, uint16_t /* right */, uint32_t /* ticksDelta */) override {
+    // PC is on the stack, as if the snapshot was taken inside the interrupt handler (RETN is expected).
+    regs.PC = machine.bus.onCpuMreqRd(regs.SP, false)
+            | (static_cast<uint16_t>(machine.bus.onCpuMreqRd(regs.SP + 1, false)) << 8);
+
+    regs.SP += 2;
+}
+
+static void writeSound(std::ostream& os, SoundDesk& soundDesk) {
+    auto* samples = soundDesk.getBuffer();
+
+    for (uint32_t i = 0, size = soundDesk.getBufferSize(); i < size; ++i) {
+        auto left = static_cast<uint16_t>(samples[i].left ^ 0x8000);
+        auto right = static_cast<uint16_t>(samples[i].right ^ 0x8000);
+
+        uint8_t data[] = {
+                static_cast<uint8_t>(left),
+                static_cast<uint8_t>(left >> 8),
+                static_cast<uint8_t>(right),
+                static_cast<uint8_t>(right >> 8),
+        };
+
+        os.write(reinterpret_cast<const char*>(data), sizeof(data));
     }
-};
+}
+
+static void printStage(const char* name, RunnerStats::Clock::duration time, RunnerStats::Clock::duration totalTime) {
+    auto millis = std::chrono::duration<double, std::milli>(time).count();
+    auto percents = totalTime.count() ? static_cast<double>(time.count()) * 100.0 / totalTime.count() : 0.0;
 
+    std::cout << "  " << std::left << std::setw(14) << name << std::right
+            << std::setw(10) << millis << " ms" << std::setw(8) << percents << " %\n";
 }
 
-int main() {
-    zemux::ZemuXStub zemuXStub;
+static void printReport(const RunnerOptions& options, Machine& machine, const RunnerStats& stats) {
+    auto seconds = std::chrono::duration<double>(stats.totalTime).count();
+    auto framesPerSecond = seconds > 0.0 ? static_cast<double>(stats.machine.frames) / seconds : 0.0;
+    auto megahertz = framesPerSecond * machine.getFrameTicks() / 1'000'000.0;
+
+    auto otherTime = stats.totalTime
+            - stats.machine.cpuTime
+            - stats.machine.devicesTime
+            - stats.machine.soundDeskTime
+            - stats.machine.runAheadTime
+            - stats.tapeTime
+            - stats.soundOutputTime;
+
+    std::cout << std::fixed << std::setprecision(2)
+            << "Timings: " << getTimingsName(options.timingsKind)
+            << " (" << machine.getFrameTicks() << " ticks per frame)\n"
+            << "Frames: " << stats.machine.frames << " in " << seconds * 1000.0 << " ms\n"
+            << "Speed: " << framesPerSecond << " frames/s ("
+            << framesPerSecond / Core::FRAMES_PER_SECOND << "x real time), " << megahertz << " MHz\n";
+
+    if (options.runAheadFrames != 0) {
+        std::cout << "Run-ahead: " << options.runAheadFrames << " frames ("
+                << stats.machine.runAheadFrames << " speculative frames in total)\n";
+    }
+
+    std::cout << "Time per subsystem:\n";
+
+    printStage("CPU", stats.machine.cpuTime, stats.totalTime);
+    printStage("Devices", stats.machine.devicesTime, stats.totalTime);
+    printStage("Sound desk", stats.machine.soundDeskTime, stats.totalTime);
+    printStage("Run-ahead", stats.machine.runAheadTime, stats.totalTime);
+    printStage("Tape", stats.tapeTime, stats.totalTime);
+    printStage("Sound output", stats.soundOutputTime, stats.totalTime);
+    printStage("Other", otherTime, stats.totalTime);
+}
+
+static void run(const RunnerOptions& options) {
+    auto machine = std::make_unique<Machine>(options.timingsKind);
+
+    if (!options.romPath.empty()) {
+        FileDataReader reader { options.romPath };
+        loadRom(*machine, reader);
+    } else {
+        std::cerr << "Warning: ROM is not loaded, its memory is not initialized\n";
+    }
+
+    if (!options.snapshotPath.empty()) {
+        FileDataReader reader { options.snapshotPath };
+        loadSna48(*machine, reader);
+    }
 
-    zemux::Z80Chip cpu { &zemuXStub,
-            zemux::onStubMreqRd,
-            zemux::onStubMreqWr,
-            zemux::onStubIorqRd,
-            zemux::onStubIorqWr,
-            zemux::onStubIorqM1,
-            zemux::onStubPutAddress };
+    NullSoundSink tapeSoundSink;
+    std::unique_ptr<FileDataReader> tapeReader;
+    std::unique_ptr<TapeTap> tapeTap;
+    std::unique_ptr<TapeWav> tapeWav;
+    Tape* tape = nullptr;
 
-    zemux::AyChip ayChip { &zemuXStub };
+    if (!options.tapePath.empty()) {
+        tapeReader = std::make_unique<FileDataReader>(options.tapePath);
+
+        if (hasSuffixIgnoreCase(options.tapePath, ".wav")) {
+            tapeWav = std::make_unique<TapeWav>(tapeReader.get(), &tapeSoundSink, false);
+            tape = tapeWav.get();
+        } else {
+            tapeTap = std::make_unique<TapeTap>(tapeReader.get(), &tapeSoundSink, false);
+            tape = tapeTap.get();
+        }
+
+        machine->bus.tape = tape;
+    }
+
+    std::ofstream soundStream;
+
+    if (!options.soundPath.empty()) {
+        soundStream.open(options.soundPath, std::ofstream::out | std::ofstream::binary);
+
+        if (soundStream.fail()) {
+            throw std::runtime_error("Failed to write to \"" + options.soundPath + "\"");
+        }
+    }
+
+    RunnerStats stats;
+    machine->setFrameStats(&stats.machine);
+    machine->setRunAheadFrames(options.runAheadFrames);
+
+    auto startTime = RunnerStats::Clock::now();
+
+    for (int i = 0; i < options.frames; ++i) {
+        machine->renderFrame();
+
+        if (tape != nullptr) {
+            auto tapeStartTime = RunnerStats::Clock::now();
+            tape->step(Tape::FRAME_MICROS);
+            stats.tapeTime += RunnerStats::Clock::now() - tapeStartTime;
+        }
+
+        if (soundStream.is_open()) {
+            auto soundStartTime = RunnerStats::Clock::now();
+            writeSound(soundStream, machine->soundDesk);
+            stats.soundOutputTime += RunnerStats::Clock::now() - soundStartTime;
+        }
+    }
+
+    stats.totalTime = RunnerStats::Clock::now() - startTime;
+    machine->setFrameStats(nullptr);
+    machine->bus.tape = nullptr;
+
+    printReport(options, *machine, stats);
+
+#ifdef ZEMUX_Z80_PROFILER
+    if (!options.z80ProfilePath.empty()) {
+        std::ofstream profileStream { options.z80ProfilePath };
+        machine->cpu.profile.writeCsv(profileStream);
+    }
+#endif
+}
+
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && (std::strcmp(argv[1], "--help") == 0 || std::strcmp(argv[1], "-h") == 0)) {
+        zemux::printUsage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    try {
+        zemux::run(zemux::parseOptions(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
 
-    std::cout << "Test\n";
-    return 0;
+    return EXIT_SUCCESS;
 }
@@ -0,0 +1,799 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <boost/test/unit_test.hpp>
+#include <zemux_core/chronometer.h>
+#include <zemux_machine/bus.h>
+#include <zemux_machine/host.h>
+#include <zemux_machine/machine.h>
+#include <zemux_machine/devices/border_device.h>
+#include <zemux_machine/devices/covox_device.h>
+#include <zemux_machine/devices/debugger_device.h>
+#include <zemux_machine/devices/extport_device.h>
+#include <zemux_machine/devices/kempston_joystick_device.h>
+#include <zemux_machine/devices/kempston_mouse_device.h>
+#include <zemux_machine/devices/memory_device.h>
+#include <zemux_machine/devices/profiler_device.h>
+#include <zemux_machine/devices/trdos_device.h>
+#include <zemux_machine/devices/zx_keyboard_device.h>
+#include <zemux_machine/devices/zxm_device.h>
+#include <zemux_machine/sound/sound_desk.h>
+
+static constexpr uint16_t PROGRAM_ADDRESS = 0x8000;
+static constexpr int PROGRAM_STEPS = 8;
+static constexpr uint16_t EXEC_ADDRESS = 0x8003;
+static constexpr uint16_t DATA_RD_ADDRESS = 0x9000;
+static constexpr uint16_t DATA_WR_ADDRESS = 0x9001;
+static constexpr uint16_t DATA_PORT = 0x12FE;
+static constexpr uint8_t DATA_VALUE = 0x5A;
+static constexpr int RECONFIGURE_FULL_ITERATIONS = 16;
+static constexpr int RECONFIGURE_DEVICE_ITERATIONS = 1024;
+static constexpr int DECODE_ITERATIONS = 0x10000;
+static constexpr int DECODE_IMAGE_MACHINES = 3;
+static constexpr uint32_t PROGRAM_MREQ_RD = 9; // operands, data and the check in BusTestMachine::execute()
+static constexpr int MACHINE_STEPS = 1000;
+
+// Bus with the minimal set of devices, without the rest of the Machine.
+class BusTestMachine final : public zemux::BusOwner, public zemux::EventEmitter {
+public:
+
+    zemux::ChronometerNarrow cpuChronometer { 1, 1 };
+    zemux::Bus bus { this, &cpuChronometer };
+    zemux::BasicZ80Chip<zemux::Bus> cpu { &bus };
+    zemux::MemoryDevice memoryDevice { &bus };
+    zemux::TrDosDevice trDosDevice { &bus };
+    zemux::DebuggerDevice debuggerDevice { &bus };
+    zemux::ProfilerDevice profilerDevice { &bus };
+    std::vector<zemux::Device*> devices { &memoryDevice, &trDosDevice, &debuggerDevice, &profilerDevice };
+    std::vector<zemux::HostDebuggerHit> hits;
+
+    BusTestMachine() {
+        bus.cpu = &cpu;
+        bus.hostEmitter = this;
+
+        for (auto device : devices) {
+            device->onAttach();
+        }
+
+        onBusReconfigure();
+        onBusReset();
+    }
+
+    void onBusReconfigure() override {
+        bus.onMachineReconfigure(devices);
+    }
+
+    void onBusReset() override {
+        bus.onMachineReset();
+        cpu.reset();
+
+        for (auto device : devices) {
+            device->onReset();
+        }
+    }
+
+    zemux::EventOutput emitEvent(uint32_t event, zemux::EventInput input) override {
+        if (event != zemux::Host::EventDebuggerHit) {
+            return zemux::EventOutput {};
+        }
+
+        hits.push_back(*static_cast<zemux::HostDebuggerHit*>(input.pointer));
+        return zemux::EventOutput { .isHandled = true };
+    }
+
+    void load();
+    void execute();
+};
+
+void BusTestMachine::load() {
+    static const uint8_t program[] = {
+            0x01, 0xFE, 0x12, // LD BC,#12FE
+            0x3A, 0x00, 0x90, // LD A,(#9000)
+            0x32, 0x01, 0x90, // LD (#9001),A
+            0xED, 0x78, // IN A,(C)
+            0xED, 0x79, // OUT (C),A
+            0x18, 0xFE, // JR $
+    };
+
+    for (uint16_t i = 0; i < sizeof(program); ++i) {
+        bus.onCpuMreqWr(PROGRAM_ADDRESS + i, program[i]);
+    }
+
+    bus.onCpuMreqWr(DATA_RD_ADDRESS, DATA_VALUE);
+}
+
+void BusTestMachine::execute() {
+    hits.clear();
+    cpu.regs.PC = PROGRAM_ADDRESS;
+
+    for (int i = 0; i < PROGRAM_STEPS; ++i) {
+        cpu.step();
+    }
+
+    BOOST_REQUIRE_EQUAL(cpu.regs.PC, PROGRAM_ADDRESS + 13);
+    BOOST_REQUIRE_EQUAL(bus.onCpuMreqRd(DATA_WR_ADDRESS, false), DATA_VALUE);
+}
+
+// Bus with the same set of devices as in the Machine, but without CPU.
+class BusReconfigureTestMachine final : public zemux::BusOwner {
+public:
+
+    zemux::ChronometerNarrow cpuChronometer { 1, 1 };
+    zemux::Bus bus { this, &cpuChronometer };
+    zemux::SoundDesk soundDesk;
+    zemux::MemoryDevice memoryDevice { &bus };
+    zemux::BorderDevice borderDevice { &bus, &soundDesk };
+    zemux::ZxKeyboardDevice zxKeyboardDevice { &bus };
+    zemux::KempstonJoystickDevice kempstonJoystickDevice { &bus };
+    zemux::KempstonMouseDevice kempstonMouseDevice { &bus };
+    zemux::CovoxDevice covoxDevice { &bus, &soundDesk };
+    zemux::ZxmDevice zxmDevice { &bus, &soundDesk };
+    zemux::TrDosDevice trDosDevice { &bus };
+    zemux::ExtPortDevice extPortDevice { &bus };
+    zemux::DebuggerDevice debuggerDevice { &bus };
+    zemux::ProfilerDevice profilerDevice { &bus };
+
+    std::vector<zemux::Device*> devices {
+            &memoryDevice,
+            &borderDevice,
+            &zxKeyboardDevice,
+            &kempstonJoystickDevice,
+            &kempstonMouseDevice,
+            &covoxDevice,
+            &zxmDevice,
+            &trDosDevice,
+            &extPortDevice,
+            &debuggerDevice,
+            &profilerDevice,
+    };
+
+    BusReconfigureTestMachine() {
+        for (auto device : devices) {
+            device->onAttach();
+        }
+
+        onBusReconfigure();
+    }
+
+    ~BusReconfigureTestMachine() {
+        // Sound cables must be detached from the sound desk while devices are alive.
+        for (auto device : devices) {
+            device->onDetach();
+        }
+    }
+
+    void onBusReconfigure() override {
+        bus.onMachineReconfigure(devices);
+    }
+
+    void onBusReset() override {
+    }
+
+    void setZxmMode(zemux::ZxmDevice::Mode mode);
+    int countMapDifferences(BusReconfigureTestMachine& other);
+};
+
+void BusReconfigureTestMachine::setZxmMode(zemux::ZxmDevice::Mode mode) {
+    zemux::ZxmDevice::Configuration config {};
+    config.updateMask = zemux::ZxmDevice::Configuration::UpdateMode;
+    config.mode = mode;
+
+    zxmDevice.onEvent(zemux::ZxmDevice::EventSetConfiguration, zemux::EventInput { .pointer = &config });
+}
+
+// Elements of different machines have different data, so they are compared by offset.
+template<typename ElementT>
+static bool isSameElement(const ElementT& element, const ElementT& otherElement, void* data, void* otherData) {
+    auto offset = element.data ? static_cast<uint8_t*>(element.data) - static_cast<uint8_t*>(data) : -1;
+
+    auto otherOffset = otherElement.data
+            ? static_cast<uint8_t*>(otherElement.data) - static_cast<uint8_t*>(otherData)
+            : -1;
+
+    return element.callback == otherElement.callback && offset == otherOffset;
+}
+
+template<typename GetElementT>
+static int countLayersDifferences(
+        const char* name,
+        int layers,
+        int elements,
+        BusReconfigureTestMachine& machine,
+        BusReconfigureTestMachine& otherMachine,
+        GetElementT getElement) {
+
+    int differences = 0;
+
+    for (int layer = 0; layer < layers; ++layer) {
+        for (int index = 0; index < elements; ++index) {
+            if (!isSameElement(getElement(machine.bus, layer, index),
+                    getElement(otherMachine.bus, layer, index),
+                    &machine,
+                    &otherMachine)) {
+
+                BOOST_TEST_MESSAGE(name << " layer " << layer << " differs at index " << index);
+                ++differences;
+            }
+        }
+    }
+
+    return differences;
+}
+
+int BusReconfigureTestMachine::countMapDifferences(BusReconfigureTestMachine& other) {
+    using zemux::Bus;
+
+    return countLayersDifferences("MREQ RD",
+            Bus::LAYERS_MREQ_RD,
+            Bus::ELEMENTS_MREQ_RD_BASE * 2,
+            *this,
+            other,
+            [](Bus& bus, int layer, int index) {
+                return bus.getMreqRdElement(layer, static_cast<uint16_t>(index), index >= Bus::ELEMENTS_MREQ_RD_BASE);
+            })
+            + countLayersDifferences("MREQ WR",
+                    Bus::LAYERS_MREQ_WR,
+                    Bus::MASK_ADDRESS + 1,
+                    *this,
+                    other,
+                    [](Bus& bus, int layer, int index) {
+                        return bus.getMreqWrElement(layer, static_cast<uint16_t>(index));
+                    })
+            + countLayersDifferences("IORQ RD",
+                    Bus::LAYERS_IORQ_RD,
+                    Bus::ELEMENTS_IORQ_RD,
+                    *this,
+                    other,
+                    [](Bus& bus, int layer, int index) {
+                        return bus.getIorqRdElement(layer, static_cast<uint16_t>(index));
+                    })
+            + countLayersDifferences("IORQ WR",
+                    Bus::LAYERS_IORQ_WR,
+                    Bus::ELEMENTS_IORQ_WR,
+                    *this,
+                    other,
+                    [](Bus& bus, int layer, int index) {
+                        return bus.getIorqWrElement(layer, static_cast<uint16_t>(index));
+                    });
+}
+
+template<typename FnT>
+static double measureMicros(int iterations, FnT fn) {
+    using namespace std::chrono;
+    auto startTime = steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+
+    return duration<double, std::micro>(steady_clock::now() - startTime).count() / iterations;
+}
+
+static void requireHit(const zemux::HostDebuggerHit& hit, int kind, uint16_t address, uint8_t value) {
+    BOOST_REQUIRE_EQUAL(hit.kind, kind);
+    BOOST_REQUIRE_EQUAL(hit.address, address);
+    BOOST_REQUIRE_EQUAL(hit.value, value);
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "cert-err58-cpp"
+
+BOOST_AUTO_TEST_CASE(BusDebuggerTest) {
+    using zemux::DebuggerDevice;
+
+    auto machine = std::make_unique<BusTestMachine>();
+    auto& debugger = machine->debuggerDevice;
+    machine->load();
+
+    debugger.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchIorqRd, DATA_PORT);
+    debugger.addWatchpoint(DebuggerDevice::WatchIorqWr, DATA_PORT);
+
+    BOOST_TEST_MESSAGE("Disabled debugger");
+    machine->execute();
+    BOOST_REQUIRE(machine->hits.empty());
+
+    BOOST_TEST_MESSAGE("Enabled debugger");
+    debugger.setEnabled(true);
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 5u);
+    requireHit(machine->hits[0], DebuggerDevice::WatchExec, EXEC_ADDRESS, 0x3A);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS, DATA_VALUE);
+    requireHit(machine->hits[2], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+    requireHit(machine->hits[3], DebuggerDevice::WatchIorqRd, DATA_PORT, 0xFF);
+    requireHit(machine->hits[4], DebuggerDevice::WatchIorqWr, DATA_PORT, 0xFF);
+
+    BOOST_TEST_MESSAGE("Removed watchpoint");
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 4u);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+
+    BOOST_TEST_MESSAGE("Reconfigured bus");
+    machine->onBusReconfigure();
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 4u);
+
+    BOOST_TEST_MESSAGE("Reset bus");
+    machine->onBusReset();
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 4u);
+
+    BOOST_TEST_MESSAGE("Disabled debugger again");
+    debugger.setEnabled(false);
+    machine->execute();
+    BOOST_REQUIRE(machine->hits.empty());
+
+    BOOST_TEST_MESSAGE("Removed all watchpoints");
+    debugger.setEnabled(true);
+    debugger.removeAllWatchpoints();
+    machine->execute();
+    BOOST_REQUIRE(machine->hits.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BusMemoryPagesTest) {
+    using zemux::Bus;
+    using zemux::MemoryDevice;
+    using zemux::Z80ChipMemoryPages;
+
+    auto machine = std::make_unique<BusTestMachine>();
+    auto& bus = machine->bus;
+
+    // Only changed pages are updated, so the result must be the same as after the full update.
+    auto requireUpdated = [&bus]() {
+        Z80ChipMemoryPages pages = bus.getMemoryPages();
+        bus.updateMemoryPages();
+        auto& updatedPages = bus.getMemoryPages();
+
+        for (int page = 0; page < Z80ChipMemoryPages::PAGES; ++page) {
+            BOOST_REQUIRE(pages.mreqRd[page] == updatedPages.mreqRd[page]);
+            BOOST_REQUIRE(pages.mreqM1[page] == updatedPages.mreqM1[page]);
+            BOOST_REQUIRE(pages.mreqWr[page] == updatedPages.mreqWr[page]);
+        }
+    };
+
+    machine->memoryDevice.onEvent(MemoryDevice::EventSetMode, zemux::EventInput { .value = MemoryDevice::Mode128 });
+    requireUpdated();
+
+    for (int value = 0; value < MemoryDevice::BIT_LOCK; ++value) {
+        bus.onCpuIorqWr(MemoryDevice::PORT_7FFD, static_cast<uint8_t>(value));
+        requireUpdated();
+    }
+
+    auto micros = measureMicros(RECONFIGURE_DEVICE_ITERATIONS, [&bus](int i) {
+        bus.onCpuIorqWr(MemoryDevice::PORT_7FFD, static_cast<uint8_t>(i & MemoryDevice::MASK_BANK_128));
+    });
+
+    BOOST_TEST_MESSAGE("Remap takes " << micros << " us");
+
+    machine->trDosDevice.onEvent(zemux::TrDosDevice::EventResetToTrDos, zemux::EventInput {});
+    BOOST_REQUIRE_EQUAL(bus.getState().mreqRdLayer, Bus::OVERLAY_MREQ_RD_TRDOS);
+    requireUpdated();
+
+    // Opcode fetch from RAM leaves TR-DOS.
+    bus.onCpuMreqRd(PROGRAM_ADDRESS, true);
+    BOOST_REQUIRE_EQUAL(bus.getState().mreqRdLayer, 0);
+    requireUpdated();
+
+    machine->debuggerDevice.setEnabled(true);
+    requireUpdated();
+    machine->profilerDevice.setEnabled(true);
+    requireUpdated();
+    machine->debuggerDevice.setEnabled(false);
+    requireUpdated();
+    machine->profilerDevice.setEnabled(false);
+    requireUpdated();
+}
+
+BOOST_AUTO_TEST_CASE(BusDeferredReconfigureTest) {
+    using zemux::Bus;
+    using zemux::DebuggerDevice;
+
+    auto machine = std::make_unique<BusTestMachine>();
+    auto& bus = machine->bus;
+    auto& debugger = machine->debuggerDevice;
+    machine->load();
+    debugger.setEnabled(true);
+
+    BOOST_TEST_MESSAGE("Deferred mode");
+    bus.setReconfigureMode(Bus::ReconfigureDeferred);
+    auto image = bus.getDecodeImage();
+    debugger.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    BOOST_REQUIRE(bus.isReconfigurePending());
+    BOOST_REQUIRE_EQUAL(bus.getDecodeImage(), image);
+
+    // Maps are swapped at the first opcode fetch.
+    machine->execute();
+    BOOST_REQUIRE(!bus.isReconfigurePending());
+    BOOST_REQUIRE_NE(bus.getDecodeImage(), image);
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 3u);
+    requireHit(machine->hits[0], DebuggerDevice::WatchExec, EXEC_ADDRESS, 0x3A);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS, DATA_VALUE);
+    requireHit(machine->hits[2], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+
+    BOOST_TEST_MESSAGE("Several changes before the instruction boundary");
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 2u);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+
+    BOOST_TEST_MESSAGE("Background mode");
+    bus.setReconfigureMode(Bus::ReconfigureBackground);
+    image = bus.getDecodeImage();
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    BOOST_REQUIRE(bus.isReconfigurePending());
+
+    // Opcode fetch doesn't wait for the worker, current maps stay active until the next deadline.
+    machine->execute();
+    BOOST_REQUIRE(bus.isReconfigurePending());
+    BOOST_REQUIRE_EQUAL(bus.getDecodeImage(), image);
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 2u);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+
+    bus.onMachineDeadline();
+    BOOST_REQUIRE(!bus.isReconfigurePending());
+    BOOST_REQUIRE_NE(bus.getDecodeImage(), image);
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 1u);
+    requireHit(machine->hits[0], DebuggerDevice::WatchExec, EXEC_ADDRESS, 0x3A);
+
+    BOOST_TEST_MESSAGE("Several changes before the deadline");
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    bus.onMachineDeadline();
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 2u);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS, DATA_VALUE);
+
+    BOOST_TEST_MESSAGE("Background full reconfiguration");
+    debugger.removeWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    machine->onBusReconfigure();
+    bus.flushReconfigure();
+    BOOST_REQUIRE(!bus.isReconfigurePending());
+    machine->execute();
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 2u);
+    requireHit(machine->hits[1], DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS, DATA_VALUE);
+
+    BOOST_TEST_MESSAGE("Pending build on destruction");
+    debugger.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    BOOST_REQUIRE(bus.isReconfigurePending());
+}
+
+BOOST_AUTO_TEST_CASE(BusProfilerTest) {
+    using zemux::Bus;
+    using zemux::DebuggerDevice;
+    using zemux::ProfilerDevice;
+
+    auto machine = std::make_unique<BusTestMachine>();
+    auto& profiler = machine->profilerDevice;
+    auto& profile = profiler.getFrameProfile();
+    auto page = PROGRAM_ADDRESS >> ProfilerDevice::PAGE_BITS;
+    machine->load();
+
+    BOOST_TEST_MESSAGE("Disabled profiler");
+    machine->execute();
+    profiler.onFrameFinished(0);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[0][page], 0u);
+    BOOST_REQUIRE(profile.iorqRdPorts.empty());
+
+    BOOST_TEST_MESSAGE("Enabled profiler");
+    profiler.setEnabled(true);
+    machine->execute();
+    profiler.onFrameFinished(0);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[0][page], static_cast<uint32_t>(PROGRAM_STEPS));
+    BOOST_REQUIRE_EQUAL(profile.mreqRd[0][page], PROGRAM_MREQ_RD);
+    BOOST_REQUIRE_EQUAL(profile.mreqWr[0][page], 1u);
+    BOOST_REQUIRE_EQUAL(profile.iorqRd[0], 1u);
+    BOOST_REQUIRE_EQUAL(profile.iorqWr[0], 1u);
+    BOOST_REQUIRE_EQUAL(profile.iorqRdPorts[DATA_PORT], 1u);
+    BOOST_REQUIRE_EQUAL(profile.iorqWrPorts[DATA_PORT], 1u);
+
+    BOOST_TEST_MESSAGE("Enabled debugger");
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    machine->debuggerDevice.setEnabled(true);
+    machine->execute();
+    profiler.onFrameFinished(0);
+    BOOST_REQUIRE_EQUAL(machine->hits.size(), 1u);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[0][page], 0u);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[Bus::OVERLAY_MREQ_RD_DEBUGGER][page], static_cast<uint32_t>(PROGRAM_STEPS));
+    BOOST_REQUIRE_EQUAL(profile.iorqWr[Bus::OVERLAY_IORQ_WR_DEBUGGER], 1u);
+
+    BOOST_TEST_MESSAGE("Empty frame");
+    profiler.onFrameFinished(0);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[Bus::OVERLAY_MREQ_RD_DEBUGGER][page], 0u);
+    BOOST_REQUIRE_EQUAL(profile.iorqWrPorts[DATA_PORT], 0u);
+
+    BOOST_TEST_MESSAGE("Reset bus");
+    machine->onBusReset();
+    BOOST_REQUIRE(profiler.isEnabled());
+    machine->execute();
+    profiler.onFrameFinished(0);
+    BOOST_REQUIRE_EQUAL(profile.mreqM1[Bus::OVERLAY_MREQ_RD_DEBUGGER][page], static_cast<uint32_t>(PROGRAM_STEPS));
+
+    BOOST_TEST_MESSAGE("Machine");
+    auto realMachine = std::make_unique<zemux::Machine>();
+    realMachine->emitEvent(ProfilerDevice::EventSetEnabled, zemux::EventInput { .value = 1 });
+    BOOST_REQUIRE(realMachine->emitEvent(ProfilerDevice::EventIsEnabled, zemux::EventInput {}).value);
+
+    // Every step is either the instruction or the prefix, so it starts with the single opcode fetch.
+    // CPU is stepped past the end of the frame, so the frame itself doesn't run it any further.
+    uint32_t machineSteps = 0;
+
+    while (machineSteps < MACHINE_STEPS
+            || realMachine->cpuChronometer.getSrcTicksPassed() < realMachine->getFrameTicks()) {
+
+        realMachine->cpuChronometer.dstAdvanceBy(realMachine->cpu.step());
+        ++machineSteps;
+    }
+
+    realMachine->renderFrame();
+
+    const ProfilerDevice::Profile* machineProfile = nullptr;
+    auto output = realMachine->emitEvent(ProfilerDevice::EventGetFrameProfile, { .pointer = &machineProfile });
+    BOOST_REQUIRE(output.isHandled);
+
+    uint32_t m1Fetches = 0;
+
+    for (auto& counters : machineProfile->mreqM1) {
+        for (auto counter : counters) {
+            m1Fetches += counter;
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(m1Fetches, machineSteps);
+
+    BOOST_TEST_MESSAGE("Disabled machine profiler");
+    realMachine->emitEvent(ProfilerDevice::EventSetEnabled, zemux::EventInput { .value = 0 });
+    BOOST_REQUIRE(machineProfile->iorqRdPorts.empty());
+    BOOST_REQUIRE(machineProfile->iorqWrPorts.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BusReconfigureTest) {
+    using zemux::DebuggerDevice;
+    using zemux::ZxmDevice;
+
+    auto machine = std::make_unique<BusReconfigureTestMachine>();
+    auto ethalon = std::make_unique<BusReconfigureTestMachine>();
+
+    // Otherwise both machines would end up with the same image.
+    machine->bus.setDecodeImageShared(false);
+    ethalon->bus.setDecodeImageShared(false);
+
+    machine->setZxmMode(ZxmDevice::ModeZxm);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, 0x3D2F);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqRd, zemux::TrDosDevice::PORT_DATA);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, zemux::ZxmDevice::PORT_00FF);
+    machine->debuggerDevice.removeWatchpoint(DebuggerDevice::WatchMreqRd, DATA_RD_ADDRESS);
+
+    ethalon->setZxmMode(ZxmDevice::ModeZxm);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, 0x3D2F);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchMreqWr, DATA_WR_ADDRESS);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqRd, zemux::TrDosDevice::PORT_DATA);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, zemux::ZxmDevice::PORT_00FF);
+    ethalon->onBusReconfigure();
+
+    BOOST_TEST_MESSAGE("Reconfigured devices");
+    BOOST_REQUIRE_EQUAL(machine->countMapDifferences(*ethalon), 0);
+
+    BOOST_TEST_MESSAGE("Reverted devices");
+    machine->setZxmMode(ZxmDevice::ModeAy);
+    machine->debuggerDevice.removeAllWatchpoints();
+    ethalon->setZxmMode(ZxmDevice::ModeAy);
+    ethalon->debuggerDevice.removeAllWatchpoints();
+    ethalon->onBusReconfigure();
+    BOOST_REQUIRE_EQUAL(machine->countMapDifferences(*ethalon), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BusReconfigureSpeedTest) {
+    using zemux::DebuggerDevice;
+    using zemux::ZxmDevice;
+
+    auto machine = std::make_unique<BusReconfigureTestMachine>();
+
+    auto sharedTime = measureMicros(RECONFIGURE_FULL_ITERATIONS, [&machine](int) {
+        machine->onBusReconfigure();
+    });
+
+    BOOST_TEST_MESSAGE("Full reconfiguration with the shared image takes " << sharedTime << " us");
+
+    // Image is built only when it is not shared.
+    machine->bus.setDecodeImageShared(false);
+
+    auto fullTime = measureMicros(RECONFIGURE_FULL_ITERATIONS, [&machine](int) {
+        machine->onBusReconfigure();
+    });
+
+    BOOST_TEST_MESSAGE("Full reconfiguration takes " << fullTime << " us");
+
+    auto zxmTime = measureMicros(RECONFIGURE_DEVICE_ITERATIONS, [&machine](int iteration) {
+        machine->setZxmMode((iteration & 1) ? ZxmDevice::ModeAy : ZxmDevice::ModeZxm);
+    });
+
+    BOOST_TEST_MESSAGE("ZXM mode change takes " << zxmTime << " us");
+
+    auto watchpointTime = measureMicros(RECONFIGURE_DEVICE_ITERATIONS, [&machine](int iteration) {
+        auto address = static_cast<uint16_t>(iteration >> 1);
+
+        if (iteration & 1) {
+            machine->debuggerDevice.removeWatchpoint(DebuggerDevice::WatchExec, address);
+        } else {
+            machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, address);
+        }
+    });
+
+    BOOST_TEST_MESSAGE("Exec watchpoint change takes " << watchpointTime << " us");
+
+    // Spare image is one change behind, so every change is applied twice.
+    machine->bus.setReconfigureMode(zemux::Bus::ReconfigureDeferred);
+
+    auto deferredTime = measureMicros(RECONFIGURE_DEVICE_ITERATIONS, [&machine](int iteration) {
+        auto address = static_cast<uint16_t>(iteration >> 1);
+
+        if (iteration & 1) {
+            machine->debuggerDevice.removeWatchpoint(DebuggerDevice::WatchExec, address);
+        } else {
+            machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, address);
+        }
+
+        machine->bus.flushReconfigure();
+    });
+
+    BOOST_TEST_MESSAGE("Deferred exec watchpoint change takes " << deferredTime << " us");
+
+    // Only the caller side is measured, maps are built by the worker meanwhile.
+    machine->bus.setReconfigureMode(zemux::Bus::ReconfigureBackground);
+
+    auto backgroundTime = measureMicros(RECONFIGURE_DEVICE_ITERATIONS, [&machine](int iteration) {
+        auto address = static_cast<uint16_t>(iteration >> 1);
+
+        if (iteration & 1) {
+            machine->debuggerDevice.removeWatchpoint(DebuggerDevice::WatchExec, address);
+        } else {
+            machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, address);
+        }
+    });
+
+    machine->bus.flushReconfigure();
+    BOOST_TEST_MESSAGE("Background exec watchpoint change takes " << backgroundTime << " us in the caller");
+
+    BOOST_CHECK_LT(zxmTime, fullTime);
+    BOOST_CHECK_LT(watchpointTime, fullTime);
+    BOOST_CHECK_LT(deferredTime, fullTime);
+    BOOST_CHECK_LT(backgroundTime, fullTime);
+}
+
+BOOST_AUTO_TEST_CASE(BusIorqDecoderTest) {
+    using zemux::Bus;
+    using zemux::DebuggerDevice;
+    using zemux::ZxmDevice;
+
+    auto machine = std::make_unique<BusReconfigureTestMachine>();
+    auto mapsMachine = std::make_unique<BusReconfigureTestMachine>();
+    machine->bus.setDecodeImageShared(false);
+    mapsMachine->bus.setDecodeImageShared(false);
+    mapsMachine->bus.setIorqDecoder(zemux::BusDecodeImage::IorqDecoderMaps);
+
+    BOOST_TEST_MESSAGE("Default devices");
+    BOOST_REQUIRE_EQUAL(machine->bus.getIorqDecoder(), zemux::BusDecodeImage::IorqDecoderRules);
+    BOOST_REQUIRE_EQUAL(machine->countMapDifferences(*mapsMachine), 0);
+
+    BOOST_TEST_MESSAGE("Reconfigured devices");
+    machine->setZxmMode(ZxmDevice::ModeZxm);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqRd, zemux::TrDosDevice::PORT_DATA);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, zemux::ZxmDevice::PORT_00FF);
+    machine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, DATA_PORT);
+    mapsMachine->setZxmMode(ZxmDevice::ModeZxm);
+    mapsMachine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqRd, zemux::TrDosDevice::PORT_DATA);
+    mapsMachine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, zemux::ZxmDevice::PORT_00FF);
+    mapsMachine->debuggerDevice.addWatchpoint(DebuggerDevice::WatchIorqWr, DATA_PORT);
+    BOOST_REQUIRE_EQUAL(machine->countMapDifferences(*mapsMachine), 0);
+
+    BOOST_TEST_MESSAGE("Switched decoders");
+    machine->bus.setIorqDecoder(zemux::BusDecodeImage::IorqDecoderMaps);
+    mapsMachine->bus.setIorqDecoder(zemux::BusDecodeImage::IorqDecoderRules);
+    BOOST_REQUIRE_EQUAL(machine->countMapDifferences(*mapsMachine), 0);
+
+    static const uint16_t ports[] = { 0x00FE, 0x7FFE, 0x7FFD, 0xFFFD, 0xBFFD, 0x001F, 0x00FB, 0xFADF, 0xEFF7 };
+    uintptr_t sink = 0;
+
+    auto measureDecode = [&sink](Bus& bus) {
+        return measureMicros(DECODE_ITERATIONS, [&bus, &sink](int iteration) {
+            auto port = ports[iteration % (sizeof(ports) / sizeof(ports[0]))];
+            sink += reinterpret_cast<uintptr_t>(bus.getIorqRdElement(0, port).callback);
+        }) * 1000.0;
+    };
+
+    BOOST_TEST_MESSAGE("Maps decoder takes " << measureDecode(machine->bus) << " ns per port");
+    BOOST_TEST_MESSAGE("Rules decoder takes " << measureDecode(mapsMachine->bus) << " ns per port");
+    BOOST_REQUIRE_NE(sink, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(BusDecodeImageTest) {
+    using zemux::DebuggerDevice;
+
+    std::vector<std::unique_ptr<BusReconfigureTestMachine>> machines;
+
+    for (int i = 0; i < DECODE_IMAGE_MACHINES; ++i) {
+        machines.push_back(std::make_unique<BusReconfigureTestMachine>());
+    }
+
+    auto ethalon = std::make_unique<BusReconfigureTestMachine>();
+    ethalon->bus.setDecodeImageShared(false);
+    ethalon->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+
+    BOOST_TEST_MESSAGE("Same configuration");
+
+    for (auto& machine : machines) {
+        BOOST_REQUIRE_EQUAL(machine->bus.getDecodeImage(), machines[0]->bus.getDecodeImage());
+    }
+
+    BOOST_TEST_MESSAGE("Bus takes " << sizeof(zemux::Bus) << " bytes, shared image takes "
+            << sizeof(zemux::BusDecodeImage) << " bytes (without pages)");
+
+    BOOST_TEST_MESSAGE("Changed configuration");
+    machines[0]->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    BOOST_REQUIRE_NE(machines[0]->bus.getDecodeImage(), machines[1]->bus.getDecodeImage());
+    BOOST_REQUIRE_EQUAL(machines[1]->bus.getDecodeImage(), machines[2]->bus.getDecodeImage());
+    BOOST_REQUIRE_EQUAL(machines[0]->countMapDifferences(*ethalon), 0);
+    BOOST_REQUIRE_GT(machines[1]->countMapDifferences(*ethalon), 0);
+
+    BOOST_TEST_MESSAGE("Changed configuration of another machine");
+    machines[1]->debuggerDevice.addWatchpoint(DebuggerDevice::WatchExec, EXEC_ADDRESS);
+    BOOST_REQUIRE_EQUAL(machines[1]->bus.getDecodeImage(), machines[0]->bus.getDecodeImage());
+    BOOST_REQUIRE_EQUAL(machines[1]->countMapDifferences(*ethalon), 0);
+
+    BOOST_TEST_MESSAGE("Reverted configuration");
+    machines[0]->debuggerDevice.removeAllWatchpoints();
+    machines[1]->debuggerDevice.removeAllWatchpoints();
+
+    for (auto& machine : machines) {
+        BOOST_REQUIRE_EQUAL(machine->bus.getDecodeImage(), machines[0]->bus.getDecodeImage());
+    }
+
+    BOOST_TEST_MESSAGE("Reconfigured machine");
+    machines[0]->onBusReconfigure();
+    BOOST_REQUIRE_EQUAL(machines[0]->bus.getDecodeImage(), machines[1]->bus.getDecodeImage());
+}
+
+#pragma clang diagnostic pop
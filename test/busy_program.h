@@ -0,0 +1,50 @@
+#ifndef ZEMUX_TEST__BUSY_PROGRAM
+#define ZEMUX_TEST__BUSY_PROGRAM
+
+#include <cstdint>
+#include <memory>
+#include <zemux_machine/machine.h>
+#include <zemux_machine/devices/memory_device.h>
+
+static constexpr uint16_t BUSY_PROGRAM_ADDRESS = 0x8000;
+static constexpr uint16_t BUSY_BANK_ADDRESS = 0x9000;
+
+// Never halts, fills the screen and the whole upper 16K with the counter, switching 128K banks on every pass.
+// About 14 RAM pages are written during every frame.
+inline void loadBusyProgram(zemux::Machine& machine) {
+    static const uint8_t program[] = {
+            0xF3, // DI
+            0x3A, BUSY_BANK_ADDRESS & 0xFF, BUSY_BANK_ADDRESS >> 8, // LD A,(BUSY_BANK_ADDRESS)
+            0x3C, // INC A
+            0x32, BUSY_BANK_ADDRESS & 0xFF, BUSY_BANK_ADDRESS >> 8, // LD (BUSY_BANK_ADDRESS),A
+            0xE6, 0x07, // AND 7
+            0x01, 0xFD, 0x7F, // LD BC,#7FFD
+            0xED, 0x79, // OUT (C),A
+            0x21, 0x00, 0x40, // LD HL,#4000
+            0x77, // LD (HL),A
+            0x11, 0x01, 0x40, // LD DE,#4001
+            0x01, 0xFF, 0x1A, // LD BC,#1AFF
+            0xED, 0xB0, // LDIR
+            0x21, 0x00, 0xC0, // LD HL,#C000
+            0x77, // LD (HL),A
+            0x11, 0x01, 0xC0, // LD DE,#C001
+            0x01, 0xFF, 0x3F, // LD BC,#3FFF
+            0xED, 0xB0, // LDIR
+            0x18, 0xD8, // JR BUSY_PROGRAM_ADDRESS+1
+    };
+
+    for (uint16_t i = 0; i < sizeof(program); ++i) {
+        machine.bus.onCpuMreqWr(BUSY_PROGRAM_ADDRESS + i, program[i]);
+    }
+
+    machine.bus.onCpuMreqWr(BUSY_BANK_ADDRESS, 0);
+    machine.cpu.regs.PC = BUSY_PROGRAM_ADDRESS;
+}
+
+// RAM is not initialized by the machine, so its content depends on the previous allocations.
+inline void clearRam(zemux::Machine& machine) {
+    auto ram = std::make_unique<uint8_t[]>(zemux::MemoryDevice::SIZE_RAM);
+    machine.bus.memoryDevice->copyRamFrom(ram.get());
+}
+
+#endif
@@ -0,0 +1,628 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <zemux_machine/machine.h>
+#include <zemux_machine/host.h>
+#include <zemux_machine/machine_farm.h>
+#include <zemux_machine/machine_rewind.h>
+#include <zemux_machine/devices/extport_device.h>
+#include <zemux_machine/devices/memory_device.h>
+#include <zemux_machine/devices/profiler_device.h>
+#include <zemux_machine/devices/zxm_device.h>
+#include "busy_program.h"
+
+static constexpr uint16_t PROGRAM_ADDRESS = 0x8000;
+static constexpr uint16_t HANDLER_ADDRESS = 0x9000;
+static constexpr uint16_t COUNTER_ADDRESS = 0xA000;
+static constexpr uint8_t VECTOR_REGISTER = 0x81;
+static constexpr int FRAMES = 50;
+static constexpr uint32_t MAX_FRAME_OVERSHOOT_TICKS = 64;
+static constexpr unsigned int FARM_THREADS = 4;
+static constexpr size_t FARM_MACHINES = 10;
+static constexpr size_t REWIND_BUDGET = 1536 * 1024;
+static constexpr int REWIND_KEYFRAME_INTERVAL = 10;
+static constexpr int REWIND_FRAMES = 500;
+static constexpr int RUN_AHEAD_FRAMES = 2;
+static constexpr size_t FORK_MACHINES = 100;
+static constexpr unsigned int TRACE_CAPACITY = 64;
+static constexpr uint16_t CODE_ADDRESS = 0x0100;
+static constexpr uint16_t NMI_RETURN_ADDRESS = 0x0600;
+static constexpr uint_fast32_t CODE_TSTATES = 1000;
+
+// IM 2 interrupt handler increments the counter, main program halts forever.
+static void loadProgram(zemux::Machine& machine) {
+    static const uint8_t program[] = {
+            0xED, 0x5E, // IM 2
+            0x3E, VECTOR_REGISTER, // LD A,VECTOR_REGISTER
+            0xED, 0x47, // LD I,A
+            0xFB, // EI
+            0x76, // HALT
+            0x18, 0xFD, // JR $-1
+    };
+
+    static const uint8_t handler[] = {
+            0x21, COUNTER_ADDRESS & 0xFF, COUNTER_ADDRESS >> 8, // LD HL,COUNTER_ADDRESS
+            0x34, // INC (HL)
+            0xFB, // EI
+            0xED, 0x4D, // RETI
+    };
+
+    for (uint16_t i = 0; i < sizeof(program); ++i) {
+        machine.bus.onCpuMreqWr(PROGRAM_ADDRESS + i, program[i]);
+    }
+
+    for (uint16_t i = 0; i < sizeof(handler); ++i) {
+        machine.bus.onCpuMreqWr(HANDLER_ADDRESS + i, handler[i]);
+    }
+
+    // Data bus is #FF during the interrupt acknowledge.
+    uint16_t vectorAddress = (VECTOR_REGISTER << 8) | 0xFF;
+    machine.bus.onCpuMreqWr(vectorAddress, HANDLER_ADDRESS & 0xFF);
+    machine.bus.onCpuMreqWr(vectorAddress + 1, HANDLER_ADDRESS >> 8);
+    machine.bus.onCpuMreqWr(COUNTER_ADDRESS, 0);
+
+    machine.cpu.regs.PC = PROGRAM_ADDRESS;
+}
+
+static uint64_t hashRam(zemux::Machine& machine) {
+    uint64_t result = 14695981039346656037ULL;
+
+    for (int page = 0; page < zemux::MemoryDevice::PAGES_RAM; ++page) {
+        const uint8_t* ram = machine.bus.memoryDevice->getRamPage(page);
+
+        for (int i = 0; i < zemux::MemoryDevice::PAGE_SIZE; ++i) {
+            result = (result ^ ram[i]) * 1099511628211ULL;
+        }
+    }
+
+    return result;
+}
+
+// Takes the counter from the run-ahead frame, when it is presented.
+class RunAheadHost final : public zemux::EventEmitter {
+public:
+
+    zemux::Machine* machine;
+    int presentedFrames = 0;
+    uint8_t presentedCounter = 0;
+
+    explicit RunAheadHost(zemux::Machine* machine) : machine { machine } {
+    }
+
+    zemux::EventOutput emitEvent(uint32_t event, zemux::EventInput /* input */) override {
+        if (event != zemux::Host::EventRunAheadFrame) {
+            return zemux::EventOutput {};
+        }
+
+        ++presentedFrames;
+        presentedCounter = machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false);
+        return zemux::EventOutput { .isHandled = true };
+    }
+};
+
+static void onTraceTrigger(void* data, const zemux::Z80ChipTrace& /* trace */) {
+    ++*static_cast<int*>(data);
+}
+
+static uint32_t countM1Fetches(const zemux::ProfilerDevice::Profile& profile) {
+    uint32_t result = 0;
+
+    for (auto& counters : profile.mreqM1) {
+        for (auto counter : counters) {
+            result += counter;
+        }
+    }
+
+    return result;
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "cert-err58-cpp"
+
+BOOST_AUTO_TEST_CASE(MachineInterruptTest) {
+    auto machine = std::make_unique<zemux::Machine>();
+    loadProgram(*machine);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+        BOOST_REQUIRE_LT(machine->cpuChronometer.getSrcTicksPassed(), MAX_FRAME_OVERSHOOT_TICKS);
+    }
+
+    // Interrupt is accepted exactly once per frame, except the first one (it is over before EI is executed).
+    BOOST_REQUIRE_EQUAL(machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false), FRAMES - 1);
+}
+
+BOOST_AUTO_TEST_CASE(MachineTraceTest) {
+    auto machine = std::make_unique<zemux::Machine>();
+    zemux::Z80ChipTrace trace { TRACE_CAPACITY };
+    int handlerCalls = 0;
+
+    loadProgram(*machine);
+    trace.setTrigger(HANDLER_ADDRESS, onTraceTrigger, &handlerCalls);
+    machine->cpu.setTrace(&trace);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+    }
+
+    machine->cpu.setTrace(nullptr);
+
+    // Interrupts are traced as well, and HALT is traced on every M1 cycle.
+    BOOST_REQUIRE_EQUAL(handlerCalls, FRAMES - 1);
+    BOOST_REQUIRE_EQUAL(machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false), FRAMES - 1);
+    BOOST_REQUIRE_EQUAL(trace.getSize(), TRACE_CAPACITY);
+
+    const auto& lastEntry = trace.getEntry(trace.getSize() - 1);
+    BOOST_REQUIRE_EQUAL(lastEntry.opcode, 0x76);
+    BOOST_REQUIRE_EQUAL(lastEntry.tstate + 4 - trace.getEntry(0).tstate, TRACE_CAPACITY * 4);
+}
+
+BOOST_AUTO_TEST_CASE(MachineTimingsTest) {
+    using zemux::Machine;
+    using zemux::PentagonTimings;
+    using zemux::ScorpionTimings;
+    using zemux::Spectrum48Timings;
+    using zemux::Spectrum128Timings;
+
+    static const std::tuple<Machine::TimingsKind, uint32_t, uint32_t> timingsTable[] = {
+            { Machine::TimingsPentagon, PentagonTimings::FRAME_TICKS, PentagonTimings::INT_BEGIN_TICKS },
+            { Machine::TimingsScorpion, ScorpionTimings::FRAME_TICKS, ScorpionTimings::INT_BEGIN_TICKS },
+            { Machine::TimingsSpectrum48, Spectrum48Timings::FRAME_TICKS, Spectrum48Timings::INT_BEGIN_TICKS },
+            { Machine::TimingsSpectrum128, Spectrum128Timings::FRAME_TICKS, Spectrum128Timings::INT_BEGIN_TICKS },
+    };
+
+    BOOST_REQUIRE_EQUAL(PentagonTimings::FRAME_TICKS, 71680u);
+    BOOST_REQUIRE_EQUAL(ScorpionTimings::INT_BEGIN_TICKS, ScorpionTimings::VBLANK_TICKS);
+
+    for (auto& [timingsKind, frameTicks, intBeginTicks] : timingsTable) {
+        BOOST_TEST_MESSAGE("Timings " << timingsKind);
+
+        auto machine = std::make_unique<Machine>(timingsKind);
+        loadProgram(*machine);
+
+        BOOST_REQUIRE_EQUAL(machine->getTimingsKind(), timingsKind);
+        BOOST_REQUIRE_EQUAL(machine->getFrameTicks(), frameTicks);
+
+        for (int i = 0; i < FRAMES; ++i) {
+            machine->renderFrame();
+            BOOST_REQUIRE_LT(machine->cpuChronometer.getSrcTicksPassed(), MAX_FRAME_OVERSHOOT_TICKS);
+        }
+
+        // INT at the very beginning of the first frame is missed, the later one is not.
+        int expectedInts = intBeginTicks ? FRAMES : FRAMES - 1;
+        BOOST_REQUIRE_EQUAL(machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false), expectedInts);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MachineScheduledEventTest) {
+    using zemux::ProfilerDevice;
+
+    auto machine = std::make_unique<zemux::Machine>();
+    loadProgram(*machine);
+
+    BOOST_TEST_MESSAGE("Event in the middle of the frame");
+    machine->scheduleEvent(machine->getFrameTicks() / 2, ProfilerDevice::EventSetEnabled, { .value = 1 });
+    BOOST_REQUIRE(!machine->emitEvent(ProfilerDevice::EventIsEnabled, {}).value);
+    machine->renderFrame();
+    BOOST_REQUIRE(machine->emitEvent(ProfilerDevice::EventIsEnabled, {}).value);
+
+    const ProfilerDevice::Profile* frameProfile = nullptr;
+    machine->emitEvent(ProfilerDevice::EventGetFrameProfile, { .pointer = &frameProfile });
+    auto halfFrameFetches = countM1Fetches(*frameProfile);
+
+    BOOST_TEST_MESSAGE("Full frame");
+    machine->renderFrame();
+    auto fullFrameFetches = countM1Fetches(*frameProfile);
+
+    BOOST_REQUIRE_GT(halfFrameFetches, 0u);
+    BOOST_REQUIRE_LT(halfFrameFetches, fullFrameFetches);
+
+    BOOST_TEST_MESSAGE("Event in the next frame");
+    machine->scheduleEvent(machine->getFrameTicks() * 3 / 2, ProfilerDevice::EventSetEnabled, { .value = 0 });
+    machine->renderFrame();
+    BOOST_REQUIRE(machine->emitEvent(ProfilerDevice::EventIsEnabled, {}).value);
+    machine->renderFrame();
+    BOOST_REQUIRE(!machine->emitEvent(ProfilerDevice::EventIsEnabled, {}).value);
+}
+
+BOOST_AUTO_TEST_CASE(MachineFarmTest) {
+    using zemux::ZxmDevice;
+
+    zemux::MachineFarm farm { FARM_THREADS };
+    BOOST_REQUIRE_EQUAL(farm.getThreadsCount(), FARM_THREADS);
+
+    // Every sound chip is turned on, so vendor chips are emulated in parallel too.
+    farm.createMachines(FARM_MACHINES, [](size_t /* index */) -> std::unique_ptr<zemux::Machine> {
+        auto machine = std::make_unique<zemux::Machine>();
+        loadProgram(*machine);
+
+        ZxmDevice::Configuration config {};
+        config.updateMask = ZxmDevice::Configuration::UpdateMode;
+        config.mode = ZxmDevice::ModeZxm;
+        machine->emitEvent(ZxmDevice::EventSetConfiguration, { .pointer = &config });
+
+        return machine;
+    });
+
+    BOOST_REQUIRE_EQUAL(farm.getMachinesCount(), FARM_MACHINES);
+
+    std::atomic<uint64_t> callbackCalls { 0 };
+
+    auto stats = farm.runFrames(FRAMES, [&](zemux::Machine& /* machine */, size_t /* index */) {
+        ++callbackCalls;
+    });
+
+    BOOST_TEST_MESSAGE("Farm: " << stats.getFramesPerSecond() << " frames/s, " << stats.steals << " steals");
+    BOOST_REQUIRE_EQUAL(stats.frames, static_cast<uint64_t>(FRAMES) * FARM_MACHINES);
+    BOOST_REQUIRE_EQUAL(callbackCalls, stats.frames);
+
+    // Machines are independent, so every one of them must be in the same state as the single machine.
+    auto reference = std::make_unique<zemux::Machine>();
+    loadProgram(*reference);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        reference->renderFrame();
+    }
+
+    for (size_t i = 0; i < farm.getMachinesCount(); ++i) {
+        auto& machine = farm.getMachine(i);
+
+        BOOST_REQUIRE_EQUAL(machine.bus.onCpuMreqRd(COUNTER_ADDRESS, false), FRAMES - 1);
+        BOOST_REQUIRE_EQUAL(machine.cpu.regs.PC, reference->cpu.regs.PC);
+        BOOST_REQUIRE_EQUAL(machine.cpuChronometer.getSrcTicksPassed(), reference->cpuChronometer.getSrcTicksPassed());
+    }
+
+    BOOST_TEST_MESSAGE("Pinned workers");
+    zemux::MachineFarm pinnedFarm { FARM_THREADS, true };
+
+    pinnedFarm.createMachines(FARM_THREADS, [](size_t /* index */) -> std::unique_ptr<zemux::Machine> {
+        auto machine = std::make_unique<zemux::Machine>();
+        loadProgram(*machine);
+        return machine;
+    });
+
+    BOOST_REQUIRE_EQUAL(pinnedFarm.runFrames(FRAMES).frames, static_cast<uint64_t>(FRAMES) * FARM_THREADS);
+
+    BOOST_TEST_MESSAGE("Exception is passed to the caller");
+    bool isThrown = false;
+
+    try {
+        farm.runFrames(FRAMES, [](zemux::Machine& /* machine */, size_t index) {
+            if (index == FARM_MACHINES / 2) {
+                throw std::runtime_error("Expected");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        isThrown = true;
+    }
+
+    BOOST_REQUIRE(isThrown);
+}
+
+BOOST_AUTO_TEST_CASE(MachineSnapshotTest) {
+    using zemux::MemoryDevice;
+
+    auto machine = std::make_unique<zemux::Machine>();
+    loadProgram(*machine);
+
+    auto snapshot = std::make_unique<zemux::MachineSnapshot>();
+    BOOST_REQUIRE(snapshot->isEmpty());
+
+    // The first save copies the whole RAM, next ones only pages written since (counter and stack).
+    BOOST_REQUIRE_EQUAL(machine->saveSnapshot(snapshot.get()), MemoryDevice::PAGES_RAM);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+    }
+
+    auto copiedPages = machine->saveSnapshot(snapshot.get());
+    BOOST_TEST_MESSAGE("Incremental save: " << copiedPages << " pages");
+    BOOST_REQUIRE_GT(copiedPages, 0);
+    BOOST_REQUIRE_LE(copiedPages, 4);
+    BOOST_REQUIRE_EQUAL(snapshot->getRam()[COUNTER_ADDRESS], FRAMES - 1);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+    }
+
+    auto expectedRegs = machine->cpu.regs;
+    auto expectedRam = std::make_unique<uint8_t[]>(zemux::MachineSnapshot::RAM_SIZE);
+    auto actualRam = std::make_unique<uint8_t[]>(zemux::MachineSnapshot::RAM_SIZE);
+    machine->bus.memoryDevice->copyRamTo(expectedRam.get());
+    BOOST_REQUIRE_EQUAL(machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false), FRAMES * 2 - 1);
+
+    auto otherMachine = std::make_unique<zemux::Machine>();
+
+    for (auto* target : { machine.get(), otherMachine.get() }) {
+        BOOST_TEST_MESSAGE((target == machine.get() ? "Same machine" : "Other machine"));
+
+        copiedPages = target->loadSnapshot(*snapshot);
+        BOOST_REQUIRE_GT(copiedPages, 0);
+
+        if (target == machine.get()) {
+            BOOST_REQUIRE_LE(copiedPages, 4);
+        }
+
+        BOOST_REQUIRE_EQUAL(target->bus.onCpuMreqRd(COUNTER_ADDRESS, false), FRAMES - 1);
+
+        for (int i = 0; i < FRAMES; ++i) {
+            target->renderFrame();
+        }
+
+        BOOST_REQUIRE_EQUAL(target->cpu.regs.PC, expectedRegs.PC);
+        BOOST_REQUIRE_EQUAL(target->cpu.regs.SP, expectedRegs.SP);
+        BOOST_REQUIRE_EQUAL(target->cpu.regs.AF, expectedRegs.AF);
+        BOOST_REQUIRE_EQUAL(target->cpu.regs.HL, expectedRegs.HL);
+        BOOST_REQUIRE_EQUAL(target->cpu.regs.IR, expectedRegs.IR);
+
+        target->bus.memoryDevice->copyRamTo(actualRam.get());
+        BOOST_REQUIRE(std::memcmp(actualRam.get(), expectedRam.get(), zemux::MachineSnapshot::RAM_SIZE) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MachineRewindTest) {
+    // Budget holds enough frames only when untouched RAM is zeroed.
+    auto machine = std::make_unique<zemux::Machine>();
+    clearRam(*machine);
+    loadBusyProgram(*machine);
+
+    bool isThrown = false;
+
+    try {
+        zemux::MachineRewind tooSmall { machine.get(), 1024 };
+    } catch (const std::invalid_argument&) {
+        isThrown = true;
+    }
+
+    BOOST_REQUIRE(isThrown);
+
+    zemux::MachineRewind rewind { machine.get(), REWIND_BUDGET, REWIND_KEYFRAME_INTERVAL };
+    std::vector<uint64_t> ramHashes;
+    std::vector<uint16_t> pcs;
+
+    for (int i = 0; i < REWIND_FRAMES; ++i) {
+        machine->renderFrame();
+        rewind.recordFrame();
+
+        ramHashes.push_back(hashRam(*machine));
+        pcs.push_back(machine->cpu.regs.PC);
+    }
+
+    BOOST_TEST_MESSAGE("Kept " << rewind.getFramesCount() << " frames in " << rewind.getUsedMemory() << " bytes");
+    BOOST_REQUIRE_LE(rewind.getUsedMemory(), REWIND_BUDGET);
+    BOOST_REQUIRE_GE(rewind.getFramesCount(), REWIND_KEYFRAME_INTERVAL);
+
+    // Oldest frames were evicted.
+    BOOST_REQUIRE_LT(rewind.getFramesCount(), REWIND_FRAMES);
+    BOOST_REQUIRE(!rewind.seek(rewind.getFramesCount()));
+
+    // Seek back to the latest frame, to the frame in the middle of the group, to the keyframe and to the oldest frame
+    // (negative value), then check that the machine continues exactly as it did before.
+    for (int framesBack : { 0, REWIND_KEYFRAME_INTERVAL / 2, REWIND_KEYFRAME_INTERVAL, -1 }) {
+        if (framesBack < 0) {
+            framesBack = rewind.getFramesCount() - 1;
+        }
+
+        BOOST_TEST_MESSAGE("Seek " << framesBack << " frames back");
+
+        auto frame = static_cast<int>(ramHashes.size()) - 1 - framesBack;
+        BOOST_REQUIRE(rewind.seek(framesBack));
+        BOOST_REQUIRE_EQUAL(hashRam(*machine), ramHashes[frame]);
+        BOOST_REQUIRE_EQUAL(machine->cpu.regs.PC, pcs[frame]);
+
+        ramHashes.resize(frame + 1);
+        pcs.resize(frame + 1);
+
+        machine->renderFrame();
+        rewind.recordFrame();
+        ramHashes.push_back(hashRam(*machine));
+        pcs.push_back(machine->cpu.regs.PC);
+
+        BOOST_REQUIRE(rewind.seek(1));
+        BOOST_REQUIRE_EQUAL(hashRam(*machine), ramHashes[frame]);
+
+        machine->renderFrame();
+        rewind.recordFrame();
+        BOOST_REQUIRE_EQUAL(hashRam(*machine), ramHashes[frame + 1]);
+        BOOST_REQUIRE_EQUAL(machine->cpu.regs.PC, pcs[frame + 1]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MachineRunAheadTest) {
+    auto machine = std::make_unique<zemux::Machine>();
+    auto reference = std::make_unique<zemux::Machine>();
+    loadProgram(*machine);
+    loadProgram(*reference);
+
+    RunAheadHost host { machine.get() };
+    machine->bus.hostEmitter = &host;
+    machine->setRunAheadFrames(RUN_AHEAD_FRAMES);
+
+    zemux::MachineFrameStats stats;
+    machine->setFrameStats(&stats);
+
+    // Snapshot is saved every frame, run-ahead must keep it incremental.
+    auto snapshot = std::make_unique<zemux::MachineSnapshot>();
+    machine->saveSnapshot(snapshot.get());
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+        reference->renderFrame();
+
+        auto counter = machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false);
+        BOOST_REQUIRE_EQUAL(counter, reference->bus.onCpuMreqRd(COUNTER_ADDRESS, false));
+        BOOST_REQUIRE_EQUAL(machine->cpu.regs.PC, reference->cpu.regs.PC);
+        BOOST_REQUIRE_EQUAL(machine->cpuChronometer.getSrcTicksPassed(), reference->cpuChronometer.getSrcTicksPassed());
+
+        // Interrupt handler increments the counter once per frame.
+        BOOST_REQUIRE_EQUAL(host.presentedFrames, i + 1);
+        BOOST_REQUIRE_EQUAL(host.presentedCounter, static_cast<uint8_t>(counter + RUN_AHEAD_FRAMES));
+
+        BOOST_REQUIRE_LE(machine->saveSnapshot(snapshot.get()), 4);
+    }
+
+    machine->setFrameStats(nullptr);
+
+    auto micros = std::chrono::duration<double, std::micro>(stats.runAheadTime).count() / FRAMES;
+    BOOST_TEST_MESSAGE("Run-ahead by " << RUN_AHEAD_FRAMES << " frames takes " << micros << " us per frame");
+
+    BOOST_REQUIRE_EQUAL(stats.frames, static_cast<uint64_t>(FRAMES));
+    BOOST_REQUIRE_EQUAL(stats.runAheadFrames, static_cast<uint64_t>(FRAMES) * RUN_AHEAD_FRAMES);
+
+    machine->setRunAheadFrames(0);
+    machine->renderFrame();
+    BOOST_REQUIRE_EQUAL(host.presentedFrames, FRAMES);
+
+    machine->bus.hostEmitter = nullptr;
+}
+
+BOOST_AUTO_TEST_CASE(MachineForkTest) {
+    using Clock = std::chrono::steady_clock;
+
+    auto machine = std::make_unique<zemux::Machine>();
+    loadBusyProgram(*machine);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        machine->renderFrame();
+    }
+
+    // Busy program doesn't touch the counter address, forks put their index there.
+    auto counter = machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false);
+    std::vector<std::unique_ptr<zemux::Machine>> forks;
+    auto startTime = Clock::now();
+
+    for (size_t i = 0; i < FORK_MACHINES; ++i) {
+        forks.push_back(machine->fork());
+    }
+
+    auto micros = std::chrono::duration<double, std::micro>(Clock::now() - startTime).count() / FORK_MACHINES;
+    BOOST_TEST_MESSAGE("Fork takes " << micros << " us");
+
+    // Nothing is copied or allocated for RAM, so the cost of the fork doesn't depend on RAM size.
+    for (auto& fork : forks) {
+        for (int page = 0; page < zemux::MemoryDevice::PAGES_RAM; ++page) {
+            BOOST_REQUIRE_EQUAL(fork->bus.memoryDevice->getRamPage(page), machine->bus.memoryDevice->getRamPage(page));
+        }
+    }
+
+    for (size_t i = 0; i < FORK_MACHINES; ++i) {
+        forks[i]->bus.onCpuMreqWr(COUNTER_ADDRESS, static_cast<uint8_t>(i));
+    }
+
+    BOOST_REQUIRE_EQUAL(machine->bus.onCpuMreqRd(COUNTER_ADDRESS, false), counter);
+
+    // Shared banks are read by forks on the other threads, while the parent writes its own copies.
+    zemux::MachineFarm farm { FARM_THREADS };
+
+    farm.createMachines(FORK_MACHINES, [&](size_t index) -> std::unique_ptr<zemux::Machine> {
+        return std::move(forks[index]);
+    });
+
+    std::thread parentThread([&machine]() {
+        for (int i = 0; i < FRAMES; ++i) {
+            machine->renderFrame();
+        }
+    });
+
+    farm.runFrames(FRAMES);
+    parentThread.join();
+
+    auto ramHash = hashRam(*machine);
+
+    for (size_t i = 0; i < farm.getMachinesCount(); ++i) {
+        auto& fork = farm.getMachine(i);
+
+        BOOST_REQUIRE_EQUAL(fork.bus.onCpuMreqRd(COUNTER_ADDRESS, false), static_cast<uint8_t>(i));
+        BOOST_REQUIRE_EQUAL(fork.cpu.regs.PC, machine->cpu.regs.PC);
+        BOOST_REQUIRE_EQUAL(fork.cpuChronometer.getSrcTicksPassed(), machine->cpuChronometer.getSrcTicksPassed());
+
+        fork.bus.onCpuMreqWr(COUNTER_ADDRESS, counter);
+        BOOST_REQUIRE_EQUAL(hashRam(fork), ramHash);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(MachineCodeWriteTest) {
+    using zemux::Bus;
+    using zemux::ExtPortDevice;
+
+    static const uint8_t program[] = {
+            0x3E, 0x11, // LD A,#11
+            0x18, 0xFE, // JR $
+    };
+
+    auto machine = std::make_unique<zemux::Machine>();
+    auto& bus = machine->bus;
+    auto& cpu = machine->cpu;
+
+    // RAM is mapped to the ROM window for writes, TR-DOS ROM will be mapped there for opcode fetches.
+    bus.onCpuIorqWr(ExtPortDevice::PORT_EFF7, ExtPortDevice::BIT_RAM_MAP_ROM);
+    bus.memoryDevice->enableBasic48Rom();
+
+    for (uint16_t i = 0; i < sizeof(program); ++i) {
+        bus.onCpuMreqWr(CODE_ADDRESS + i, program[i]);
+    }
+
+    cpu.regs.A = 0;
+    cpu.regs.B = 0;
+    cpu.regs.PC = CODE_ADDRESS;
+    cpu.run(CODE_TSTATES);
+    BOOST_REQUIRE_EQUAL(cpu.regs.A, 0x11);
+
+    // Writes to the clean pages go through the callback.
+    bus.memoryDevice->setDirtyTracking(true);
+    bus.onCpuMreqRd(0x3D00, true);
+    BOOST_REQUIRE_EQUAL(bus.getState().mreqRdLayer, Bus::OVERLAY_MREQ_RD_TRDOS);
+
+    // High byte of the return address (LD B,n) replaces the first opcode of the program.
+    cpu.regs.SP = CODE_ADDRESS + 1;
+    cpu.regs.PC = NMI_RETURN_ADDRESS;
+    cpu.doNmi();
+
+    bus.onCpuMreqRd(PROGRAM_ADDRESS, true);
+    BOOST_REQUIRE_EQUAL(bus.getState().mreqRdLayer, 0);
+    BOOST_REQUIRE_EQUAL(bus.onCpuMreqRd(CODE_ADDRESS, false), NMI_RETURN_ADDRESS >> 8);
+
+    cpu.regs.A = 0;
+    cpu.regs.PC = CODE_ADDRESS;
+    cpu.run(CODE_TSTATES);
+    BOOST_REQUIRE_EQUAL(cpu.regs.A, 0);
+    BOOST_REQUIRE_EQUAL(cpu.regs.B, 0x11);
+}
+
+#pragma clang diagnostic pop
@@ -30,6 +30,7 @@
 #include <iomanip>
 #include <fstream>
 #include <cstring>
+#include <sstream>
 #include <boost/test/unit_test.hpp>
 #include <zemux_integrated/z80_chip.h>
 
@@ -37,12 +38,12 @@ extern "C" {
 #include <lib_z80/cpu.h>
 }
 
-// #define DUMP_EXECUTION
-
 static const char* ZEXALL_PATH = "../test-extras/zexall.com";
 static const char* ZEXDOC_PATH = "../test-extras/zexdoc.com";
 static constexpr int MAX_BDOS_STRING_LEN = 128;
 static const char* ERROR_PHRASE = "ERROR";
+static constexpr unsigned int TRACE_CAPACITY = 64;
+static constexpr unsigned int TRACE_DUMP_ENTRIES = 16;
 
 static uint8_t testMemory[0x10000];
 static uint8_t ethalonMemory[0x10000];
@@ -111,14 +112,21 @@ static uint8_t onEthalonReadInt(void* /* data */) {
 class Z80CorrectnessTestCase {
 public:
 
-    Z80CorrectnessTestCase() : testCpu { this,
+    enum ExecuteMode {
+        ModeStep, // Z80Chip::step()
+        ModeRun // Z80Chip::run() with minimal budget (so it will execute exactly one instruction) and memory pages
+    };
+
+    explicit Z80CorrectnessTestCase(ExecuteMode executeMode = ModeStep) : executeMode { executeMode }, testCpu { this,
             onTestMreqRd,
             onTestMreqWr,
             onTestIorqRd,
             onTestIorqWr,
             onTestIorqM1,
             onTestPutAddress,
-            zemux::Z80Chip::TypeNmos } {
+            zemux::Z80Chip::TypeNmos }, trace { TRACE_CAPACITY, true } {
+
+        testCpu.setTrace(&trace);
 
         ethalonCpu = __ns_Cpu__new(
                 onEthalonRead, nullptr,
@@ -137,12 +145,23 @@ public:
 
 private:
 
+    ExecuteMode executeMode;
     zemux::Z80Chip testCpu;
+    zemux::Z80ChipTrace trace;
     s_Cpu* ethalonCpu;
     std::string bdosBuffer;
 
     void compareState();
 
+    void dumpTrace() {
+        // Trace is filled by step() only, so it is empty in ModeRun.
+        if (trace.getSize()) {
+            std::ostringstream os;
+            trace.dump(os, TRACE_DUMP_ENTRIES);
+            BOOST_TEST_MESSAGE("Last executed instructions:\n" << os.str());
+        }
+    }
+
     void bdosChar(char ch) {
         if (ch == '\r' || ch == '\n') {
             bdosFlush();
@@ -172,6 +191,20 @@ void Z80CorrectnessTestCase::execute(const char* path) {
     ifs.read(reinterpret_cast<char*>(&testMemory[0x0100]), 0x10000 - 0x0100);
     memcpy(ethalonMemory, testMemory, 0x10000);
 
+    if (executeMode == ModeRun) {
+        zemux::Z80ChipMemoryPages pages;
+
+        for (int page = 0; page < zemux::Z80ChipMemoryPages::PAGES; ++page) {
+            uint8_t* pagePtr = &testMemory[page << zemux::Z80ChipMemoryPages::PAGE_BITS];
+
+            pages.mreqRd[page] = pagePtr;
+            pages.mreqM1[page] = pagePtr;
+            pages.mreqWr[page] = pagePtr;
+        }
+
+        testCpu.setMemoryPages(pages);
+    }
+
     testCpu.reset();
     testCpu.regs.BC = 0xFFFF;
     testCpu.regs.DE = 0xFFFF;
@@ -270,13 +303,14 @@ void Z80CorrectnessTestCase::execute(const char* path) {
             __ns_Cpu__set_reg(ethalonCpu, CPU_SP, ethalonSP + 2);
         }
 
-        uint_fast32_t testTicks = testCpu.step();
+        uint_fast32_t testTicks = (executeMode == ModeRun) ? testCpu.run(1) : testCpu.step();
         unsigned int ethalonTicks = __ns_Cpu__tick(ethalonCpu);
 
         compareState();
 
         if (testTicks != ethalonTicks) {
             bdosFlush();
+            dumpTrace();
             BOOST_FAIL("testTicks " << testTicks << " != ethalonTicks " << ethalonTicks);
         }
     }
@@ -403,42 +437,6 @@ void Z80CorrectnessTestCase::compareState() {
     auto ethalonIsIntPossible = static_cast<bool>(__ns_Cpu__is_int_possible(ethalonCpu));
     auto ethalonIsNmiPossible = static_cast<bool>(__ns_Cpu__is_nmi_possible(ethalonCpu));
 
-#ifdef DUMP_EXECUTION
-    BOOST_TEST_MESSAGE(std::hex << std::setfill('0') << std::uppercase
-            << "AF=" << std::setw(4) << testAF
-            << " BC=" << std::setw(4) << testBC
-            << " DE=" << std::setw(4) << testDE
-            << " HL=" << std::setw(4) << testHL
-            << " IX=" << std::setw(4) << testIX
-            << " IY=" << std::setw(4) << testIY
-            << " AF'=" << std::setw(4) << testAF_
-            << " BC'=" << std::setw(4) << testBC_
-            << " DE'=" << std::setw(4) << testDE_
-            << " HL'=" << std::setw(4) << testHL_
-            << "\nPC=" << std::setw(4) << testPC
-            << " SP=" << std::setw(4) << testSP
-            << " MP=" << std::setw(4) << testMP
-            << " I=" << std::setw(2) << static_cast<uint16_t>(testI)
-            << " R=" << std::setw(2) << static_cast<uint16_t>(testR)
-            << std::dec
-            << " IFF1=" << testIFF1
-            << " IFF2=" << testIFF2
-            << " IM=" << testIM
-            << " INT?=" << testIsIntPossible
-            << " NMI?=" << testIsNmiPossible
-            << std::hex
-            << " PREF=" << std::setw(2) << static_cast<uint16_t>(testPrefix)
-            << "\n@PC " << std::setw(2) << static_cast<uint16_t>(testMemory[testPC])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testPC + 1)])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testPC + 2)])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testPC + 3)])
-            << " | @SP " << std::setw(2) << static_cast<uint16_t>(testMemory[testSP])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testSP + 1)])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testSP + 2)])
-            << " " << std::setw(2) << static_cast<uint16_t>(testMemory[static_cast<uint16_t>(testSP + 3)])
-            << "\n");
-#endif
-
     if (testBC != ethalonBC
             || testDE != ethalonDE
             || testHL != ethalonHL
@@ -484,6 +482,7 @@ void Z80CorrectnessTestCase::compareState() {
         compareAndOutputInt("NMI?", testIsNmiPossible, ethalonIsNmiPossible);
 
         bdosFlush();
+        dumpTrace();
         BOOST_FAIL("State comparison failed");
     }
 }
@@ -496,6 +495,11 @@ BOOST_AUTO_TEST_CASE(Z80CorrectnessZexallTest) {
     test.execute(ZEXALL_PATH);
 }
 
+BOOST_AUTO_TEST_CASE(Z80CorrectnessZexallRunTest) {
+    Z80CorrectnessTestCase test(Z80CorrectnessTestCase::ModeRun);
+    test.execute(ZEXALL_PATH);
+}
+
 BOOST_AUTO_TEST_CASE(Z80CorrectnessZexdocTest) {
     Z80CorrectnessTestCase test;
     test.execute(ZEXDOC_PATH);
@@ -0,0 +1,276 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+
+/*
+ * MIT License (http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Copyright (c) 2021, Viachaslau Tratsiak (aka restorer)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <boost/test/unit_test.hpp>
+#include <zemux_integrated/z80_chip.h>
+
+// Compares run() (which may execute block instructions and HALT in bulk)
+// with the same loop made of step() and doInt().
+
+static constexpr int RUN_CALLS = 2000;
+static constexpr uint_fast32_t RUN_INT_LINE_TSTATES = 32;
+static constexpr uint_fast32_t RUN_BUDGETS[] = { 1, 7, 21, 100, 1234, 71680 };
+static constexpr unsigned int TRACE_CAPACITY = 100;
+
+static constexpr uint16_t PROGRAM_ADDRESS = 0x0100;
+static constexpr uint16_t PROGRAM_LOOP_ADDRESS = 0x0105;
+static constexpr uint16_t PROGRAM_SELF_MODIFY_ADDRESS = 0x0300;
+
+class Z80RunTestCpu {
+public:
+
+    Z80RunTestCpu() : cpu { this,
+            onMreqRd,
+            onMreqWr,
+            onIorqRd,
+            onIorqWr,
+            onIorqM1,
+            onPutAddress,
+            zemux::Z80Chip::TypeNmos } {
+    }
+
+    zemux::Z80Chip cpu;
+    uint8_t memory[0x10000];
+
+    void load(bool isIntEnabled);
+    void publishMemoryPages();
+    uint_fast32_t emulateRun(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates);
+
+private:
+
+    static uint8_t onMreqRd(void* data, uint16_t address, bool /* isM1 */) {
+        return static_cast<Z80RunTestCpu*>(data)->memory[address];
+    }
+
+    static void onMreqWr(void* data, uint16_t address, uint8_t value) {
+        static_cast<Z80RunTestCpu*>(data)->memory[address] = value;
+    }
+
+    static uint8_t onIorqRd(void* /* data */, uint16_t /* port */) {
+        return 0xFF;
+    }
+
+    static void onIorqWr(void* /* data */, uint16_t /* port */, uint8_t /* value */) {
+    }
+
+    static uint8_t onIorqM1(void* /* data */) {
+        return 0xFF;
+    }
+
+    static void onPutAddress(void* /* data */, uint16_t /* address */, uint_fast32_t /* cycles */) {
+    }
+};
+
+void Z80RunTestCpu::load(bool isIntEnabled) {
+    uint32_t seed = 0x12345678;
+
+    for (auto& value : memory) {
+        seed = seed * 1103515245 + 12345;
+        value = static_cast<uint8_t>(seed >> 16);
+    }
+
+    static const uint8_t intHandler[] = {
+            0xFB, // EI
+            0xC9, // RET
+    };
+
+    static const uint8_t program[] = {
+            0x31, 0x00, 0xFF, // LD SP,#FF00
+            0xED, 0x56, // IM 1
+            0xF3, // loop: DI (or EI)
+            0x00, // NOP (or HALT)
+            0x21, 0x00, 0x40, // LD HL,#4000
+            0x11, 0x00, 0x80, // LD DE,#8000
+            0x01, 0x00, 0x1B, // LD BC,#1B00
+            0xED, 0xB0, // LDIR
+            0x21, 0xFF, 0x9A, // LD HL,#9AFF
+            0x11, 0x00, 0xC0, // LD DE,#C000
+            0x01, 0x00, 0x08, // LD BC,#0800
+            0xED, 0xB8, // LDDR
+            0x21, 0x00, 0x40, // LD HL,#4000
+            0x01, 0x00, 0x1B, // LD BC,#1B00
+            0x3E, 0x5A, // LD A,#5A
+            0xED, 0xB1, // CPIR
+            0x21, 0xFF, 0x5A, // LD HL,#5AFF
+            0x01, 0x00, 0x1B, // LD BC,#1B00
+            0x3E, 0xA5, // LD A,#A5
+            0xED, 0xB9, // CPDR
+            0x21, 0xED, 0xB0, // LD HL,#B0ED
+            0x22, 0x00, 0x03, // LD (#0300),HL
+            0x21, 0x00, 0x30, // LD HL,#3000
+            0x11, 0xF0, 0x02, // LD DE,#02F0
+            0x01, 0x00, 0x01, // LD BC,#0100
+            0xC3, 0x00, 0x03, // JP #0300
+    };
+
+    static const uint8_t selfModify[] = {
+            0xED, 0xB0, // LDIR (overwrites itself with NOPs)
+            0xC3, 0x05, 0x01, // JP loop
+    };
+
+    memset(&memory[0x3000], 0, 0x0100);
+    memcpy(&memory[0x0038], intHandler, sizeof(intHandler));
+    memcpy(&memory[PROGRAM_ADDRESS], program, sizeof(program));
+    memcpy(&memory[PROGRAM_SELF_MODIFY_ADDRESS], selfModify, sizeof(selfModify));
+    memory[PROGRAM_LOOP_ADDRESS] = isIntEnabled ? 0xFB : 0xF3;
+    memory[PROGRAM_LOOP_ADDRESS + 1] = isIntEnabled ? 0x76 : 0x00;
+
+    cpu.reset();
+    cpu.regs.PC = PROGRAM_ADDRESS;
+}
+
+void Z80RunTestCpu::publishMemoryPages() {
+    zemux::Z80ChipMemoryPages pages;
+
+    for (int page = 0; page < zemux::Z80ChipMemoryPages::PAGES; ++page) {
+        uint8_t* pagePtr = &memory[page << zemux::Z80ChipMemoryPages::PAGE_BITS];
+
+        // Some pages are left to callbacks, to check that bulk execution stops at the page boundary.
+        pages.mreqRd[page] = (page == 0x50) ? nullptr : pagePtr;
+        pages.mreqM1[page] = pagePtr;
+        pages.mreqWr[page] = (page >= 0x90 && page < 0x98) ? nullptr : pagePtr;
+    }
+
+    cpu.setMemoryPages(pages);
+}
+
+uint_fast32_t Z80RunTestCpu::emulateRun(uint_fast32_t tstateBudget, uint_fast32_t intLineTstates) {
+    uint_fast32_t tstate = 0;
+
+    while (tstate < tstateBudget) {
+        if (tstate < intLineTstates) {
+            uint_fast32_t intTstate = cpu.doInt();
+
+            if (intTstate) {
+                tstate += intTstate;
+                continue;
+            }
+        }
+
+        tstate += cpu.step();
+    }
+
+    return tstate;
+}
+
+static void requireSameState(const Z80RunTestCpu& test, const Z80RunTestCpu& ethalon) {
+    const auto& testRegs = test.cpu.regs;
+    const auto& ethalonRegs = ethalon.cpu.regs;
+
+    BOOST_REQUIRE_EQUAL(testRegs.PC, ethalonRegs.PC);
+    BOOST_REQUIRE_EQUAL(testRegs.AF, ethalonRegs.AF);
+    BOOST_REQUIRE_EQUAL(testRegs.BC, ethalonRegs.BC);
+    BOOST_REQUIRE_EQUAL(testRegs.DE, ethalonRegs.DE);
+    BOOST_REQUIRE_EQUAL(testRegs.HL, ethalonRegs.HL);
+    BOOST_REQUIRE_EQUAL(testRegs.SP, ethalonRegs.SP);
+    BOOST_REQUIRE_EQUAL(testRegs.MP, ethalonRegs.MP);
+    BOOST_REQUIRE_EQUAL(testRegs.IR, ethalonRegs.IR);
+    BOOST_REQUIRE_EQUAL(testRegs.IFF1, ethalonRegs.IFF1);
+    BOOST_REQUIRE_EQUAL(testRegs.IFF2, ethalonRegs.IFF2);
+    BOOST_REQUIRE_EQUAL(test.cpu.getOpcodePrefix(), ethalon.cpu.getOpcodePrefix());
+    BOOST_REQUIRE(memcmp(test.memory, ethalon.memory, sizeof(test.memory)) == 0);
+}
+
+static void onTraceTrigger(void* data, const zemux::Z80ChipTrace& trace) {
+    ++*static_cast<int*>(data);
+    BOOST_REQUIRE_EQUAL(trace.getEntry(trace.getSize() - 1).pc, PROGRAM_LOOP_ADDRESS);
+}
+
+// When isTraced is true, traces are attached to both CPUs, so it also checks that tracing doesn't change execution,
+// and that run() traces the same entries as step().
+static void checkRun(bool isIntEnabled, bool isTraced = false) {
+    auto test = std::make_unique<Z80RunTestCpu>();
+    auto ethalon = std::make_unique<Z80RunTestCpu>();
+    zemux::Z80ChipTrace trace { TRACE_CAPACITY, true };
+    zemux::Z80ChipTrace testTrace { TRACE_CAPACITY, true };
+    int triggerCalls = 0;
+
+    test->load(isIntEnabled);
+    test->publishMemoryPages();
+    ethalon->load(isIntEnabled);
+
+    if (isTraced) {
+        trace.setTrigger(PROGRAM_LOOP_ADDRESS, onTraceTrigger, &triggerCalls);
+        ethalon->cpu.setTrace(&trace);
+        test->cpu.setTrace(&testTrace);
+    }
+
+    for (int i = 0; i < RUN_CALLS; ++i) {
+        uint_fast32_t tstateBudget = RUN_BUDGETS[i % (sizeof(RUN_BUDGETS) / sizeof(RUN_BUDGETS[0]))];
+
+        uint_fast32_t testTstate = isIntEnabled
+                ? test->cpu.run(tstateBudget, RUN_INT_LINE_TSTATES)
+                : test->cpu.run(tstateBudget);
+
+        uint_fast32_t ethalonTstate = ethalon->emulateRun(tstateBudget, isIntEnabled ? RUN_INT_LINE_TSTATES : 0);
+
+        requireSameState(*test, *ethalon);
+        BOOST_REQUIRE_EQUAL(testTstate, ethalonTstate);
+    }
+
+    if (isTraced) {
+        BOOST_REQUIRE_EQUAL(trace.getCapacity(), 128u);
+        BOOST_REQUIRE_EQUAL(trace.getSize(), trace.getCapacity());
+        BOOST_REQUIRE(triggerCalls > 0);
+
+        for (unsigned int index = 0; index < trace.getSize(); ++index) {
+            const auto& entry = trace.getEntry(index);
+            BOOST_REQUIRE_EQUAL(entry.pc, entry.regs.PC);
+
+            if (index) {
+                BOOST_REQUIRE(entry.tstate > trace.getEntry(index - 1).tstate);
+            }
+
+            const auto& testEntry = testTrace.getEntry(index);
+            BOOST_REQUIRE_EQUAL(testEntry.tstate, entry.tstate);
+            BOOST_REQUIRE_EQUAL(testEntry.pc, entry.pc);
+            BOOST_REQUIRE_EQUAL(testEntry.prefix, entry.prefix);
+            BOOST_REQUIRE_EQUAL(testEntry.opcode, entry.opcode);
+            BOOST_REQUIRE_EQUAL(testEntry.regs.AF, entry.regs.AF);
+        }
+    }
+}
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "cert-err58-cpp"
+
+BOOST_AUTO_TEST_CASE(Z80RunTest) {
+    checkRun(false);
+}
+
+BOOST_AUTO_TEST_CASE(Z80RunIntTest) {
+    checkRun(true);
+}
+
+BOOST_AUTO_TEST_CASE(Z80RunTraceTest) {
+    checkRun(true, true);
+}
+
+#pragma clang diagnostic pop
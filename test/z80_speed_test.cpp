@@ -25,14 +25,25 @@
  * THE SOFTWARE.
  */
 
+#include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include <iomanip>
 #include <fstream>
 #include <cstring>
+#include <cctype>
 #include <chrono>
+#include <functional>
+#include <sstream>
 #include <boost/test/unit_test.hpp>
+#include <zemux_core/force_inline.h>
 #include <zemux_integrated/z80_chip.h>
+#include <zemux_integrated/z80_chip_impl.h>
+#include <zemux_machine/machine.h>
+#include <zemux_machine/machine_rewind.h>
+#include "busy_program.h"
 
 extern "C" {
 #include <lib_z80/cpu.h>
@@ -40,6 +51,15 @@ extern "C" {
 
 static const char* ZEXALL_PATH = "../test-extras/zexall.com";
 static constexpr int MAX_BDOS_STRING_LEN = 128;
+static constexpr uint_fast32_t RUN_TSTATE_BUDGET = 71680; // Pentagon frame
+static constexpr uint16_t ALU_STREAM_ITERATIONS = 0x8000;
+static constexpr int PROFILE_REPORT_OPCODES = 32;
+static constexpr size_t REWIND_SPEED_BUDGET = 64 * 1024 * 1024;
+static constexpr int REWIND_SPEED_ROUNDS = 3;
+static constexpr int REWIND_SPEED_BLOCKS = 100;
+static constexpr int REWIND_SPEED_WARMUP_FRAMES = 5;
+static constexpr double REWIND_SPEED_MAX_OVERHEAD = 0.02;
+static constexpr double REWIND_SPEED_MAX_FRAME_RATIO = 2.0;
 
 static uint8_t memory[0x10000];
 
@@ -70,6 +90,35 @@ static uint8_t onTestIorqM1(void* /* data */) {
 static void onTestPutAddress(void* /* data */, uint16_t /* address */, uint_fast32_t /* cycles */) {
 }
 
+static uint8_t onTestRunMreqRd(void* data, uint16_t address, bool isM1);
+
+// Same as callbacks above, but known at compile time, so memory access is inlined into the opcode handlers.
+struct Z80SpeedTestBus {
+    ZEMUX_FORCE_INLINE uint8_t onCpuMreqRd(uint16_t address, bool /* isM1 */) {
+        return memory[address];
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuMreqWr(uint16_t address, uint8_t value) {
+        memory[address] = value;
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqRd(uint16_t /* port */) {
+        return 0x00;
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuIorqWr(uint16_t /* port */, uint8_t /* value */) {
+    }
+
+    ZEMUX_FORCE_INLINE uint8_t onCpuIorqM1() {
+        return 0xFF;
+    }
+
+    ZEMUX_FORCE_INLINE void onCpuPutAddress(uint16_t /* address */, uint_fast32_t /* cycles */) {
+    }
+};
+
+template class zemux::BasicZ80Chip<Z80SpeedTestBus>;
+
 static uint8_t onEthalonRead(uint16_t addr, bool /* m1 */, void* /* data */) {
     return memory[addr];
 }
@@ -99,7 +148,15 @@ public:
             onTestIorqWr,
             onTestIorqM1,
             onTestPutAddress,
-            zemux::Z80Chip::TypeNmos } {
+            zemux::Z80Chip::TypeNmos }, testRunCpu { this,
+            onTestRunMreqRd,
+            onTestMreqWr,
+            onTestIorqRd,
+            onTestIorqWr,
+            onTestIorqM1,
+            onTestPutAddress,
+            zemux::Z80Chip::TypeNmos }, testInlineCpu { &testInlineBus,
+            zemux::BasicZ80Chip<Z80SpeedTestBus>::TypeNmos } {
 
         ethalonCpu = __ns_Cpu__new(
                 onEthalonRead, nullptr,
@@ -115,16 +172,31 @@ public:
     }
 
     void measure(const char* path);
+    void measureAluStream();
 
 private:
 
     zemux::Z80Chip testCpu;
+    zemux::Z80Chip testRunCpu;
+    Z80SpeedTestBus testInlineBus;
+    zemux::BasicZ80Chip<Z80SpeedTestBus> testInlineCpu;
     s_Cpu* ethalonCpu;
     std::string bdosBuffer;
+    bool isRunFinished = false;
 
     static void prepare(const char* path);
+    static void prepareAluStream();
+    static void logRatio(const char* name, int64_t time, const char* otherName, int64_t otherTime);
+
+#ifdef ZEMUX_Z80_PROFILER
+    static void logProfile(const char* name, const zemux::Z80ChipProfile& profile);
+#endif
 
-    void executeTest();
+    void measure(const char* name, const std::function<void()>& load);
+    template<typename T>
+    void executeTest(T& cpu);
+
+    void executeTestRun();
     void executeEthalon();
     uint16_t bdos(uint16_t bc, uint16_t de, uint16_t sp);
 
@@ -142,43 +214,128 @@ private:
             bdosBuffer.clear();
         }
     }
+
+    friend uint8_t onTestRunMreqRd(void* data, uint16_t address, bool isM1);
 };
 
+static uint8_t onTestRunMreqRd(void* data, uint16_t address, bool isM1) {
+    // run() doesn't stop between instructions, so BDOS calls and exit are trapped during opcode fetch.
+
+    if (isM1 && address == 0x0005) {
+        auto self = static_cast<Z80SpeedTestCase*>(data);
+        self->bdos(self->testRunCpu.regs.BC, self->testRunCpu.regs.DE, self->testRunCpu.regs.SP);
+    } else if (isM1 && address == 0x0000) {
+        static_cast<Z80SpeedTestCase*>(data)->isRunFinished = true;
+    }
+
+    return memory[address];
+}
+
 void Z80SpeedTestCase::measure(const char* path) {
-    prepare(path);
+    measure(path, [path]() { prepare(path); });
+}
+
+void Z80SpeedTestCase::measureAluStream() {
+    measure("ALU stream", prepareAluStream);
+}
+
+void Z80SpeedTestCase::measure(const char* name, const std::function<void()>& load) {
+#ifdef ZEMUX_Z80_FLAG_TABLES
+    BOOST_TEST_MESSAGE("ZemuX Z80 uses flag tables");
+#else
+    BOOST_TEST_MESSAGE("ZemuX Z80 uses flag arithmetic");
+#endif
+
+#ifdef ZEMUX_Z80_PROFILER
+    BOOST_TEST_MESSAGE("ZemuX Z80 profiler is enabled, timings are not representative");
+    testCpu.profile.reset();
+#endif
+
+    load();
     BOOST_TEST_MESSAGE("Measuring ZemuX Z80 (test)...");
     int64_t startMillis = steadyClockNowMillis();
-    executeTest();
+    executeTest(testCpu);
     int64_t testTime = steadyClockNowMillis() - startMillis;
-    BOOST_TEST_MESSAGE("ZemuX Z80 (test) passed \"" << path << "\" in " << testTime << " ms");
+    BOOST_TEST_MESSAGE("ZemuX Z80 (test) passed \"" << name << "\" in " << testTime << " ms");
 
-    prepare(path);
+#ifdef ZEMUX_Z80_PROFILER
+    logProfile(name, testCpu.profile);
+#endif
+
+    load();
     BOOST_TEST_MESSAGE("Measuring Zame Z80 (ethalon)...");
     startMillis = steadyClockNowMillis();
     executeEthalon();
     int64_t ethalonTime = steadyClockNowMillis() - startMillis;
-    BOOST_TEST_MESSAGE("Zame Z80 (ethalon) passed \"" << path << "\" in " << ethalonTime << " ms");
+    BOOST_TEST_MESSAGE("Zame Z80 (ethalon) passed \"" << name << "\" in " << ethalonTime << " ms");
+
+    load();
+    BOOST_TEST_MESSAGE("Measuring ZemuX Z80 (test, run)...");
+    startMillis = steadyClockNowMillis();
+    executeTestRun();
+    int64_t testRunTime = steadyClockNowMillis() - startMillis;
+    BOOST_TEST_MESSAGE("ZemuX Z80 (test, run) passed \"" << name << "\" in " << testRunTime << " ms");
 
-    if (testTime < ethalonTime) {
-        double ratio = static_cast<double>(ethalonTime) / static_cast<double>(testTime);
+    load();
+    BOOST_TEST_MESSAGE("Measuring ZemuX Z80 (test, inline bus)...");
+    startMillis = steadyClockNowMillis();
+    executeTest(testInlineCpu);
+    int64_t testInlineTime = steadyClockNowMillis() - startMillis;
+    BOOST_TEST_MESSAGE("ZemuX Z80 (test, inline bus) passed \"" << name << "\" in " << testInlineTime << " ms");
+
+    logRatio("ZemuX Z80 (test)", testTime, "Zame Z80 (ethalon)", ethalonTime);
+    logRatio("ZemuX Z80 (test, run)", testRunTime, "ZemuX Z80 (test)", testTime);
+    logRatio("ZemuX Z80 (test, inline bus)", testInlineTime, "ZemuX Z80 (test)", testTime);
+}
 
-        BOOST_TEST_MESSAGE("ZemuX Z80 (test) is "
+void Z80SpeedTestCase::logRatio(const char* name, int64_t time, const char* otherName, int64_t otherTime) {
+    if (time < otherTime) {
+        double ratio = static_cast<double>(otherTime) / static_cast<double>(time);
+
+        BOOST_TEST_MESSAGE(name
+                << " is "
                 << std::setprecision(3)
                 << ratio
-                << "motionX faster then Zame Z80 (ethalon)");
-    } else if (testTime == ethalonTime) {
-        BOOST_TEST_MESSAGE(
-                "ZemuX Z80 (test) has the same speed as Zame Z80 (ethalon), but probably this is bug in testing environment. Please retest.");
+                << "x faster then "
+                << otherName);
+    } else if (time == otherTime) {
+        BOOST_TEST_MESSAGE(name
+                << " has the same speed as "
+                << otherName
+                << ", but probably this is bug in testing environment. Please retest.");
     } else {
-        double ratio = static_cast<double>(testTime) / static_cast<double>(ethalonTime);
+        double ratio = static_cast<double>(time) / static_cast<double>(otherTime);
 
-        BOOST_TEST_MESSAGE("ZemuX Z80 (test) is "
+        BOOST_TEST_MESSAGE(name
+                << " is "
                 << std::setprecision(3)
                 << ratio
-                << "motionX SLOWER then Zame Z80 (ethalon)");
+                << "x SLOWER then "
+                << otherName);
     }
 }
 
+#ifdef ZEMUX_Z80_PROFILER
+
+void Z80SpeedTestCase::logProfile(const char* name, const zemux::Z80ChipProfile& profile) {
+    std::ostringstream report;
+    profile.writeReport(report, PROFILE_REPORT_OPCODES);
+    BOOST_TEST_MESSAGE("ZemuX Z80 (test) profile for \"" << name << "\":\n" << report.str());
+
+    std::string csvPath = "z80_profile_";
+
+    for (const char* p = name; *p; ++p) {
+        csvPath += std::isalnum(static_cast<unsigned char>(*p)) ? *p : '_';
+    }
+
+    csvPath += ".csv";
+    std::ofstream ofs(csvPath);
+    profile.writeCsv(ofs);
+    BOOST_TEST_MESSAGE("ZemuX Z80 (test) profile saved to \"" << csvPath << "\"");
+}
+
+#endif
+
 void Z80SpeedTestCase::prepare(const char* path) {
     BOOST_TEST_MESSAGE("Loading \"" << path << "\"...");
 
@@ -191,40 +348,123 @@ void Z80SpeedTestCase::prepare(const char* path) {
     ifs.read(reinterpret_cast<char*>(&memory[0x0100]), 0x10000 - 0x0100);
 }
 
-void Z80SpeedTestCase::executeTest() {
-    testCpu.reset();
-    testCpu.regs.BC = 0xFFFF;
-    testCpu.regs.DE = 0xFFFF;
-    testCpu.regs.HL = 0xFFFF;
-    testCpu.regs.AF = 0xFFFF;
-    testCpu.regs.IX = 0xFFFF;
-    testCpu.regs.IY = 0xFFFF;
-    testCpu.regs.SP = 0xFFFF;
-    testCpu.regs.PC = 0x0100;
-    testCpu.regs.MP = 0x0100;
-    testCpu.regs.BC_ = 0xFFFF;
-    testCpu.regs.DE_ = 0xFFFF;
-    testCpu.regs.HL_ = 0xFFFF;
-    testCpu.regs.AF_ = 0xFFFF;
+void Z80SpeedTestCase::prepareAluStream() {
+    BOOST_TEST_MESSAGE("Generating ALU stream...");
+
+    static const uint8_t program[] = {
+            0xDD, 0x21, // LD IX,ALU_STREAM_ITERATIONS
+            static_cast<uint8_t>(ALU_STREAM_ITERATIONS),
+            static_cast<uint8_t>(ALU_STREAM_ITERATIONS >> 8),
+            0x06, 0x00, // outer: LD B,0
+            0x81, // inner: ADD A,C
+            0x8B, // ADC A,E
+            0x94, // SUB H
+            0x9D, // SBC A,L
+            0xB9, // CP C
+            0x0C, // INC C
+            0x1D, // DEC E
+            0xA4, // AND H
+            0xAD, // XOR L
+            0xB1, // OR C
+            0x86, // ADD A,(HL)
+            0x2C, // INC L
+            0x25, // DEC H
+            0xCE, 0x5A, // ADC A,#5A
+            0xD6, 0x33, // SUB #33
+            0xEE, 0xA5, // XOR #A5
+            0xBB, // CP E
+            0x3C, // INC A
+            0x10, 0xE9, // DJNZ inner
+            0xDD, 0x2B, // DEC IX
+            0x08, // EX AF,AF'
+            0xDD, 0x7C, // LD A,IXH
+            0xDD, 0xB5, // OR IXL
+            0x28, 0x03, // JR Z,exit
+            0x08, // EX AF,AF'
+            0x18, 0xDB, // JR outer
+            0xC3, 0x00, 0x00, // exit: JP 0
+    };
+
+    memset(memory, 0, 0x10000);
+    memcpy(&memory[0x0100], program, sizeof(program));
+}
+
+template<typename T>
+void Z80SpeedTestCase::executeTest(T& cpu) {
+    cpu.reset();
+    cpu.regs.BC = 0xFFFF;
+    cpu.regs.DE = 0xFFFF;
+    cpu.regs.HL = 0xFFFF;
+    cpu.regs.AF = 0xFFFF;
+    cpu.regs.IX = 0xFFFF;
+    cpu.regs.IY = 0xFFFF;
+    cpu.regs.SP = 0xFFFF;
+    cpu.regs.PC = 0x0100;
+    cpu.regs.MP = 0x0100;
+    cpu.regs.BC_ = 0xFFFF;
+    cpu.regs.DE_ = 0xFFFF;
+    cpu.regs.HL_ = 0xFFFF;
+    cpu.regs.AF_ = 0xFFFF;
 
     for (;;) {
-        uint16_t pc = testCpu.regs.PC;
-        uint8_t prefix = testCpu.getOpcodePrefix();
+        uint16_t pc = cpu.regs.PC;
+        uint8_t prefix = cpu.getOpcodePrefix();
 
         if (prefix == 0x00 && pc == 0x0000) {
             break;
         }
 
         if (prefix == 0x00 && pc == 0x0005) {
-            uint16_t sp = testCpu.regs.SP;
-            uint16_t addr = bdos(testCpu.regs.BC, testCpu.regs.DE, sp);
+            uint16_t sp = cpu.regs.SP;
+            uint16_t addr = bdos(cpu.regs.BC, cpu.regs.DE, sp);
 
-            testCpu.regs.PC = addr;
-            testCpu.regs.MP = addr;
-            testCpu.regs.SP = sp + 2;
+            cpu.regs.PC = addr;
+            cpu.regs.MP = addr;
+            cpu.regs.SP = sp + 2;
         }
 
-        testCpu.step();
+        cpu.step();
+    }
+
+    bdosFlush();
+}
+
+void Z80SpeedTestCase::executeTestRun() {
+    memory[0x0000] = 0x18; // JR $
+    memory[0x0001] = 0xFE;
+    memory[0x0005] = 0xC9; // RET
+
+    testRunCpu.reset();
+    testRunCpu.regs.BC = 0xFFFF;
+    testRunCpu.regs.DE = 0xFFFF;
+    testRunCpu.regs.HL = 0xFFFF;
+    testRunCpu.regs.AF = 0xFFFF;
+    testRunCpu.regs.IX = 0xFFFF;
+    testRunCpu.regs.IY = 0xFFFF;
+    testRunCpu.regs.SP = 0xFFFF;
+    testRunCpu.regs.PC = 0x0100;
+    testRunCpu.regs.MP = 0x0100;
+    testRunCpu.regs.BC_ = 0xFFFF;
+    testRunCpu.regs.DE_ = 0xFFFF;
+    testRunCpu.regs.HL_ = 0xFFFF;
+    testRunCpu.regs.AF_ = 0xFFFF;
+
+    // BDOS and exit are trapped on opcode fetch, so page 0 should go through the callback.
+    zemux::Z80ChipMemoryPages pages;
+
+    for (int page = 0; page < zemux::Z80ChipMemoryPages::PAGES; ++page) {
+        uint8_t* pagePtr = &memory[page << zemux::Z80ChipMemoryPages::PAGE_BITS];
+
+        pages.mreqRd[page] = pagePtr;
+        pages.mreqM1[page] = page ? pagePtr : nullptr;
+        pages.mreqWr[page] = pagePtr;
+    }
+
+    testRunCpu.setMemoryPages(pages);
+    isRunFinished = false;
+
+    while (!isRunFinished) {
+        testRunCpu.run(RUN_TSTATE_BUDGET);
     }
 
     bdosFlush();
@@ -300,4 +540,109 @@ BOOST_AUTO_TEST_CASE(Z80SpeedTest) {
     test.measure(ZEXALL_PATH);
 }
 
+BOOST_AUTO_TEST_CASE(Z80AluSpeedTest) {
+    Z80SpeedTestCase test;
+    test.measureAluStream();
+}
+
+BOOST_AUTO_TEST_CASE(MachineRewindSpeedTest) {
+    using Clock = std::chrono::steady_clock;
+
+    std::unique_ptr<zemux::Machine> machines[2];
+    std::unique_ptr<zemux::MachineRewind> rewinds[2];
+
+    for (int i = 0; i < 2; ++i) {
+        machines[i] = std::make_unique<zemux::Machine>();
+        clearRam(*machines[i]);
+        loadBusyProgram(*machines[i]);
+        rewinds[i] = std::make_unique<zemux::MachineRewind>(machines[i].get(), REWIND_SPEED_BUDGET);
+    }
+
+    auto measureFrame = [](zemux::Machine* machine, zemux::MachineRewind* rewind) {
+        auto startTime = Clock::now();
+        machine->renderFrame();
+
+        if (rewind != nullptr) {
+            rewind->recordFrame();
+        }
+
+        return std::chrono::duration<double>(Clock::now() - startTime).count();
+    };
+
+    // Machines swap roles after every block, so the difference of machines themselves (e.g. placement
+    // of their memory) is cancelled out. Frames of both machines are interleaved, so they are equally affected
+    // by the slow changes of the host. Recording is resumed with the keyframe of the whole RAM, so the first
+    // frames of the block are not measured, and the next keyframe is the last measured frame.
+    auto measureOverhead = [&]() {
+        std::vector<double> times;
+        std::vector<double> rewindTimes;
+        int blockFrames = zemux::MachineRewind::DEFAULT_KEYFRAME_INTERVAL;
+
+        for (int block = 0; block < REWIND_SPEED_BLOCKS; ++block) {
+            int recording = block % 2;
+            zemux::Machine* machine = machines[recording ^ 1].get();
+            zemux::Machine* rewindMachine = machines[recording].get();
+            zemux::MachineRewind* rewind = rewinds[recording].get();
+
+            machine->bus.memoryDevice->setDirtyTracking(false);
+
+            for (int frame = 0; frame < blockFrames + REWIND_SPEED_WARMUP_FRAMES; ++frame) {
+                double time;
+                double rewindTime;
+
+                if (frame % 2) {
+                    rewindTime = measureFrame(rewindMachine, rewind);
+                    time = measureFrame(machine, nullptr);
+                } else {
+                    time = measureFrame(machine, nullptr);
+                    rewindTime = measureFrame(rewindMachine, rewind);
+                }
+
+                if (frame >= REWIND_SPEED_WARMUP_FRAMES) {
+                    times.push_back(time);
+                    rewindTimes.push_back(rewindTime);
+                }
+            }
+        }
+
+        // Pair is skipped when one of the frames is much longer than usual (it was preempted),
+        // frames with keyframes are not that long.
+        auto sortedTimes = times;
+        std::sort(sortedTimes.begin(), sortedTimes.end());
+        auto maxTime = sortedTimes[sortedTimes.size() / 2] * REWIND_SPEED_MAX_FRAME_RATIO;
+
+        double time = 0.0;
+        double rewindTime = 0.0;
+
+        for (size_t i = 0; i < times.size(); ++i) {
+            if (times[i] < maxTime && rewindTimes[i] < maxTime) {
+                time += times[i];
+                rewindTime += rewindTimes[i];
+            }
+        }
+
+        return rewindTime / time - 1.0;
+    };
+
+    // Host may slow down one of the machines for the whole round, so the best round is taken.
+    double overhead = 0.0;
+
+    for (int round = 0; round < REWIND_SPEED_ROUNDS; ++round) {
+        auto roundOverhead = measureOverhead();
+        overhead = (round == 0) ? roundOverhead : std::min(overhead, roundOverhead);
+        BOOST_TEST_MESSAGE("Rewind overhead in round " << round << " is " << roundOverhead * 100.0 << "%");
+    }
+
+    BOOST_TEST_MESSAGE("Rewind overhead is " << overhead * 100.0 << "%, "
+            << rewinds[0]->getUsedMemory() / rewinds[0]->getFramesCount() << " bytes per frame");
+
+    BOOST_CHECK_LT(overhead, REWIND_SPEED_MAX_OVERHEAD);
+
+    // Untouched RAM is not initialized, so only the state of the program is compared.
+    BOOST_REQUIRE_EQUAL(machines[1]->cpu.regs.PC, machines[0]->cpu.regs.PC);
+    BOOST_REQUIRE_EQUAL(
+            machines[1]->bus.onCpuMreqRd(BUSY_BANK_ADDRESS, false),
+            machines[0]->bus.onCpuMreqRd(BUSY_BANK_ADDRESS, false));
+}
+
 #pragma clang diagnostic pop
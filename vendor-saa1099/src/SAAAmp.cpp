@@ -301,7 +301,7 @@ unsigned short CSAAAmp::TickAndOutputMono(void)
 
 stereolevel CSAAAmp::TickAndOutputStereo(void)
 {
-	static stereolevel retval;
+	stereolevel retval; /* @restorer: was static, made local for ZemuX (chips may tick in parallel threads) */
 	static const stereolevel zeroval = { {0,0} };
 	
 	if (m_bSync)
@@ -11,8 +11,6 @@
 #include "SAAEnv.h"
 #include "SAAFreq.h"
 
-unsigned long CSAAFreq::m_FreqTable[2048];
-
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -156,22 +154,8 @@ void CSAAFreq::SetClockRate(int nClockRate)
 #else
 void CSAAFreq::SetClockRate(int nClockRate)
 {
-	// initialise the frequency table based on the SAA clockrate
-	// Each item in m_FreqTable corresponds to the frequency calculated by
-	// the standard formula   (15625 << octave) / (511 - offset)
-	// then multiplied by 8192 (and represented as a long integer value).
-	// We are therefore using 12 bits (i.e. 2^12 = 4096) as fractional part.
-	// The reason we multiply by 8192, not 4096, is that we use this as a counter
-	// to toggle the oscillator state, so we need to count half-waves (i.e. twice
-	// the frequency)
-	//
-	// Finally, note that the standard formula corresponds to a 8MHz base clock
-	// so we rescale the final result by the volume nClockRate/8000000
-
-	int ix = 0;
-	for (int nOctave = 0; nOctave < 8; nOctave++)
-		for (int nOffset = 0; nOffset < 256; nOffset++)
-			m_FreqTable[ix++] = (unsigned long)((8192.0 * 15625.0 * double(1<<nOctave) * (double(nClockRate)/8000000.0)) / (511.0 - double(nOffset)));
+	// @restorer: modified for ZemuX, frequency is calculated in SetAdd() (see below)
+	m_nClockRate = nClockRate;
 }
 #endif
 
@@ -244,8 +228,21 @@ void CSAAFreq::SetAdd(void)
 
 	// Used to be:
 	// m_nAdd = (15625 << nOctave) / (511 - nOffset);
+#ifdef SAAFREQ_FIXED_CLOCKRATE
 	// Now just table lookup:
 	m_nAdd = m_FreqTable[m_nCurrentOctave<<8 | m_nCurrentOffset];
+#else
+	// @restorer: modified for ZemuX, table was shared by all chips, now it is calculated for the single item.
+	// Standard formula is multiplied by 8192 (and represented as a long integer value).
+	// We are therefore using 12 bits (i.e. 2^12 = 4096) as fractional part.
+	// The reason we multiply by 8192, not 4096, is that we use this as a counter
+	// to toggle the oscillator state, so we need to count half-waves (i.e. twice
+	// the frequency).
+	// Finally, note that the standard formula corresponds to a 8MHz base clock
+	// so we rescale the final result by the volume nClockRate/8000000
+	m_nAdd = (unsigned long)((8192.0 * 15625.0 * double(1<<m_nCurrentOctave) * (double(m_nClockRate)/8000000.0))
+			/ (511.0 - double(m_nCurrentOffset)));
+#endif
 }
 
 void CSAAFreq::Sync(bool bSync)
@@ -19,8 +19,9 @@ private:
 #include "SAAFreq.dat"
 	}
 #else
-	// we'll calculate the frequency lookup table at runtime.
-	static unsigned long m_FreqTable[2048];
+	// we'll calculate the frequency at runtime.
+	// @restorer: was the static table, which is shared by all chips, replaced for ZemuX
+	int m_nClockRate;
 #endif
 
 	static inline unsigned short GetLevel(unsigned short nLevel);
@@ -1542,7 +1542,7 @@ static void reset_channels( FM_ST *ST , FM_CH *CH , int num )
 }
 
 /* initialize generic tables */
-static int init_tables(void)
+static int build_tables(void) /* @restorer: renamed for ZemuX (see init_tables) */
 {
 	signed int i,x;
 	signed int n;
@@ -1657,6 +1657,15 @@ static int init_tables(void)
 
 }
 
+/* @restorer: added for ZemuX */
+/* Tables are shared by all chips, so they are built only once (initialization of the local static is thread-safe), */
+/* and are never written after that. */
+static int init_tables(void)
+{
+	static const int is_built = build_tables();
+	return is_built;
+}
+
 
 
 static void FMCloseTable( void )
@@ -1760,7 +1769,7 @@ static void OPNSetPres(FM_OPN *OPN, int pres, int timer_prescaler, int SSGpres)
 	OPN->ST.timer_prescaler = timer_prescaler;
 
 	/* SSG part  prescaler set */
-	if( SSGpres ) (*OPN->ST.SSG->set_clock)( OPN->ST.device, OPN->ST.clock * 2 / SSGpres );
+	if( SSGpres && OPN->ST.SSG ) (*OPN->ST.SSG->set_clock)( OPN->ST.device, OPN->ST.clock * 2 / SSGpres ); /* @restorer: SSG is not used in ZemuX */
 
 	/* make time tables */
 	init_timetables( &OPN->ST, dt_tab );
@@ -2211,7 +2220,7 @@ void ym2203_reset_chip(void *chip)
 	/* Reset Prescaler */
 	OPNPrescaler_w(OPN, 0 , 1 );
 	/* reset SSG section */
-	(*OPN->ST.SSG->reset)(OPN->ST.device);
+	if( OPN->ST.SSG ) (*OPN->ST.SSG->reset)(OPN->ST.device); /* @restorer: SSG is not used in ZemuX */
 	/* status clear */
 	FM_IRQMASK_SET(&OPN->ST,0x03);
 	FM_BUSY_CLEAR(&OPN->ST);
@@ -2335,7 +2344,7 @@ int ym2203_write(void *chip,int a,uint8_t v)
 		OPN->ST.address = (v &= 0xff);
 
 		/* Write register to SSG emulator */
-		if( v < 16 ) (*OPN->ST.SSG->write)(OPN->ST.device,0,v);
+		if( v < 16 && OPN->ST.SSG ) (*OPN->ST.SSG->write)(OPN->ST.device,0,v); /* @restorer: SSG is not used in ZemuX */
 
 		/* prescaler select : 2d,2e,2f  */
 		if( v >= 0x2d && v <= 0x2f )
@@ -2349,7 +2358,7 @@ int ym2203_write(void *chip,int a,uint8_t v)
 		{
 		case 0x00:  /* 0x00-0x0f : SSG section */
 			/* Write data to SSG emulator */
-			(*OPN->ST.SSG->write)(OPN->ST.device,a,v);
+			if( OPN->ST.SSG ) (*OPN->ST.SSG->write)(OPN->ST.device,a,v); /* @restorer: SSG is not used in ZemuX */
 			break;
 		case 0x20:  /* 0x20-0x2f : Mode section */
 			// ym2203_device::update_request(OPN->ST.device); /* @restorer: commented for ZemuX */
@@ -2378,7 +2387,7 @@ uint8_t ym2203_read(void *chip,int a)
 	}
 	else
 	{   /* data port (only SSG) */
-		if( addr < 16 ) ret = (*F2203->OPN.ST.SSG->read)(F2203->OPN.ST.device);
+		if( addr < 16 && F2203->OPN.ST.SSG ) ret = (*F2203->OPN.ST.SSG->read)(F2203->OPN.ST.device); /* @restorer: SSG is not used in ZemuX */
 	}
 	return ret;
 }